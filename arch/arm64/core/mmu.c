@@ -1162,6 +1162,19 @@ int arch_page_phys_get(void *virt, uintptr_t *phys)
 	return 0;
 }
 
+uintptr_t arch_page_sizes_get(void)
+{
+	uintptr_t sizes = 0;
+	int level;
+
+	/* Block descriptors may be used at every level */
+	for (level = XLAT_LAST_LEVEL; level >= BASE_XLAT_LEVEL; level--) {
+		sizes |= (uintptr_t)1 << LEVEL_TO_VA_SIZE_SHIFT(level);
+	}
+
+	return sizes;
+}
+
 size_t arch_virt_region_align(uintptr_t phys, size_t size)
 {
 	size_t alignment = CONFIG_MMU_PAGE_SIZE;
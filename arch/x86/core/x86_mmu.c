@@ -339,6 +339,17 @@ static inline size_t get_entry_scope(int level)
 	return (1UL << paging_levels[level].shift);
 }
 
+/* Physical address mapped by a leaf entry at a particular level. The address
+ * bits of a large page start at the shift of its level, the ones below hold
+ * the PAT bit or are reserved.
+ */
+__pinned_func
+static inline uintptr_t get_leaf_phys(pentry_t entry, int level)
+{
+	return get_entry_phys(entry, level) &
+	       ~(uintptr_t)(get_entry_scope(level) - 1U);
+}
+
 /* For a table at a particular level, size of the amount of virtual memory
  * that this entire table covers
  */
@@ -911,6 +922,11 @@ static inline bool atomic_pte_cas(pentry_t *target, pentry_t old_value,
  */
 #define OPTION_CLEAR		BIT(3)
 
+/* Indicates that parts of the region suitably aligned in both virtual and
+ * physical memory may be mapped with large pages. Only for new mappings.
+ */
+#define OPTION_LARGE		BIT(4)
+
 /**
  * Atomically update bits in a page table entry
  *
@@ -969,6 +985,133 @@ static inline pentry_t pte_atomic_update(pentry_t *pte, pentry_t update_val,
 	return old_val;
 }
 
+#ifdef CONFIG_X86_MMU_LARGE_PAGES
+#if defined(CONFIG_USERSPACE) && !defined(CONFIG_X86_COMMON_PAGE_TABLE)
+static void *page_pool_get(void);
+#endif
+
+/* Page tables replaced by large pages, linked through their first entry.
+ * They are used again when large pages are split, so there is always one
+ * for each large page mapped in the kernel page tables.
+ */
+static void *large_page_tables;
+
+__pinned_func
+static inline size_t large_page_size(void)
+{
+	return get_entry_scope(PDE_LEVEL);
+}
+
+__pinned_func
+static void large_page_table_put(pentry_t *table)
+{
+	*(void **)table = large_page_tables;
+	large_page_tables = table;
+}
+
+__pinned_func
+static pentry_t *large_page_table_get(void)
+{
+	pentry_t *table = large_page_tables;
+
+	if (table != NULL) {
+		large_page_tables = *(void **)table;
+		return table;
+	}
+
+#if defined(CONFIG_USERSPACE) && !defined(CONFIG_X86_COMMON_PAGE_TABLE)
+	/* Large pages copied into memory domain page tables replaced none */
+	return page_pool_get();
+#else
+	return NULL;
+#endif
+}
+
+__pinned_func
+static bool table_is_empty(pentry_t *table, int level)
+{
+	for (size_t i = 0; i < get_num_entries(level); i++) {
+		if (table[i] != 0) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/* Map a large page in place of the page table of a page directory entry,
+ * provided that this page table does not map anything.
+ */
+__pinned_func
+static int large_page_map_set(pentry_t *ptables, void *virt,
+			      pentry_t entry_val, uint32_t options)
+{
+	bool user_table = (options & OPTION_USER) != 0U;
+	pentry_t *table = ptables;
+	pentry_t *entryp;
+
+	for (int level = 0; level < PDE_LEVEL; level++) {
+		entryp = get_entry_ptr(table, virt, level);
+		if (((*entryp & MMU_P) == 0U) || ((*entryp & MMU_PS) != 0U)) {
+			return -EFAULT;
+		}
+		table = next_table(*entryp, level);
+	}
+
+	entryp = get_entry_ptr(table, virt, PDE_LEVEL);
+	if (((*entryp & MMU_P) != 0U) && ((*entryp & MMU_PS) == 0U)) {
+		table = next_table(*entryp, PDE_LEVEL);
+		if (!table_is_empty(table, PTE_LEVEL)) {
+			return -EBUSY;
+		}
+		large_page_table_put(table);
+	}
+
+	/* Bit 7 is PS in a page directory entry, PAT moves to bit 12 */
+	if ((entry_val & MMU_PAT) != 0U) {
+		entry_val = (entry_val & ~MMU_PAT) | MMU_PAT_LARGE;
+	}
+
+	*entryp = pte_finalize_value(entry_val | MMU_PS, user_table, PDE_LEVEL);
+
+	/* Also drops any cached link to the page table replaced */
+	tlb_flush_page(virt);
+
+	return 0;
+}
+
+/* Replace the large page of a page directory entry by a page table mapping
+ * the same memory with small pages.
+ */
+__pinned_func
+static int large_page_split(pentry_t *entryp, void *virt)
+{
+	pentry_t entry = *entryp;
+	uintptr_t phys = get_leaf_phys(entry, PDE_LEVEL);
+	pentry_t flags = entry & ~paging_levels[PDE_LEVEL].mask & ~MMU_PS;
+	pentry_t *table;
+
+	if ((entry & MMU_PAT_LARGE) != 0U) {
+		flags |= MMU_PAT;
+	}
+
+	table = large_page_table_get();
+	if (table == NULL) {
+		LOG_ERR("no page table to split large page at %p", virt);
+		return -ENOMEM;
+	}
+
+	for (size_t i = 0; i < get_num_entries(PTE_LEVEL); i++) {
+		table[i] = (pentry_t)(phys + (i * CONFIG_MMU_PAGE_SIZE)) | flags;
+	}
+	*entryp = (pentry_t)k_mem_phys_addr(table) | INT_FLAGS;
+
+	tlb_flush_page(virt);
+
+	return 0;
+}
+#endif /* CONFIG_X86_MMU_LARGE_PAGES */
+
 /**
  * Low level page table update function for a virtual page
  *
@@ -1025,6 +1168,16 @@ static int page_map_set(pentry_t *ptables, void *virt, pentry_t entry_val,
 			break;
 		}
 
+#ifdef CONFIG_X86_MMU_LARGE_PAGES
+		/* Updating part of a large page, split it first */
+		if ((level == PDE_LEVEL) && ((*entryp & MMU_PS) != 0U)) {
+			ret = large_page_split(entryp, virt);
+			if (ret != 0) {
+				goto out;
+			}
+		}
+#endif /* CONFIG_X86_MMU_LARGE_PAGES */
+
 		/* We bail out early here due to no support for
 		 * splitting existing bigpage mappings.
 		 * If the PS bit is not supported at some level (like
@@ -1125,6 +1278,18 @@ static int range_map_ptables(pentry_t *ptables, void *virt, uintptr_t phys,
 			entry_val = (pentry_t)(phys + offset) | entry_flags;
 		}
 
+#ifdef CONFIG_X86_MMU_LARGE_PAGES
+		if (((options & OPTION_LARGE) != 0U) &&
+		    (((POINTER_TO_UINT(dest_virt) | (phys + offset)) &
+		      (large_page_size() - 1)) == 0U) &&
+		    ((size - offset) >= large_page_size()) &&
+		    (large_page_map_set(ptables, dest_virt, entry_val,
+					options) == 0)) {
+			offset += large_page_size() - CONFIG_MMU_PAGE_SIZE;
+			continue;
+		}
+#endif /* CONFIG_X86_MMU_LARGE_PAGES */
+
 		ret2 = page_map_set(ptables, dest_virt, entry_val, NULL, mask,
 				   options);
 		ARG_UNUSED(ret2);
@@ -1222,7 +1387,7 @@ static int range_map(void *virt, uintptr_t phys, size_t size,
 
 out:
 #ifdef CONFIG_SMP
-	if ((options & OPTION_FLUSH) != 0U) {
+	if ((options & (OPTION_FLUSH | OPTION_LARGE)) != 0U) {
 		tlb_shootdown();
 	}
 #endif /* CONFIG_SMP */
@@ -1295,14 +1460,32 @@ static pentry_t flags_to_entry(uint32_t flags)
 __pinned_func
 void arch_mem_map(void *virt, uintptr_t phys, size_t size, uint32_t flags)
 {
+	uint32_t options = 0U;
 	int ret;
 
+	if (IS_ENABLED(CONFIG_X86_MMU_LARGE_PAGES) &&
+	    (size >= get_entry_scope(PDE_LEVEL))) {
+		options |= OPTION_LARGE;
+	}
+
 	ret = range_map_unlocked(virt, phys, size, flags_to_entry(flags),
-				 MASK_ALL, 0);
+				 MASK_ALL, options);
 	__ASSERT_NO_MSG(ret == 0);
 	ARG_UNUSED(ret);
 }
 
+__pinned_func
+uintptr_t arch_page_sizes_get(void)
+{
+	uintptr_t sizes = CONFIG_MMU_PAGE_SIZE;
+
+#ifdef CONFIG_X86_MMU_LARGE_PAGES
+	sizes |= get_entry_scope(PDE_LEVEL);
+#endif /* CONFIG_X86_MMU_LARGE_PAGES */
+
+	return sizes;
+}
+
 /* unmap region addr..addr+size, reset entries and flush TLB */
 void arch_mem_unmap(void *addr, size_t size)
 {
@@ -2076,7 +2259,10 @@ int arch_page_phys_get(void *virt, uintptr_t *phys)
 
 	if ((pte & MMU_P) != 0) {
 		if (phys != NULL) {
-			*phys = (uintptr_t)get_entry_phys(pte, PTE_LEVEL);
+			/* Add the offset of the page within a large page */
+			*phys = get_leaf_phys(pte, level) +
+				(POINTER_TO_UINT(virt) &
+				 (get_entry_scope(level) - 1));
 		}
 		ret = 0;
 	} else {
@@ -43,6 +43,7 @@
 #define MMU_D		BITL(6)		/** Dirty */
 #define MMU_PS		BITL(7)		/** Page Size (non PTE)*/
 #define MMU_PAT		BITL(7)		/** Page Attribute (PTE) */
+#define MMU_PAT_LARGE	BITL(12)	/** Page Attribute (large page PDE) */
 #define MMU_G		BITL(8)		/** Global */
 #ifdef XD_SUPPORTED
 #define MMU_XD		BITL(63)	/** Execute Disable */
@@ -338,6 +338,9 @@ void k_thread_foreach_unlocked_filter_by_cpu(unsigned int cpu,
  * @kconfig{CONFIG_DYNAMIC_THREAD_PREFER_POOL} options. Thread stacks from the
  * pool are of maximum size @kconfig{CONFIG_DYNAMIC_THREAD_STACK_SIZE}.
  *
+ * With @kconfig{CONFIG_DYNAMIC_THREAD_STACK_MAPPED}, kernel thread stacks are
+ * first mapped with guard pages, or taken from the freed ones kept mapped.
+ *
  * @note When no longer required, thread stacks allocated with
  * `k_thread_stack_alloc()` must be freed with @ref k_thread_stack_free to
  * avoid leaking memory.
@@ -2339,6 +2342,35 @@ __syscall int k_futex_wait(struct k_futex *futex, int expected,
  */
 __syscall int k_futex_wake(struct k_futex *futex, bool wake_all);
 
+/**
+ * @brief Wake some threads pending on a futex and move others to another one
+ *
+ * Tests that @a futex contains the expected value, and if so, wakes up to
+ * @a num_wake of the highest priority threads pending on it, then moves up
+ * to @a num_requeue of the remaining ones to the wait queue of @a target,
+ * without waking them up. They keep their timeouts and are later woken up
+ * by k_futex_wake() calls on @a target.
+ *
+ * This lets a condition variable broadcast wake up a single waiter and
+ * requeue the others onto the futex of the associated mutex, instead of
+ * waking all of them up only to have them contend for the mutex.
+ *
+ * @param futex Futex to wake up or move pending threads from.
+ * @param expected Expected value of @a futex, if it is different no thread
+ *		   is woken up or moved.
+ * @param target Futex to move pending threads to.
+ * @param num_wake Maximum number of threads to wake up.
+ * @param num_requeue Maximum number of threads to move to @a target.
+ * @retval -EACCES Caller does not have access to a futex address.
+ * @retval -EAGAIN If the futex value did not match the expected parameter.
+ * @retval -EINVAL A futex parameter address not recognized by the kernel, or
+ *		   both parameters are the same futex.
+ * @retval Number of threads that were woken up or moved.
+ */
+__syscall int k_futex_requeue(struct k_futex *futex, int expected,
+			      struct k_futex *target, unsigned int num_wake,
+			      unsigned int num_requeue);
+
 /** @} */
 #endif
 
@@ -3050,6 +3082,7 @@ __syscall int k_stack_pop(struct k_stack *stack, stack_data_t *data,
 
 struct k_work;
 struct k_work_q;
+struct k_work_q_worker;
 struct k_work_queue_config;
 extern struct k_work_q k_sys_work_q;
 
@@ -3260,6 +3293,160 @@ __syscall int k_condvar_wait(struct k_condvar *condvar, struct k_mutex *mutex,
  * @}
  */
 
+/**
+ * @brief Reader-writer lock statistics
+ */
+struct k_rwlock_stats {
+	/** Number of times the lock was taken for writing */
+	uint32_t write_locks;
+	/** Number of times a reader had to wait for the lock */
+	uint32_t read_waits;
+	/** Number of times a writer had to wait for the lock */
+	uint32_t write_waits;
+};
+
+/**
+ * @brief Reader-writer lock structure
+ */
+struct k_rwlock {
+	/** Reader count, writer and waiting writers flags */
+	atomic_t state;
+	/** Thread holding the lock for writing */
+	struct k_thread *writer;
+	/** Original priority of the writer */
+	int writer_orig_prio;
+	/** Threads waiting to read */
+	_wait_q_t readers_wait_q;
+	/** Threads waiting to write */
+	_wait_q_t writers_wait_q;
+	/** Protects wait queues and writer handling */
+	struct k_spinlock lock;
+
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+	struct k_rwlock_stats stats;
+#endif /* CONFIG_OBJ_CORE_STATS_RWLOCK */
+
+#ifdef CONFIG_OBJ_CORE_RWLOCK
+	struct k_obj_core  obj_core;
+#endif /* CONFIG_OBJ_CORE_RWLOCK */
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+#define Z_RWLOCK_INITIALIZER(obj)                                              \
+	{                                                                      \
+		.state = ATOMIC_INIT(0),                                       \
+		.writer = NULL,                                                \
+		.readers_wait_q = Z_WAIT_Q_INIT(&(obj).readers_wait_q),        \
+		.writers_wait_q = Z_WAIT_Q_INIT(&(obj).writers_wait_q),        \
+	}
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @defgroup rwlock_apis Reader-Writer Lock APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief Statically define and initialize a reader-writer lock.
+ *
+ * The lock can be accessed outside the module where it is defined using:
+ *
+ * @code extern struct k_rwlock <name>; @endcode
+ *
+ * @param name Name of the reader-writer lock.
+ */
+#define K_RWLOCK_DEFINE(name)                                                  \
+	STRUCT_SECTION_ITERABLE(k_rwlock, name) =                              \
+		Z_RWLOCK_INITIALIZER(name)
+
+/**
+ * @brief Initialize a reader-writer lock.
+ *
+ * Upon completion, the lock is available and has no readers or writer.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ *
+ * @retval 0 Reader-writer lock object created
+ */
+__syscall int k_rwlock_init(struct k_rwlock *rwlock);
+
+/**
+ * @brief Lock a reader-writer lock for reading.
+ *
+ * Any number of threads may hold the lock for reading at the same time.
+ * Readers wait while a writer holds the lock, and also while a writer waits
+ * for it, so that a steady flow of readers cannot starve writers. A reader
+ * must therefore not take the lock again while it still holds it.
+ *
+ * Taking a lock that is not held for writing and that no writer waits for
+ * is a single atomic operation.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ * @param timeout Waiting period to lock the reader-writer lock,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Reader-writer lock locked for reading.
+ * @retval -EBUSY Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EDEADLK The current thread holds the lock for writing.
+ */
+__syscall int k_rwlock_read_lock(struct k_rwlock *rwlock, k_timeout_t timeout);
+
+/**
+ * @brief Unlock a reader-writer lock held for reading.
+ *
+ * When the last reader unlocks it, the lock is handed over to the highest
+ * priority waiting writer, if any.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ *
+ * @retval 0 Reader-writer lock unlocked.
+ * @retval -EPERM The lock is not held for reading.
+ */
+__syscall int k_rwlock_read_unlock(struct k_rwlock *rwlock);
+
+/**
+ * @brief Lock a reader-writer lock for writing.
+ *
+ * A writer holds the lock exclusively. While it waits for the lock, new
+ * readers wait as well. The writer holding the lock inherits the priority
+ * of the threads waiting for it, as with a mutex; readers holding the lock
+ * are not tracked and do not.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ * @param timeout Waiting period to lock the reader-writer lock,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Reader-writer lock locked for writing.
+ * @retval -EBUSY Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EDEADLK The current thread already holds the lock for writing.
+ */
+__syscall int k_rwlock_write_lock(struct k_rwlock *rwlock, k_timeout_t timeout);
+
+/**
+ * @brief Unlock a reader-writer lock held for writing.
+ *
+ * The lock is handed over to the highest priority waiting writer if any,
+ * otherwise all waiting readers get it.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ *
+ * @retval 0 Reader-writer lock unlocked.
+ * @retval -EINVAL The lock is not held for writing.
+ * @retval -EPERM The current thread does not hold the lock for writing.
+ */
+__syscall int k_rwlock_write_unlock(struct k_rwlock *rwlock);
+
+/**
+ * @}
+ */
+
 /**
  * @defgroup semaphore_apis Semaphore APIs
  * @ingroup kernel_apis
@@ -3366,6 +3553,21 @@ __syscall int k_sem_take(struct k_sem *sem, k_timeout_t timeout);
  */
 __syscall void k_sem_give(struct k_sem *sem);
 
+/**
+ * @brief Give a semaphore several times.
+ *
+ * This routine has the effect of calling k_sem_give() @a count times, but
+ * wakes up all the threads it satisfies at once and reschedules only once,
+ * instead of once per unit. Units that are not taken by waiting threads are
+ * added to the count of @a sem, up to its maximum permitted count.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param sem Address of the semaphore.
+ * @param count Number of units to give.
+ */
+__syscall void k_sem_give_n(struct k_sem *sem, unsigned int count);
+
 /**
  * @brief Resets a semaphore's count to zero.
  *
@@ -4150,6 +4352,12 @@ struct k_work_delayable {
 struct z_work_flusher {
 	struct k_work work;
 	struct k_sem sem;
+#ifdef CONFIG_WORKQUEUE_POOL
+	/* Work item the flusher waits for, not to be overtaken by
+	 * another thread of the queue.
+	 */
+	struct k_work *target;
+#endif /* CONFIG_WORKQUEUE_POOL */
 };
 
 /* Record used to wait for work to complete a cancellation.
@@ -4229,6 +4437,29 @@ struct k_work_queue_config {
 	 * an error will be logged if CONFIG_LOG is enabled.
 	 */
 	uint32_t work_timeout_ms;
+
+#if defined(CONFIG_WORKQUEUE_POOL) || defined(__DOXYGEN__)
+	/** Additional threads processing the work queue.
+	 *
+	 * Requires CONFIG_WORKQUEUE_POOL.  Each of the @ref num_workers
+	 * entries provides the stack, and optionally the CPU, of a thread
+	 * started along with the work queue thread, at the same priority
+	 * and with the same name.  The array must persist until the queue
+	 * is stopped with k_work_queue_stop().
+	 *
+	 * A work item is never run by two threads of the queue at the same
+	 * time: an item submitted again while its handler runs waits for
+	 * the handler to return.  k_work_flush() and k_work_cancel_sync()
+	 * keep waiting for the handler to complete, whichever thread runs
+	 * it.  Apart from that, items of a queue with more than one thread
+	 * may run in any order and concurrently.  Work timeouts are only
+	 * monitored on the thread returned by k_work_queue_thread_get().
+	 */
+	struct k_work_q_worker *workers;
+
+	/** Number of entries in @ref workers. */
+	size_t num_workers;
+#endif /* CONFIG_WORKQUEUE_POOL || __DOXYGEN__ */
 };
 
 /** @brief A structure used to hold work until it can be processed. */
@@ -4262,6 +4493,40 @@ struct k_work_q {
 	struct k_work *work;
 	k_timeout_t work_timeout;
 #endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
+
+#if defined(CONFIG_WORKQUEUE_POOL)
+	/* Additional threads, from k_work_queue_config.workers. */
+	sys_slist_t workers;
+
+	/* Number of threads animating the queue. */
+	uint16_t num_threads;
+
+	/* Number of threads running a work item. */
+	uint16_t num_busy;
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+};
+
+/** @brief A structure holding an additional thread of a work queue.
+ *
+ * See k_work_queue_config.workers.
+ */
+struct k_work_q_worker {
+	/** Stack area of the thread. */
+	k_thread_stack_t *stack;
+
+	/** Size of the stack area, in bytes. */
+	size_t stack_size;
+
+	/** Index of the CPU to pin the thread to, or -1 to let it run on
+	 * any CPU.  Pinning requires CONFIG_SCHED_CPU_MASK.
+	 */
+	int cpu;
+
+	/* The thread that animates the work. */
+	struct k_thread thread;
+
+	/* Node in the list of workers of the queue. */
+	sys_snode_t node;
 };
 
 /* Provide the implementation for inline functions declared above */
@@ -4656,6 +4921,8 @@ struct k_msgq {
 	char *write_ptr;
 	/** Number of used messages */
 	uint32_t used_msgs;
+	/** Number of slots of purged messages behind a claimed message */
+	uint32_t purged_msgs;
 
 	Z_DECL_POLL_EVENT
 
@@ -4694,6 +4961,8 @@ struct k_msgq {
 
 
 #define K_MSGQ_FLAG_ALLOC	BIT(0)
+#define K_MSGQ_FLAG_RESERVED	BIT(1)
+#define K_MSGQ_FLAG_CLAIMED	BIT(2)
 
 /**
  * @brief Message Queue Attributes
@@ -4806,6 +5075,53 @@ int k_msgq_cleanup(struct k_msgq *msgq);
  */
 __syscall int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout);
 
+/**
+ * @brief Reserve a message slot to be written in place.
+ *
+ * This routine reserves the next free slot of message queue @a msgq and
+ * returns its address, so that the caller can build the message directly in
+ * the queue's ring buffer instead of copying it in with k_msgq_put(). The
+ * message becomes visible to readers when k_msgq_put_commit() is called.
+ *
+ * Only one slot can be reserved at a time: until the reservation is
+ * committed, further reservations and k_msgq_put() wait as if the queue was
+ * full. The thread holding the reservation must therefore not write to the
+ * queue before committing it.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ * @note Not available to user mode threads.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param msg Address of the pointer set to the reserved slot.
+ * @param timeout Waiting period for a free slot, or one of the special
+ *                values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Slot reserved.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_msgq_put_reserve(struct k_msgq *msgq, void **msg, k_timeout_t timeout);
+
+/**
+ * @brief Send the message written in a reserved slot.
+ *
+ * This routine makes the message built in the slot returned by
+ * k_msgq_put_reserve() available to readers, handing it to a waiting reader
+ * if any, exactly as k_msgq_put() would.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param msg Address of the reserved slot, as returned by
+ *            k_msgq_put_reserve().
+ *
+ * @retval 0 Message sent.
+ * @retval -EINVAL @a msg is not the reserved slot.
+ */
+int k_msgq_put_commit(struct k_msgq *msgq, void *msg);
+
 /**
  * @brief Receive a message from a message queue.
  *
@@ -4828,6 +5144,52 @@ __syscall int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t time
  */
 __syscall int k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout);
 
+/**
+ * @brief Claim the first message of a message queue to read it in place.
+ *
+ * This routine returns the address of the first message of message queue
+ * @a msgq in the queue's ring buffer, so that the caller can process it
+ * without copying it out with k_msgq_get(). The message keeps its slot
+ * until k_msgq_get_release() is called.
+ *
+ * Only one message can be claimed at a time: until the claim is released,
+ * further claims and k_msgq_get() wait as if the queue was empty. The
+ * thread holding the claim must therefore not read from the queue before
+ * releasing it. Purging the queue does not drop the claimed message.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ * @note Not available to user mode threads.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param msg Address of the pointer set to the claimed message.
+ * @param timeout Waiting period to receive a message, or one of the special
+ *                values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Message claimed.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_msgq_get_claim(struct k_msgq *msgq, void **msg, k_timeout_t timeout);
+
+/**
+ * @brief Release a claimed message.
+ *
+ * This routine removes the message returned by k_msgq_get_claim() from the
+ * queue, freeing its slot for writers.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param msg Address of the claimed message, as returned by
+ *            k_msgq_get_claim().
+ *
+ * @retval 0 Message released.
+ * @retval -EINVAL @a msg is not the claimed message.
+ */
+int k_msgq_get_release(struct k_msgq *msgq, void *msg);
+
 /**
  * @brief Peek/read a message from a message queue.
  *
@@ -4869,6 +5231,10 @@ __syscall int k_msgq_peek_at(struct k_msgq *msgq, void *data, uint32_t idx);
  * buffer. Any threads that are blocked waiting to send a message to the
  * message queue are unblocked and see an -ENOMSG error code.
  *
+ * A message claimed with k_msgq_get_claim() is not discarded, and the slots
+ * of the discarded messages queued behind it only become free once it is
+ * released. A slot reserved with k_msgq_put_reserve() stays reserved.
+ *
  * @param msgq Address of the message queue.
  */
 __syscall void k_msgq_purge(struct k_msgq *msgq);
@@ -4899,7 +5265,9 @@ __syscall void  k_msgq_get_attrs(struct k_msgq *msgq,
 
 static inline uint32_t z_impl_k_msgq_num_free_get(struct k_msgq *msgq)
 {
-	return msgq->max_msgs - msgq->used_msgs;
+	uint32_t reserved = ((msgq->flags & K_MSGQ_FLAG_RESERVED) != 0U) ? 1U : 0U;
+
+	return msgq->max_msgs - msgq->used_msgs - msgq->purged_msgs - reserved;
 }
 
 /**
@@ -4920,6 +5288,181 @@ static inline uint32_t z_impl_k_msgq_num_used_get(struct k_msgq *msgq)
 
 /** @} */
 
+/**
+ * @defgroup ringq_apis Ring Queue APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief Ring Queue Slot
+ *
+ * A ring queue's buffer is an array of slots. Slots are owned by the queue
+ * and must not be accessed by the application.
+ */
+struct k_ringq_slot {
+	/** Sequence number, relative to the slot index */
+	atomic_t seq;
+	/** Queued data item */
+	void *data;
+};
+
+/**
+ * @brief Ring Queue Structure
+ */
+struct k_ringq {
+	/** Position of the next slot to fill */
+	atomic_t head;
+	/** Position up to which all slots have been filled */
+	atomic_t published;
+	/** Position of the next slot to drain */
+	atomic_t tail;
+	/** Slot array */
+	struct k_ringq_slot *slots;
+	/** Number of slots minus one */
+	uint32_t mask;
+	/** Number of threads pended or polling on the queue */
+	atomic_t waiters;
+	/** Ring queue wait queue */
+	_wait_q_t wait_q;
+	/** Lock, only taken when @a waiters is non-zero */
+	struct k_spinlock lock;
+
+	Z_DECL_POLL_EVENT
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+#define Z_RINGQ_INITIALIZER(obj, q_slots, q_num_slots) \
+	{ \
+	.head = ATOMIC_INIT(0), \
+	.published = ATOMIC_INIT(0), \
+	.tail = ATOMIC_INIT(0), \
+	.slots = q_slots, \
+	.mask = (q_num_slots) - 1, \
+	.waiters = ATOMIC_INIT(0), \
+	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
+	.lock = {}, \
+	Z_POLL_EVENT_OBJ_INIT(obj) \
+	}
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @brief Statically define and initialize a ring queue.
+ *
+ * The ring queue can be accessed outside the module where it is defined
+ * using:
+ *
+ * @code extern struct k_ringq <name>; @endcode
+ *
+ * @param name Name of the ring queue.
+ * @param num_slots Maximum number of data items that can be queued
+ *                  (power of 2).
+ */
+#define K_RINGQ_DEFINE(name, num_slots)					\
+	BUILD_ASSERT(IS_POWER_OF_TWO(num_slots),			\
+		     "ring queue size must be a power of two");		\
+	static struct k_ringq_slot _k_ringq_buf_##name[num_slots];	\
+	struct k_ringq name =						\
+		Z_RINGQ_INITIALIZER(name, _k_ringq_buf_##name, (num_slots))
+
+/**
+ * @brief Initialize a ring queue.
+ *
+ * This routine initializes a ring queue object, prior to its first use.
+ *
+ * @param ringq Address of the ring queue.
+ * @param slots Array of slots holding the queued data items.
+ * @param num_slots Number of slots in @a slots (power of 2).
+ */
+void k_ringq_init(struct k_ringq *ringq, struct k_ringq_slot *slots,
+		  uint32_t num_slots);
+
+/**
+ * @brief Add an item to a ring queue.
+ *
+ * This routine adds a pointer-sized data item to the tail of a ring queue.
+ * It never blocks and, unless a thread is waiting for data, completes
+ * without taking any lock: concurrent callers on any CPU only contend on
+ * an atomic compare-and-swap of the queue position.
+ *
+ * The data item is handed over to a thread pending on the queue, if any.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param ringq Address of the ring queue.
+ * @param data Data item, stored as is.
+ *
+ * @retval 0 Data item added.
+ * @retval -ENOMEM Ring queue is full.
+ */
+int k_ringq_put(struct k_ringq *ringq, void *data);
+
+/**
+ * @brief Get an item from a ring queue.
+ *
+ * This routine removes the data item at the head of a ring queue. The
+ * wait queue and its lock are only involved when the ring queue is empty
+ * and @a timeout is not K_NO_WAIT.
+ *
+ * Items are removed in the order they were added, but waiting threads do
+ * not have precedence over threads that find the queue non-empty.
+ *
+ * @funcprops \isr_ok
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @param ringq Address of the ring queue.
+ * @param timeout Waiting period to obtain a data item,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Data item if successful; NULL if returned without waiting, or
+ *         waiting period timed out.
+ */
+void *k_ringq_get(struct k_ringq *ringq, k_timeout_t timeout);
+
+/**
+ * @brief Get the number of items in a ring queue.
+ *
+ * The value is a snapshot, it may be stale by the time it is returned if
+ * other contexts operate on the queue concurrently.
+ *
+ * @param ringq Address of the ring queue.
+ *
+ * @return Number of queued data items.
+ */
+static inline uint32_t k_ringq_num_used_get(struct k_ringq *ringq)
+{
+	atomic_val_t tail = atomic_get(&ringq->tail);
+	atomic_val_t published = atomic_get(&ringq->published);
+	int32_t used = (int32_t)((uint32_t)published - (uint32_t)tail);
+
+	/* The published position is advanced after the items are filled,
+	 * consumers may already have drained past it.
+	 */
+	return (used > 0) ? MIN((uint32_t)used, ringq->mask + 1U) : 0U;
+}
+
+/**
+ * @brief Query a ring queue to see if it has data available.
+ *
+ * @param ringq Address of the ring queue.
+ *
+ * @return Non-zero if the ring queue is empty.
+ * @return 0 if data is available.
+ */
+static inline int k_ringq_is_empty(struct k_ringq *ringq)
+{
+	return (int)(k_ringq_num_used_get(ringq) == 0U);
+}
+
+/** @} */
+
 /**
  * @defgroup mailbox_apis Mailbox APIs
  * @ingroup kernel_apis
@@ -5421,12 +5964,25 @@ struct k_mem_slab_info {
 #endif
 };
 
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+/* Free blocks of a k_mem_slab cached by one CPU, linked like the free list */
+struct z_mem_slab_cpu_cache {
+	struct k_spinlock lock;
+	char *free_list;
+	uint32_t count;
+};
+#endif /* CONFIG_MEM_SLAB_PERCPU_CACHE */
+
 struct k_mem_slab {
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
 	char *buffer;
 	char *free_list;
 	struct k_mem_slab_info info;
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	atomic_t waiters;
+	struct z_mem_slab_cpu_cache cache[CONFIG_MP_MAX_NUM_CPUS];
+#endif /* CONFIG_MEM_SLAB_PERCPU_CACHE */
 
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mem_slab)
 
@@ -5623,6 +6179,29 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem,
  */
 void k_mem_slab_free(struct k_mem_slab *slab, void *mem);
 
+/** @cond INTERNAL_HIDDEN */
+
+/* Number of free blocks held by the per-CPU caches of a memory slab, which
+ * are counted as used in its k_mem_slab_info
+ */
+static inline uint32_t z_mem_slab_num_cached(struct k_mem_slab *slab)
+{
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	uint32_t cached = 0U;
+
+	for (unsigned int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		cached += slab->cache[cpu].count;
+	}
+
+	return cached;
+#else
+	ARG_UNUSED(slab);
+	return 0U;
+#endif /* CONFIG_MEM_SLAB_PERCPU_CACHE */
+}
+
+/** @endcond */
+
 /**
  * @brief Get the number of used blocks in a memory slab.
  *
@@ -5635,7 +6214,7 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem);
  */
 static inline uint32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
 {
-	return slab->info.num_used;
+	return slab->info.num_used - z_mem_slab_num_cached(slab);
 }
 
 /**
@@ -5670,7 +6249,7 @@ static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
  */
 static inline uint32_t k_mem_slab_num_free_get(struct k_mem_slab *slab)
 {
-	return slab->info.num_blocks - slab->info.num_used;
+	return slab->info.num_blocks - k_mem_slab_num_used_get(slab);
 }
 
 /**
@@ -5707,12 +6286,37 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab);
  * @{
  */
 
+#ifdef CONFIG_HEAP_PERCPU_CACHE
+/* Free blocks of a k_heap cached by one CPU, by size class */
+struct z_heap_cpu_cache {
+	struct k_spinlock lock;
+	uint8_t count[CONFIG_HEAP_PERCPU_CACHE_CLASSES];
+	void *blocks[CONFIG_HEAP_PERCPU_CACHE_CLASSES][CONFIG_HEAP_PERCPU_CACHE_DEPTH];
+};
+
+/**
+ * @brief Per-CPU caches of small free blocks of a k_heap
+ *
+ * Storage for the caches of a heap, see k_heap_cache_init() and
+ * K_HEAP_DEFINE_CACHED().
+ */
+struct k_heap_cache {
+	/** @cond INTERNAL_HIDDEN */
+	atomic_t waiters;
+	struct z_heap_cpu_cache cpu[CONFIG_MP_MAX_NUM_CPUS];
+	/** @endcond */
+};
+#endif /* CONFIG_HEAP_PERCPU_CACHE */
+
 /* kernel synchronized heap struct */
 
 struct k_heap {
 	struct sys_heap heap;
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
+#ifdef CONFIG_HEAP_PERCPU_CACHE
+	struct k_heap_cache *cache;
+#endif /* CONFIG_HEAP_PERCPU_CACHE */
 };
 
 /**
@@ -5731,6 +6335,24 @@ struct k_heap {
 void k_heap_init(struct k_heap *h, void *mem,
 		size_t bytes) __attribute_nonnull(1);
 
+#if defined(CONFIG_HEAP_PERCPU_CACHE) || defined(__DOXYGEN__)
+/**
+ * @brief Put per-CPU caches of small blocks in front of a k_heap
+ *
+ * Small allocations and frees of the heap then mostly use the cache of
+ * the current CPU instead of taking the heap lock. This must be called
+ * after k_heap_init() and before the heap is used. Heaps defined with
+ * K_HEAP_DEFINE_CACHED() get their caches without calling it.
+ *
+ * Only available with CONFIG_HEAP_PERCPU_CACHE.
+ *
+ * @param h Heap to add the caches to
+ * @param cache Storage for the caches, kept for the lifetime of the heap
+ */
+void k_heap_cache_init(struct k_heap *h, struct k_heap_cache *cache)
+	__attribute_nonnull(1, 2);
+#endif /* CONFIG_HEAP_PERCPU_CACHE || __DOXYGEN__ */
+
 /**
  * @brief Allocate aligned memory from a k_heap
  *
@@ -5843,8 +6465,14 @@ void k_heap_free(struct k_heap *h, void *mem) __attribute_nonnull(1);
 
 /* Hand-calculated minimum heap sizes needed to return a successful
  * 1-byte allocation.  See details in lib/os/heap.[ch]
+ *
+ * The TLSF engine has more buckets for small sizes, plus bitmaps.
  */
+#ifdef CONFIG_SYS_HEAP_TLSF
+#define Z_HEAP_MIN_SIZE ((sizeof(void *) > 4) ? 88 : 76)
+#else
 #define Z_HEAP_MIN_SIZE ((sizeof(void *) > 4) ? 56 : 44)
+#endif
 
 /**
  * @brief Define a static k_heap in the specified linker section
@@ -5862,7 +6490,13 @@ void k_heap_free(struct k_heap *h, void *mem) __attribute_nonnull(1);
  * @param bytes Size of memory region, in bytes
  * @param in_section Section attribute specifier such as Z_GENERIC_SECTION.
  */
-#define Z_HEAP_DEFINE_IN_SECT(name, bytes, in_section)		\
+#ifdef CONFIG_HEAP_PERCPU_CACHE
+#define Z_HEAP_CACHE_INIT(cache_ptr) .cache = (cache_ptr),
+#else
+#define Z_HEAP_CACHE_INIT(cache_ptr)
+#endif /* CONFIG_HEAP_PERCPU_CACHE */
+
+#define Z_HEAP_DEFINE_IN_SECT_WITH_CACHE(name, bytes, in_section, cache_ptr) \
 	char in_section						\
 	     __aligned(8) /* CHUNK_UNIT */			\
 	     kheap_##name[MAX(bytes, Z_HEAP_MIN_SIZE)];		\
@@ -5871,8 +6505,12 @@ void k_heap_free(struct k_heap *h, void *mem) __attribute_nonnull(1);
 			.init_mem = kheap_##name,		\
 			.init_bytes = MAX(bytes, Z_HEAP_MIN_SIZE), \
 		 },						\
+		Z_HEAP_CACHE_INIT(cache_ptr)			\
 	}
 
+#define Z_HEAP_DEFINE_IN_SECT(name, bytes, in_section)		\
+	Z_HEAP_DEFINE_IN_SECT_WITH_CACHE(name, bytes, in_section, NULL)
+
 /**
  * @brief Define a static k_heap
  *
@@ -5908,6 +6546,27 @@ void k_heap_free(struct k_heap *h, void *mem) __attribute_nonnull(1);
 #define K_HEAP_DEFINE_NOCACHE(name, bytes)			\
 	Z_HEAP_DEFINE_IN_SECT(name, bytes, __nocache)
 
+/**
+ * @brief Define a static k_heap with per-CPU caches of small blocks
+ *
+ * Same as K_HEAP_DEFINE(), with the heap set up as if
+ * k_heap_cache_init() had been called on it. With
+ * CONFIG_HEAP_PERCPU_CACHE disabled, this is K_HEAP_DEFINE().
+ *
+ * @param name Symbol name for the struct k_heap object
+ * @param bytes Size of memory region, in bytes
+ */
+#ifdef CONFIG_HEAP_PERCPU_CACHE
+#define K_HEAP_DEFINE_CACHED(name, bytes)			\
+	static struct k_heap_cache kheap_cache_##name;		\
+	Z_HEAP_DEFINE_IN_SECT_WITH_CACHE(name, bytes,		\
+			__noinit_named(kheap_buf_##name),	\
+			&kheap_cache_##name)
+#else
+#define K_HEAP_DEFINE_CACHED(name, bytes)			\
+	K_HEAP_DEFINE(name, bytes)
+#endif /* CONFIG_HEAP_PERCPU_CACHE */
+
 /** @brief Get the array of statically defined heaps
  *
  * Returns the pointer to the start of the static heap array.
@@ -6037,6 +6696,9 @@ enum _poll_types_bits {
 	/* pipe data availability */
 	_POLL_TYPE_PIPE_DATA_AVAILABLE,
 
+	/* ring queue data availability */
+	_POLL_TYPE_RINGQ_DATA_AVAILABLE,
+
 	_POLL_NUM_TYPES
 };
 
@@ -6065,6 +6727,9 @@ enum _poll_states_bits {
 	/* data is available to read from a pipe */
 	_POLL_STATE_PIPE_DATA_AVAILABLE,
 
+	/* data is available to read from a ring queue */
+	_POLL_STATE_RINGQ_DATA_AVAILABLE,
+
 	_POLL_NUM_STATES
 };
 
@@ -6099,6 +6764,7 @@ enum _poll_states_bits {
 #define K_POLL_TYPE_FIFO_DATA_AVAILABLE K_POLL_TYPE_DATA_AVAILABLE
 #define K_POLL_TYPE_MSGQ_DATA_AVAILABLE Z_POLL_TYPE_BIT(_POLL_TYPE_MSGQ_DATA_AVAILABLE)
 #define K_POLL_TYPE_PIPE_DATA_AVAILABLE Z_POLL_TYPE_BIT(_POLL_TYPE_PIPE_DATA_AVAILABLE)
+#define K_POLL_TYPE_RINGQ_DATA_AVAILABLE Z_POLL_TYPE_BIT(_POLL_TYPE_RINGQ_DATA_AVAILABLE)
 
 /* public - polling modes */
 enum k_poll_modes {
@@ -6116,6 +6782,7 @@ enum k_poll_modes {
 #define K_POLL_STATE_FIFO_DATA_AVAILABLE K_POLL_STATE_DATA_AVAILABLE
 #define K_POLL_STATE_MSGQ_DATA_AVAILABLE Z_POLL_STATE_BIT(_POLL_STATE_MSGQ_DATA_AVAILABLE)
 #define K_POLL_STATE_PIPE_DATA_AVAILABLE Z_POLL_STATE_BIT(_POLL_STATE_PIPE_DATA_AVAILABLE)
+#define K_POLL_STATE_RINGQ_DATA_AVAILABLE Z_POLL_STATE_BIT(_POLL_STATE_RINGQ_DATA_AVAILABLE)
 #define K_POLL_STATE_CANCELLED Z_POLL_STATE_BIT(_POLL_STATE_CANCELLED)
 
 /* public - poll signal object */
@@ -6177,6 +6844,7 @@ struct k_poll_event {
 		struct k_queue *queue, *typed_K_POLL_TYPE_DATA_AVAILABLE;
 		struct k_msgq *msgq, *typed_K_POLL_TYPE_MSGQ_DATA_AVAILABLE;
 		struct k_pipe *pipe, *typed_K_POLL_TYPE_PIPE_DATA_AVAILABLE;
+		struct k_ringq *ringq, *typed_K_POLL_TYPE_RINGQ_DATA_AVAILABLE;
 	};
 };
 
@@ -6325,6 +6993,86 @@ __syscall void k_poll_signal_check(struct k_poll_signal *sig,
 
 __syscall int k_poll_signal_raise(struct k_poll_signal *sig, int result);
 
+/**
+ * @brief Poll set
+ *
+ * A set of poll events that stay registered with their objects between
+ * waits. See k_pollset_init().
+ */
+struct k_pollset {
+	/** PRIVATE - DO NOT TOUCH */
+	struct z_poller poller;
+
+	/** PRIVATE - events whose condition is met, not returned yet */
+	sys_dlist_t ready;
+
+	/** PRIVATE - events returned by the last wait, re-armed by the next */
+	sys_dlist_t returned;
+
+	/** PRIVATE - threads waiting for an event */
+	_wait_q_t wait_q;
+};
+
+/**
+ * @brief Initialize a poll set.
+ *
+ * A poll set keeps its events registered with the objects they poll
+ * between calls to k_pollset_wait(), which only returns the events that
+ * are ready. Waiting on a set thus costs time in the number of events
+ * ready, not in the number of events in the set, unlike k_poll().
+ *
+ * Poll sets are only available to supervisor threads.
+ *
+ * @param set The poll set to initialize.
+ */
+void k_pollset_init(struct k_pollset *set);
+
+/**
+ * @brief Add an event to a poll set.
+ *
+ * The event must have been initialized with k_poll_event_init() or one of
+ * the K_POLL_EVENT_*INITIALIZER() macros, and must not be in another set or
+ * passed to k_poll() until it is removed from this set. It must persist
+ * until then.
+ *
+ * @param set The poll set.
+ * @param event The event to add.
+ */
+void k_pollset_add(struct k_pollset *set, struct k_poll_event *event);
+
+/**
+ * @brief Remove an event from a poll set.
+ *
+ * @param set The poll set.
+ * @param event The event to remove.
+ *
+ * @retval 0 The event was removed.
+ * @retval -ENOENT The event is not in the set.
+ */
+int k_pollset_del(struct k_pollset *set, struct k_poll_event *event);
+
+/**
+ * @brief Wait for events of a poll set to be ready.
+ *
+ * Returns pointers to up to @a max_events events of the set that are ready,
+ * with their state field set as by k_poll(). Events are level-triggered:
+ * the condition of an event returned by one call is checked again by the
+ * next call on the same set, which returns it again if it still holds.
+ * Events that were ready but did not fit in @a ready are returned by the
+ * next call.
+ *
+ * @param set The poll set.
+ * @param ready Array receiving pointers to the ready events.
+ * @param max_events Number of entries in @a ready.
+ * @param timeout Waiting period for an event to be ready,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of ready events stored in @a ready, or -EAGAIN if the
+ *	   waiting period timed out.
+ */
+int k_pollset_wait(struct k_pollset *set, struct k_poll_event **ready, int max_events,
+		   k_timeout_t timeout);
+
 /** @} */
 
 /**
@@ -31,6 +31,9 @@
 
 struct k_mem_page_frame;
 
+/** Number of bins in the refault distance histogram */
+#define K_MEM_PAGING_REFAULT_DISTANCE_BINS 8
+
 /**
  * Paging Statistics.
  */
@@ -50,6 +53,11 @@ struct k_mem_paging_stats_t {
 		/** Number of page faults while in ISR */
 		unsigned long			in_isr;
 #endif /* !CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+
+#if (CONFIG_DEMAND_PAGING_PREFETCH_PAGES > 0) || defined(__DOXYGEN__)
+		/** Number of data pages read ahead of sequential page faults */
+		unsigned long			prefetched;
+#endif /* CONFIG_DEMAND_PAGING_PREFETCH_PAGES > 0 */
 	} pagefaults;
 
 	struct {
@@ -59,6 +67,29 @@ struct k_mem_paging_stats_t {
 		/** Number of dirty pages selected for eviction */
 		unsigned long			dirty;
 	} eviction;
+
+#if defined(CONFIG_DEMAND_PAGING_REFAULT_TRACKING) || defined(__DOXYGEN__)
+	struct {
+		/** Number of page faults on recently evicted data pages */
+		unsigned long			refaults;
+
+		/**
+		 * Refaults by refault distance, the number of pages evicted
+		 * between the eviction of a page and its refault. Bin 0
+		 * counts distances below 2 and bin N distances from 2^N
+		 * to 2^(N+1) - 1, the last bin counting all larger ones.
+		 */
+		unsigned long			distance[K_MEM_PAGING_REFAULT_DISTANCE_BINS];
+
+#if defined(CONFIG_EVICTION_WORKING_SET) || defined(__DOXYGEN__)
+		/**
+		 * Working set size estimated by the eviction algorithm, in
+		 * page frames. Not tracked per thread.
+		 */
+		unsigned long			size;
+#endif /* CONFIG_EVICTION_WORKING_SET */
+	} workingset;
+#endif /* CONFIG_DEMAND_PAGING_REFAULT_TRACKING */
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 };
 
@@ -282,6 +313,48 @@ static inline void k_mem_paging_eviction_accessed(uintptr_t phys)
 
 #endif /* CONFIG_EVICTION_TRACKING || __DOXYGEN__ */
 
+#if defined(CONFIG_EVICTION_REFAULT) || defined(__DOXYGEN__)
+
+/**
+ * Process a page frame as holding a refaulted data page
+ *
+ * The kernel will invoke this after paging a data page back in that it
+ * evicted @a distance evictions ago, see
+ * @kconfig{CONFIG_DEMAND_PAGING_REFAULT_TRACKING}. A short refault distance
+ * means the page would have stayed resident with a little more memory, and
+ * should be protected from eviction.
+ *
+ * This function is invoked with interrupts locked.
+ *
+ * @param [in] pf The page frame now holding the data page
+ * @param [in] distance Number of pages evicted since the data page was
+ */
+void k_mem_paging_eviction_refault(struct k_mem_page_frame *pf, uint32_t distance);
+
+#else /* CONFIG_EVICTION_REFAULT || __DOXYGEN__ */
+
+static inline void k_mem_paging_eviction_refault(struct k_mem_page_frame *pf,
+						 uint32_t distance)
+{
+	ARG_UNUSED(pf);
+	ARG_UNUSED(distance);
+}
+
+#endif /* CONFIG_EVICTION_REFAULT || __DOXYGEN__ */
+
+#if defined(CONFIG_EVICTION_WORKING_SET) || defined(__DOXYGEN__)
+
+/**
+ * Get the working set size estimated by the eviction algorithm
+ *
+ * Used to fill the paging statistics.
+ *
+ * @return Number of page frames in the working set
+ */
+unsigned long k_mem_paging_eviction_working_set_get(void);
+
+#endif /* CONFIG_EVICTION_WORKING_SET || __DOXYGEN__ */
+
 /**
  * Select a page frame for eviction
  *
@@ -450,6 +523,43 @@ void k_mem_paging_backing_store_page_finalize(struct k_mem_page_frame *pf,
  */
 void k_mem_paging_backing_store_init(void);
 
+#if defined(CONFIG_BACKING_STORE_ZRAM) || defined(__DOXYGEN__)
+
+/**
+ * Compressed RAM backing store statistics
+ */
+struct k_mem_paging_zram_stats {
+	/** Number of data pages stored */
+	unsigned long pages;
+
+	/** Number of data pages stored uncompressed, not being compressible */
+	unsigned long incompressible;
+
+	/** Total size of the data pages stored once compressed, in bytes */
+	size_t compressed_size;
+
+	/** Size of the pool memory used to store them, in bytes */
+	size_t used_size;
+
+	/** Total size of the pool, in bytes */
+	size_t pool_size;
+};
+
+/**
+ * Get the compressed RAM backing store statistics
+ *
+ * The compression ratio of the data pages stored is
+ * @c pages * @kconfig{CONFIG_MMU_PAGE_SIZE} / @c compressed_size. The time
+ * spent compressing and decompressing pages is part of the backing store
+ * page-out and page-in timing histograms, see
+ * @kconfig{CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM}.
+ *
+ * @param[out] stats Statistics of the compressed RAM backing store
+ */
+void k_mem_paging_zram_stats_get(struct k_mem_paging_zram_stats *stats);
+
+#endif /* CONFIG_BACKING_STORE_ZRAM || __DOXYGEN__ */
+
 /** @} */
 
 #ifdef __cplusplus
@@ -127,6 +127,23 @@ struct _priq_mq {
 #endif
 };
 
+#ifdef CONFIG_SCHED_BITMAPQ
+/* Two-level bitmap indexed array of per-priority lists.  Bit N of l1
+ * is set when l2[N] is non-zero and bit M of l2[N] when queues[N * 32 + M]
+ * is non-empty, so the best list is found with two count-trailing-zeros
+ * operations.  The list head array starts on its own cache line so the
+ * bitmaps, read on every scheduling decision, do not share one with list
+ * heads being modified.  The list heads themselves are packed.
+ */
+#define PRIQ_BM_WORDS (DIV_ROUND_UP(K_NUM_THREAD_PRIO, 32))
+
+struct _priq_bm {
+	uint32_t l1;
+	uint32_t l2[PRIQ_BM_WORDS];
+	sys_dlist_t queues[K_NUM_THREAD_PRIO] __aligned(CONFIG_SCHED_BITMAPQ_ALIGN);
+};
+#endif /* CONFIG_SCHED_BITMAPQ */
+
 struct _ready_q {
 #ifndef CONFIG_SMP
 	/* always contains next thread to run: cannot be NULL */
@@ -139,6 +156,16 @@ struct _ready_q {
 	struct _priq_rb runq;
 #elif defined(CONFIG_SCHED_MULTIQ)
 	struct _priq_mq runq;
+#elif defined(CONFIG_SCHED_BITMAPQ)
+	struct _priq_bm runq;
+#endif
+
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	/* number of threads in runq, used to balance CPU load */
+	unsigned int nr_ready;
+
+	/* priority of the head of runq, used to find threads to steal */
+	int best_prio;
 #endif
 };
 
@@ -157,7 +184,7 @@ struct _cpu {
 	/* one assigned idle thread per CPU */
 	struct k_thread *idle_thread;
 
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	struct _ready_q ready_q;
 #endif
 
@@ -213,7 +240,7 @@ struct z_kernel {
 	 * ready queue: can be big, keep after small fields, since some
 	 * assembly (e.g. ARC) are limited in the encoding of the offset
 	 */
-#ifndef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if !defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) && !defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	struct _ready_q ready_q;
 #endif
 
@@ -305,6 +332,10 @@ struct _timeout {
 #else
 	int32_t dticks;
 #endif
+#ifdef CONFIG_TIMEOUT_QUEUE_PER_CPU
+	/* Index of the CPU whose queue holds this timeout */
+	uint8_t cpu;
+#endif
 };
 
 typedef void (*k_thread_timeslice_fn_t)(struct k_thread *thread, void *data);
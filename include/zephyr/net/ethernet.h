@@ -202,6 +202,9 @@ enum ethernet_hw_caps {
 
 	/** TX-Injection supported */
 	ETHERNET_TXINJECTION_MODE	= BIT(20),
+
+	/** TCP segmentation offload supported, see net_pkt_gso_size() */
+	ETHERNET_HW_TSO			= BIT(21),
 };
 
 /** @cond INTERNAL_HIDDEN */
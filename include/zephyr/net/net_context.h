@@ -401,9 +401,33 @@ __net_socket struct net_context {
 #if defined(CONFIG_NET_CONTEXT_TIMESTAMPING)
 		/** Enable RX, TX or both timestamps of packets send through sockets. */
 		uint8_t timestamping;
+#endif
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+		/** Allow zero-copy sends (SO_ZEROCOPY) on a socket. */
+		bool zerocopy;
 #endif
 	} options;
 
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+	/** Zero-copy send completions */
+	struct {
+		/** Raised when a zero-copy send completes */
+		struct k_poll_signal signal;
+		/** Last buffer of the send in progress */
+		struct net_buf *last;
+		/** Identifier of the next zero-copy send */
+		uint32_t next;
+		/** All sends before this one have completed */
+		uint32_t done;
+		/** Sends completed out of order, bit N being send done + N */
+		uint32_t pending;
+		/** Completions before this one have been reported */
+		uint32_t reported;
+		/** References of completed sends left to drop */
+		atomic_t unrefs;
+	} zerocopy;
+#endif /* CONFIG_NET_CONTEXT_ZEROCOPY */
+
 	/** Protocol (UDP, TCP or IEEE 802.3 protocol value) */
 	uint16_t proto;
 
@@ -1296,7 +1320,9 @@ int net_context_sendto(struct net_context *context,
  *
  * @param context The network context to use.
  * @param msghdr The data to send
- * @param flags Flags for the sending.
+ * @param flags Flags for the sending. With ZSOCK_MSG_ZEROCOPY, if the
+ * NET_OPT_ZEROCOPY option is set, the data is referenced instead of being
+ * copied, see net_context_zerocopy_get().
  * @param cb Caller-supplied callback function.
  * @param timeout Currently this value is not used.
  * @param user_data Caller-supplied user data.
@@ -1399,6 +1425,7 @@ enum net_context_option {
 	NET_OPT_LOCAL_PORT_RANGE  = 21, /**< Clamp local port range */
 	NET_OPT_IPV6_MCAST_LOOP	  = 22, /**< IPV6 multicast loop */
 	NET_OPT_IPV4_MCAST_LOOP	  = 23, /**< IPV4 multicast loop */
+	NET_OPT_ZEROCOPY          = 24, /**< Zero-copy sends */
 };
 
 /**
@@ -1429,6 +1456,32 @@ int net_context_get_option(struct net_context *context,
 			   enum net_context_option option,
 			   void *value, size_t *len);
 
+/**
+ * @brief Get the zero-copy sends which completed since the last call.
+ *
+ * @details Zero-copy sends are numbered from 0 in the order they are made,
+ * and the stack no longer uses the data of a completed send. Completions are
+ * reported in the same order, as a range of sends.
+ *
+ * @param context The network context to use.
+ * @param lo First completed send (returned to caller)
+ * @param hi Last completed send (returned to caller)
+ *
+ * @return 0 if ok, -EAGAIN if no send completed since the last call,
+ * -ENOTSUP if zero-copy sends are not supported.
+ */
+int net_context_zerocopy_get(struct net_context *context,
+			     uint32_t *lo, uint32_t *hi);
+
+/**
+ * @brief Check if zero-copy send completions are waiting to be read.
+ *
+ * @param context The network context to use.
+ *
+ * @return True if net_context_zerocopy_get() would report completions.
+ */
+bool net_context_zerocopy_pending(struct net_context *context);
+
 /**
  * @typedef net_context_cb_t
  * @brief Callback used while iterating over network contexts
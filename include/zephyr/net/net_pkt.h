@@ -316,6 +316,18 @@ struct net_pkt {
 	uint16_t vlan_tci;
 #endif /* CONFIG_NET_VLAN */
 
+#if defined(CONFIG_NET_TCP_GSO) || defined(CONFIG_NET_TCP_GRO)
+	/* Size of the TCP segments the payload of this packet is made of,
+	 * 0 if it is a single segment. Such a packet is split before being
+	 * sent, and its TCP checksum is only valid per segment.
+	 */
+	uint16_t gso_size;
+	/* The TCP segments of this packet need no checksum check, as they
+	 * were verified before being coalesced, or never left this host.
+	 */
+	uint8_t gso_verified : 1;
+#endif
+
 #if defined(NET_PKT_HAS_CONTROL_BLOCK)
 	/* TODO: Evolve this into a union of orthogonal
 	 *       control block declarations if further L2
@@ -1172,6 +1184,54 @@ static inline void net_pkt_set_vlan_tci(struct net_pkt *pkt, uint16_t tci)
 }
 #endif
 
+#if defined(CONFIG_NET_TCP_GSO) || defined(CONFIG_NET_TCP_GRO)
+static inline uint16_t net_pkt_gso_size(struct net_pkt *pkt)
+{
+	return pkt->gso_size;
+}
+
+static inline void net_pkt_set_gso_size(struct net_pkt *pkt, uint16_t size)
+{
+	pkt->gso_size = size;
+}
+
+static inline bool net_pkt_is_gso_verified(struct net_pkt *pkt)
+{
+	return !!(pkt->gso_verified);
+}
+
+static inline void net_pkt_set_gso_verified(struct net_pkt *pkt, bool verified)
+{
+	pkt->gso_verified = verified;
+}
+#else
+static inline uint16_t net_pkt_gso_size(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return 0U;
+}
+
+static inline void net_pkt_set_gso_size(struct net_pkt *pkt, uint16_t size)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(size);
+}
+
+static inline bool net_pkt_is_gso_verified(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return false;
+}
+
+static inline void net_pkt_set_gso_verified(struct net_pkt *pkt, bool verified)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(verified);
+}
+#endif
+
 #if defined(CONFIG_NET_PKT_TIMESTAMP) || defined(CONFIG_NET_PKT_TXTIME)
 static inline struct net_ptp_time *net_pkt_timestamp(struct net_pkt *pkt)
 {
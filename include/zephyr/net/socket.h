@@ -77,6 +77,15 @@ extern "C" {
 #define ZSOCK_MSG_DONTWAIT 0x40
 /** zsock_recv: block until the full amount of data can be returned */
 #define ZSOCK_MSG_WAITALL 0x100
+/** zsock_recvmsg: Read zero-copy send completions instead of data */
+#define ZSOCK_MSG_ERRQUEUE 0x2000
+/** zsock_recvmmsg: Override operation to non-blocking after the first message */
+#define ZSOCK_MSG_WAITFORONE 0x10000
+/**
+ * zsock_send/zsock_sendmsg: Lend the data to the stack instead of having it
+ * copied, if the SO_ZEROCOPY option is set. Ignored for calls from user mode.
+ */
+#define ZSOCK_MSG_ZEROCOPY 0x4000000
 /** @} */
 
 /**
@@ -537,6 +546,88 @@ __syscall ssize_t zsock_recvfrom(int sock, void *buf, size_t max_len,
  */
 __syscall ssize_t zsock_recvmsg(int sock, struct msghdr *msg, int flags);
 
+/**
+ * @brief Send several messages to arbitrary network addresses
+ *
+ * @details
+ * Sends the messages of @p msgvec in turn as if by zsock_sendmsg(), but
+ * in one call holding the socket lock once, and sets the @c msg_len field
+ * of each message sent to the number of bytes sent. Stops at the first
+ * error, which is only reported if no message was sent.
+ * See Linux man 2 sendmmsg for a description.
+ * This function is also exposed as `sendmmsg()`
+ * if @kconfig{CONFIG_POSIX_API} is defined.
+ *
+ * @param sock Socket
+ * @param msgvec Messages to send
+ * @param vlen Number of messages in @p msgvec
+ * @param flags Flags, as for zsock_sendmsg()
+ *
+ * @return Number of messages sent, or -1 and errno set on error.
+ */
+__syscall int zsock_sendmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			     int flags);
+
+/**
+ * @brief Receive several messages from arbitrary network addresses
+ *
+ * @details
+ * Receives messages into @p msgvec in turn as if by zsock_recvmsg(), but
+ * in one call holding the socket lock once, and sets the @c msg_len field
+ * of each message received to the number of bytes received. Stops at the
+ * first error, which is only reported if no message was received, or once
+ * @p timeout expired after receiving a message. With ZSOCK_MSG_WAITFORONE,
+ * only waits for the first message, so that a call returns all the queued
+ * messages without waiting for more.
+ * See Linux man 2 recvmmsg for a description.
+ * This function is also exposed as `recvmmsg()`
+ * if @kconfig{CONFIG_POSIX_API} is defined.
+ *
+ * @param sock Socket
+ * @param msgvec Messages to receive
+ * @param vlen Number of messages in @p msgvec
+ * @param flags Flags, as for zsock_recvmsg(), and ZSOCK_MSG_WAITFORONE
+ * @param timeout Time after which no more messages are received, or NULL
+ *
+ * @return Number of messages received, or -1 and errno set on error.
+ */
+__syscall int zsock_recvmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			     int flags, struct timespec *timeout);
+
+struct net_buf;
+
+/**
+ * @brief Receive data without copying it
+ *
+ * @details
+ * Receives the next datagram of a datagram socket, or the data of the next
+ * received segment of a stream socket, as the network buffers holding it,
+ * so that it can be parsed in place. The buffers are owned by the caller,
+ * which must release them with zsock_recvbuf_release() once done.
+ * They are taken from the network RX buffer pool, so holding them for long
+ * stops the reception of packets.
+ * Only supported by native UDP, TCP and raw IP sockets, and from supervisor
+ * mode, as the buffers are kernel memory.
+ *
+ * @param sock Socket
+ * @param buf Set to the buffer chain received, NULL if no data is returned
+ * @param flags Flags, as for zsock_recvfrom(), except ZSOCK_MSG_PEEK
+ * @param src_addr Source address of a datagram, or NULL
+ * @param addrlen Length of @p src_addr, updated with the address length
+ *
+ * @return Number of bytes received, 0 at the end of a stream, or -1 and
+ *         errno set on error.
+ */
+ssize_t zsock_recvbuf(int sock, struct net_buf **buf, int flags,
+		      struct sockaddr *src_addr, socklen_t *addrlen);
+
+/**
+ * @brief Release the buffers received with zsock_recvbuf()
+ *
+ * @param buf Buffer chain received, can be NULL
+ */
+void zsock_recvbuf_release(struct net_buf *buf);
+
 /**
  * @brief Receive data from a connected peer
  *
@@ -932,6 +1023,29 @@ struct ifreq {
 /** Socket TX time (same as SO_TXTIME) */
 #define SCM_TXTIME SO_TXTIME
 
+/** Allow zero-copy sends with ZSOCK_MSG_ZEROCOPY */
+#define SO_ZEROCOPY 62
+
+/** Origin of the sock_extended_err structures reporting zero-copy sends */
+#define SO_EE_ORIGIN_ZEROCOPY 5
+
+/**
+ * @brief Extended error reported by recvmsg() with ZSOCK_MSG_ERRQUEUE.
+ *
+ * For zero-copy send completions, ee_origin is SO_EE_ORIGIN_ZEROCOPY and the
+ * sends from ee_info to ee_data included have completed, sends being
+ * numbered from 0 in the order they were made with ZSOCK_MSG_ZEROCOPY.
+ */
+struct sock_extended_err {
+	uint32_t ee_errno;  /**< Error number */
+	uint8_t  ee_origin; /**< Where the error originated */
+	uint8_t  ee_type;   /**< Type */
+	uint8_t  ee_code;   /**< Code */
+	uint8_t  ee_pad;    /**< Padding */
+	uint32_t ee_info;   /**< Additional information */
+	uint32_t ee_data;   /**< Other data */
+};
+
 /** Timestamp generation flags */
 
 /** Request RX timestamps generated by network adapter. */
@@ -991,6 +1105,11 @@ struct in_pktinfo {
 	struct in_addr ipi_addr;     /**< Header Destination address */
 };
 
+/** Ancillary message type of the sock_extended_err structures returned by
+ *  recvmsg() with ZSOCK_MSG_ERRQUEUE on IPv4 sockets.
+ */
+#define IP_RECVERR 11
+
 /** Retrieve the current known path MTU of the current socket. Returns an
  *  integer. IP_MTU is valid only for getsockopt and can be employed only when
  *  the socket has been connected.
@@ -1077,6 +1196,11 @@ struct ipv6_mreq {
  */
 #define IPV6_MTU 24
 
+/** Ancillary message type of the sock_extended_err structures returned by
+ *  recvmsg() with ZSOCK_MSG_ERRQUEUE on IPv6 sockets.
+ */
+#define IPV6_RECVERR 25
+
 /** Don't support IPv4 access */
 #define IPV6_V6ONLY 26
 
@@ -13,10 +13,13 @@
 #define SHUT_WR   ZSOCK_SHUT_WR
 #define SHUT_RDWR ZSOCK_SHUT_RDWR
 
-#define MSG_PEEK     ZSOCK_MSG_PEEK
-#define MSG_TRUNC    ZSOCK_MSG_TRUNC
-#define MSG_DONTWAIT ZSOCK_MSG_DONTWAIT
-#define MSG_WAITALL  ZSOCK_MSG_WAITALL
+#define MSG_PEEK       ZSOCK_MSG_PEEK
+#define MSG_TRUNC      ZSOCK_MSG_TRUNC
+#define MSG_DONTWAIT   ZSOCK_MSG_DONTWAIT
+#define MSG_WAITALL    ZSOCK_MSG_WAITALL
+#define MSG_ERRQUEUE   ZSOCK_MSG_ERRQUEUE
+#define MSG_WAITFORONE ZSOCK_MSG_WAITFORONE
+#define MSG_ZEROCOPY   ZSOCK_MSG_ZEROCOPY
 
 #ifdef __cplusplus
 extern "C" {
@@ -38,8 +41,11 @@ ssize_t recv(int sock, void *buf, size_t max_len, int flags);
 ssize_t recvfrom(int sock, void *buf, size_t max_len, int flags, struct sockaddr *src_addr,
 		 socklen_t *addrlen);
 ssize_t recvmsg(int sock, struct msghdr *msg, int flags);
+int recvmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen, int flags,
+	     struct timespec *timeout);
 ssize_t send(int sock, const void *buf, size_t len, int flags);
 ssize_t sendmsg(int sock, const struct msghdr *message, int flags);
+int sendmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen, int flags);
 ssize_t sendto(int sock, const void *buf, size_t len, int flags, const struct sockaddr *dest_addr,
 	       socklen_t addrlen);
 int setsockopt(int sock, int level, int optname, const void *optval, socklen_t optlen);
@@ -11,8 +11,8 @@
  * sys_mutex behaves almost exactly like k_mutex, with the added advantage
  * that a sys_mutex instance can reside in user memory.
  *
- * Further enhancements will support locking/unlocking uncontended sys_mutexes
- * with simple atomic ops instead of syscalls, similar to Linux's
+ * With CONFIG_SYS_MUTEX_FAST_PATH, uncontended sys_mutexes are locked and
+ * unlocked with simple atomic ops instead of syscalls, similar to Linux's
  * FUTEX_LOCK_PI and FUTEX_UNLOCK_PI
  */
 
@@ -22,17 +22,55 @@ extern "C" {
 
 #ifdef CONFIG_USERSPACE
 #include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util_macro.h>
 #include <zephyr/types.h>
 #include <zephyr/sys_clock.h>
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+#include <zephyr/kernel.h>
+#endif /* CONFIG_SYS_MUTEX_FAST_PATH */
+
+/* Set in the lock word while the kernel tracks the owner of a sys_mutex,
+ * thread objects are at least word aligned so the low bit is free.
+ */
+#define SYS_MUTEX_CONTENDED BIT(0)
 
 struct sys_mutex {
-	/* Currently unused, but will be used to store state for fast mutexes
-	 * that can be locked/unlocked with atomic ops if there is no
-	 * contention
+	/* With CONFIG_SYS_MUTEX_FAST_PATH, the owner thread ID ORed with
+	 * SYS_MUTEX_CONTENDED if other threads contend for the mutex, or 0
+	 * when unlocked. Unused otherwise.
 	 */
 	atomic_t val;
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+	/* Number of times the owner locked the mutex, only ever accessed by
+	 * the owner, or by the kernel on its behalf
+	 */
+	uint32_t lock_count;
+#endif /* CONFIG_SYS_MUTEX_FAST_PATH */
 };
 
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+/* Number of sys_mutexes each thread remembers the kernel accepted */
+#define Z_SYS_MUTEX_CHECKED_SLOTS 4
+
+/* Per-thread cache of the sys_mutexes that the kernel locked or unlocked for
+ * the thread, only those are handled on the fast path. Others go through the
+ * kernel, which checks the address and the caller's access to it before the
+ * lock word is ever touched.
+ */
+extern Z_THREAD_LOCAL struct sys_mutex *z_sys_mutex_checked[Z_SYS_MUTEX_CHECKED_SLOTS];
+
+static inline struct sys_mutex **z_sys_mutex_checked_slot(struct sys_mutex *mutex)
+{
+	return &z_sys_mutex_checked[((uintptr_t)mutex / sizeof(struct sys_mutex)) %
+				    Z_SYS_MUTEX_CHECKED_SLOTS];
+}
+
+static inline bool z_sys_mutex_is_checked(struct sys_mutex *mutex)
+{
+	return (mutex != NULL) && (*z_sys_mutex_checked_slot(mutex) == mutex);
+}
+#endif /* CONFIG_SYS_MUTEX_FAST_PATH */
+
 /**
  * @defgroup user_mutex_apis User mode mutex APIs
  * @ingroup usermode_apis
@@ -67,10 +105,14 @@ struct sys_mutex {
  */
 static inline void sys_mutex_init(struct sys_mutex *mutex)
 {
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+	atomic_set(&mutex->val, 0);
+#else
 	ARG_UNUSED(mutex);
+#endif /* CONFIG_SYS_MUTEX_FAST_PATH */
 
-	/* Nothing to do, kernel-side data structures are initialized at
-	 * boot
+	/* Nothing else to do, kernel-side data structures are initialized
+	 * at boot
 	 */
 }
 
@@ -98,11 +140,41 @@ __syscall int z_sys_mutex_kernel_unlock(struct sys_mutex *mutex);
  * @retval -EAGAIN Waiting period timed out.
  * @retval -EACCES Caller has no access to provided mutex address
  * @retval -EINVAL Provided mutex not recognized by the kernel
+ *
+ * @note With CONFIG_SYS_MUTEX_FAST_PATH, the first use of a mutex by a
+ *       thread goes through the kernel, which checks the mutex address.
  */
 static inline int sys_mutex_lock(struct sys_mutex *mutex, k_timeout_t timeout)
 {
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+	atomic_val_t self = (atomic_val_t)k_current_get();
+	int ret;
+
+	if (likely(z_sys_mutex_is_checked(mutex))) {
+		if (likely(atomic_cas(&mutex->val, 0, self))) {
+			mutex->lock_count = 1U;
+			return 0;
+		}
+
+		if ((atomic_get(&mutex->val) & ~SYS_MUTEX_CONTENDED) == self) {
+			mutex->lock_count++;
+			return 0;
+		}
+	}
+
+	/* The kernel keeps the lock count up to date on this path, including
+	 * for a mutex we hold but evicted from the cache
+	 */
+	ret = z_sys_mutex_kernel_lock(mutex, timeout);
+	if (ret == 0) {
+		*z_sys_mutex_checked_slot(mutex) = mutex;
+	}
+
+	return ret;
+#else
 	/* For now, make the syscall unconditionally */
 	return z_sys_mutex_kernel_lock(mutex, timeout);
+#endif /* CONFIG_SYS_MUTEX_FAST_PATH */
 }
 
 /**
@@ -124,8 +196,37 @@ static inline int sys_mutex_lock(struct sys_mutex *mutex, k_timeout_t timeout)
  */
 static inline int sys_mutex_unlock(struct sys_mutex *mutex)
 {
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+	atomic_val_t self = (atomic_val_t)k_current_get();
+	int ret;
+
+	if (z_sys_mutex_is_checked(mutex) &&
+	    ((atomic_get(&mutex->val) & ~SYS_MUTEX_CONTENDED) == self)) {
+		if (mutex->lock_count > 1U) {
+			mutex->lock_count--;
+			return 0;
+		}
+
+		/* The mutex may change hands as soon as the word is updated */
+		mutex->lock_count = 0U;
+		if (likely(atomic_cas(&mutex->val, self, 0))) {
+			return 0;
+		}
+	}
+
+	/* Contended, not ours or unknown: let the kernel sort it out, it also
+	 * drops recursive locks of a mutex evicted from the cache
+	 */
+	ret = z_sys_mutex_kernel_unlock(mutex);
+	if (ret == 0) {
+		*z_sys_mutex_checked_slot(mutex) = mutex;
+	}
+
+	return ret;
+#else
 	/* For now, make the syscall unconditionally */
 	return z_sys_mutex_kernel_unlock(mutex);
+#endif /* CONFIG_SYS_MUTEX_FAST_PATH */
 }
 
 #include <zephyr/syscalls/mutex.h>
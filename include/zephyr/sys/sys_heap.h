@@ -10,6 +10,7 @@
 #include <stdbool.h>
 #include <zephyr/types.h>
 #include <zephyr/sys/mem_stats.h>
+#include <zephyr/sys/util.h>
 #include <zephyr/toolchain.h>
 
 #ifdef __cplusplus
@@ -45,6 +46,13 @@ extern "C" {
  * extreme values results in an effectively linear search of the
  * list), objectively fast (~hundred instructions) and amenable to
  * locked operation.
+ *
+ * Alternatively, CONFIG_SYS_HEAP_TLSF selects a two-level segregated
+ * fit (TLSF) search: each power of two is split into several buckets,
+ * and a request is served from the first chunk of the smallest
+ * non-empty bucket whose chunks all fit, found with two bitmap
+ * lookups.  No free list is ever walked, so the worst case is as good
+ * as the average case, at the cost of a few more bucket headers.
  */
 
 /* Note: the init_mem/bytes fields are for the static initializer to
@@ -54,10 +62,59 @@ extern "C" {
  * put the two values somewhere else, though it would make
  * SYS_HEAP_DEFINE a little hairy to write.
  */
+#ifdef CONFIG_SYS_HEAP_ANALYSIS
+#ifdef CONFIG_SYS_HEAP_TLSF
+/** Number of bins of the bucket search walk length histogram */
+#define SYS_HEAP_ANALYSIS_WALK_BINS 2
+/** Largest number of buckets of a heap of @p bytes bytes, one row per
+ * power of two of its 8-byte chunk count, plus the two rows of small sizes
+ */
+#define SYS_HEAP_ANALYSIS_BUCKETS(bytes)                                       \
+	((LOG2CEIL((bytes) / 8U) + 2) << CONFIG_SYS_HEAP_TLSF_SL_LOG2)
+#else
+/** Number of bins of the bucket search walk length histogram */
+#define SYS_HEAP_ANALYSIS_WALK_BINS MIN(CONFIG_SYS_HEAP_ALLOC_LOOPS + 1, 16)
+/** Largest number of buckets of a heap of @p bytes bytes, one per power
+ * of two of its 8-byte chunk count
+ */
+#define SYS_HEAP_ANALYSIS_BUCKETS(bytes) (LOG2CEIL((bytes) / 8U) + 1)
+#endif /* CONFIG_SYS_HEAP_TLSF */
+
+/**
+ * @brief Allocation latency and search statistics of a sys_heap
+ *
+ * Size class N counts requests (or freed blocks) of up to 8 << N bytes,
+ * the last class counting all larger ones. Latency bin N counts operations
+ * taking from 2^N to 2^(N + 1) - 1 cycles, the last bin counting all longer
+ * ones.
+ */
+struct sys_heap_analysis {
+	/** Allocation latencies, by request size class and latency bin */
+	uint32_t alloc_latency[CONFIG_SYS_HEAP_ANALYSIS_SIZE_CLASSES]
+			      [CONFIG_SYS_HEAP_ANALYSIS_LATENCY_BINS];
+	/** Free latencies, by block size class and latency bin */
+	uint32_t free_latency[CONFIG_SYS_HEAP_ANALYSIS_SIZE_CLASSES]
+			     [CONFIG_SYS_HEAP_ANALYSIS_LATENCY_BINS];
+	/** Allocations by number of chunks tried in the smallest bucket */
+	uint32_t alloc_walk[SYS_HEAP_ANALYSIS_WALK_BINS];
+	/** Allocations served from a larger bucket after that search */
+	uint32_t alloc_fallbacks;
+	/** Failed allocations */
+	uint32_t alloc_failures;
+	/** Size of the last failed request, in bytes */
+	size_t last_failure_bytes;
+	/** Largest free block when the last request failed, in bytes */
+	size_t last_failure_largest_free;
+};
+#endif /* CONFIG_SYS_HEAP_ANALYSIS */
+
 struct sys_heap {
 	struct z_heap *heap;
 	void *init_mem;
 	size_t init_bytes;
+#ifdef CONFIG_SYS_HEAP_ANALYSIS
+	struct sys_heap_analysis analysis;
+#endif /* CONFIG_SYS_HEAP_ANALYSIS */
 };
 
 struct z_heap_stress_result {
@@ -94,6 +151,123 @@ int sys_heap_runtime_stats_get(struct sys_heap *heap,
  */
 int sys_heap_runtime_stats_reset_max(struct sys_heap *heap);
 
+#ifdef CONFIG_SYS_HEAP_ANALYSIS
+/**
+ * @brief Free space of one sys_heap bucket
+ *
+ * Buckets hold free chunks of increasing sizes. Bucket N holds the free
+ * chunks of at least 2^N chunk units (of 8 bytes) above the minimum chunk
+ * size, or with CONFIG_SYS_HEAP_TLSF, of at least N units up to twice the
+ * number of buckets of a row, and a fraction of a power of two above.
+ */
+struct sys_heap_bucket_info {
+	/** Number of free blocks */
+	uint32_t free_blocks;
+	/** Total size of the free blocks, in bytes */
+	size_t free_bytes;
+	/** Size of the largest free block, in bytes */
+	size_t largest_free_bytes;
+};
+
+/**
+ * @brief Get the free space of a sys_heap, by bucket
+ *
+ * Reports how the free memory of the heap is split: an allocation fails
+ * as soon as it is larger than the largest free block, however much
+ * memory is free in total. This walks all free blocks of the heap.
+ *
+ * @note The sys_heap implementation is not internally synchronized.
+ * No two sys_heap functions should operate on the same heap at the
+ * same time.  All locking must be provided by the user.
+ *
+ * @param heap Heap to analyze
+ * @param buckets Array receiving the free space of each bucket
+ * @param max_buckets Number of entries in @a buckets, at most
+ *        #SYS_HEAP_ANALYSIS_BUCKETS of the heap size are used
+ * @return Number of buckets of the heap, which may be larger than
+ *         @a max_buckets, or -EINVAL if null pointers
+ */
+int sys_heap_fragmentation_get(struct sys_heap *heap,
+			       struct sys_heap_bucket_info *buckets,
+			       int max_buckets);
+
+/** Magic number starting a sys_heap_analysis_dump() image, "HEAP" */
+#define SYS_HEAP_ANALYSIS_DUMP_MAGIC 0x50414548U
+/** Version of the sys_heap_analysis_dump() image layout */
+#define SYS_HEAP_ANALYSIS_DUMP_VERSION 1U
+
+/**
+ * @brief Header of a sys_heap_analysis_dump() image
+ *
+ * The header is followed by, all as native-endian 32-bit words:
+ * the alloc_latency and free_latency histograms of struct
+ * sys_heap_analysis, in row-major order; its alloc_walk histogram; its
+ * alloc_fallbacks, alloc_failures, last_failure_bytes and
+ * last_failure_largest_free fields; then free_blocks, free_bytes and
+ * largest_free_bytes for each of @a buckets buckets.
+ */
+struct sys_heap_analysis_dump_hdr {
+	uint32_t magic;
+	uint8_t version;
+	uint8_t size_classes;
+	uint8_t latency_bins;
+	uint8_t walk_bins;
+	uint32_t buckets;
+	/** Heap size, in bytes */
+	uint32_t heap_bytes;
+	/** Cycles per second of the latencies */
+	uint32_t cycles_per_sec;
+};
+
+/** Largest size of a sys_heap_analysis_dump() image of a heap of @p bytes
+ * bytes, in bytes
+ */
+#define SYS_HEAP_ANALYSIS_DUMP_SIZE(bytes)                                     \
+	(sizeof(struct sys_heap_analysis_dump_hdr) +                           \
+	 sizeof(uint32_t) * (2 * CONFIG_SYS_HEAP_ANALYSIS_SIZE_CLASSES *       \
+			     CONFIG_SYS_HEAP_ANALYSIS_LATENCY_BINS +           \
+			     SYS_HEAP_ANALYSIS_WALK_BINS + 4 +                 \
+			     3 * SYS_HEAP_ANALYSIS_BUCKETS(bytes)))
+
+/**
+ * @brief Get the allocation statistics of a sys_heap
+ *
+ * @param heap Heap to get the statistics of
+ * @param analysis Struct into which to copy the statistics
+ * @return -EINVAL if null pointers, otherwise 0
+ */
+int sys_heap_analysis_get(struct sys_heap *heap,
+			  struct sys_heap_analysis *analysis);
+
+/**
+ * @brief Reset the allocation statistics of a sys_heap
+ *
+ * @param heap Heap to reset the statistics of
+ * @return -EINVAL if null pointer, otherwise 0
+ */
+int sys_heap_analysis_reset(struct sys_heap *heap);
+
+/**
+ * @brief Dump the allocation statistics and free space of a sys_heap
+ *
+ * Stores a binary image of the allocation statistics and of the free space
+ * by bucket of the heap, for offline analysis. The image starts with a
+ * struct sys_heap_analysis_dump_hdr describing its layout.
+ *
+ * @note The sys_heap implementation is not internally synchronized.
+ * No two sys_heap functions should operate on the same heap at the
+ * same time.  All locking must be provided by the user.
+ *
+ * @param heap Heap to dump
+ * @param buf Buffer receiving the image
+ * @param len Size of @a buf, at most #SYS_HEAP_ANALYSIS_DUMP_SIZE of the
+ *        heap size is needed
+ * @return Size of the image, -EINVAL if null pointers, or -ENOSPC if
+ *         @a buf is too small
+ */
+int sys_heap_analysis_dump(struct sys_heap *heap, void *buf, size_t len);
+#endif /* CONFIG_SYS_HEAP_ANALYSIS */
+
 /** @brief Initialize sys_heap
  *
  * Initializes a sys_heap struct to manage the specified memory.
@@ -748,6 +748,20 @@
  */
 #define sys_port_trace_k_sem_give_exit(sem)
 
+/**
+ * @brief Trace giving several units of a Semaphore entry
+ * @param sem Semaphore object
+ * @param count Number of units given
+ */
+#define sys_port_trace_k_sem_give_n_enter(sem, count)
+
+/**
+ * @brief Trace giving several units of a Semaphore exit
+ * @param sem Semaphore object
+ * @param count Number of units given
+ */
+#define sys_port_trace_k_sem_give_n_exit(sem, count)
+
 /**
  * @brief Trace taking a Semaphore attempt start
  * @param sem Semaphore object
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_
+#define ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_
+
+#include <stdint.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/fdtable.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ZVFS_EPOLLIN      ZVFS_POLLIN
+#define ZVFS_EPOLLPRI     ZVFS_POLLPRI
+#define ZVFS_EPOLLOUT     ZVFS_POLLOUT
+#define ZVFS_EPOLLERR     ZVFS_POLLERR
+#define ZVFS_EPOLLHUP     ZVFS_POLLHUP
+#define ZVFS_EPOLLONESHOT BIT(30)
+#define ZVFS_EPOLLET      BIT(31)
+
+#define ZVFS_EPOLL_CTL_ADD 1
+#define ZVFS_EPOLL_CTL_DEL 2
+#define ZVFS_EPOLL_CTL_MOD 3
+
+#define ZVFS_EPOLL_CLOEXEC 0x80000
+
+union zvfs_epoll_data {
+	void *ptr;
+	int fd;
+	uint32_t u32;
+	uint64_t u64;
+};
+
+struct zvfs_epoll_event {
+	uint32_t events;
+	union zvfs_epoll_data data;
+};
+
+/**
+ * @brief Create a ZVFS epoll instance
+ *
+ * An epoll instance keeps a list of file descriptors of interest, each
+ * registered once with the objects it waits on, and only returns the ones
+ * that are ready. Waiting on it costs time in the number of ready file
+ * descriptors rather than in the number of file descriptors watched.
+ *
+ * Only ZVFS_EPOLL_CLOEXEC is accepted in @p flags, and has no effect.
+ *
+ * @return New epoll file descriptor on success, -1 on error
+ */
+int zvfs_epoll_create1(int flags);
+
+/**
+ * @brief Add, modify or remove a file descriptor of an epoll instance
+ *
+ * Events are level-triggered: a file descriptor is returned by every wait
+ * as long as one of its events holds. With ZVFS_EPOLLONESHOT it is only
+ * returned once, until it is re-enabled with ZVFS_EPOLL_CTL_MOD. Edge
+ * triggering (ZVFS_EPOLLET) is not supported.
+ *
+ * A file descriptor is removed from all epoll instances when it is closed.
+ *
+ * @param epfd Epoll file descriptor
+ * @param op ZVFS_EPOLL_CTL_ADD, ZVFS_EPOLL_CTL_MOD or ZVFS_EPOLL_CTL_DEL
+ * @param fd File descriptor to watch
+ * @param event Events to watch and data to return, ignored for
+ *        ZVFS_EPOLL_CTL_DEL
+ *
+ * @return 0 on success, -1 on error
+ */
+int zvfs_epoll_ctl(int epfd, int op, int fd, struct zvfs_epoll_event *event);
+
+/**
+ * @brief Wait for file descriptors of an epoll instance to be ready
+ *
+ * @param epfd Epoll file descriptor
+ * @param events Array receiving the ready file descriptors' events
+ * @param maxevents Number of entries in @p events
+ * @param timeout Waiting period, or one of the special values K_NO_WAIT
+ *        and K_FOREVER
+ *
+ * @return Number of entries stored in @p events, 0 on timeout, -1 on error
+ */
+int zvfs_epoll_wait(int epfd, struct zvfs_epoll_event *events, int maxevents,
+		    k_timeout_t timeout);
+
+/** @cond INTERNAL_HIDDEN */
+
+/* Called by zvfs_close() to drop @p fd from all epoll instances */
+void zvfs_epoll_fd_closed(int fd);
+
+/** @endcond */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_ */
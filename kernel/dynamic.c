@@ -9,6 +9,7 @@
 #include <zephyr/kernel.h>
 #include <ksched.h>
 #include <zephyr/kernel/thread_stack.h>
+#include <zephyr/kernel/mm.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/bitarray.h>
 #include <zephyr/sys/kobject.h>
@@ -56,6 +57,155 @@ static k_thread_stack_t *z_thread_stack_alloc_pool(size_t size)
 	return stack;
 }
 
+#ifdef CONFIG_DYNAMIC_THREAD_STACK_MAPPED
+/*
+ * Kernel stacks are mapped from anonymous memory with k_mem_map(), which
+ * leaves unmapped guard pages on both sides. A stack spans a power of two
+ * of pages, its size class, and its descriptor is stored at the top of it,
+ * above the part given to the thread. Freed stacks stay mapped in a LIFO
+ * list per size class, so that the pages last used are reused first.
+ *
+ * Lazily mapped stacks are populated as they are touched, and each page is
+ * pinned when it is, see z_thread_stack_mapped_contains(): kernel threads
+ * may not fault on their own stack once running, for instance with
+ * interrupts locked. The page holding the descriptor is pinned up front,
+ * as it is accessed with mapped_lock held.
+ */
+struct dyn_mapped_stack {
+	sys_snode_t node;
+	k_thread_stack_t *stack;
+	uint8_t class;
+};
+
+#define MAPPED_CLASSES CONFIG_DYNAMIC_THREAD_STACK_MAPPED_CLASSES
+
+#ifdef CONFIG_DYNAMIC_THREAD_STACK_MAPPED_LAZY
+#define MAPPED_FLAGS K_MEM_PERM_RW
+#else
+#define MAPPED_FLAGS (K_MEM_PERM_RW | K_MEM_MAP_LOCK | K_MEM_MAP_UNINIT)
+#endif /* CONFIG_DYNAMIC_THREAD_STACK_MAPPED_LAZY */
+
+static struct k_spinlock mapped_lock;
+/* Stacks handed out, to tell them from other stacks when freed */
+static sys_slist_t mapped_used;
+static sys_slist_t mapped_free[MAPPED_CLASSES];
+static uint16_t mapped_free_count[MAPPED_CLASSES];
+
+static inline size_t mapped_class_size(int class)
+{
+	return (size_t)CONFIG_MMU_PAGE_SIZE << class;
+}
+
+static k_thread_stack_t *z_thread_stack_alloc_mapped(size_t size)
+{
+	size_t pages = DIV_ROUND_UP(K_KERNEL_STACK_LEN(size) + sizeof(struct dyn_mapped_stack),
+				    CONFIG_MMU_PAGE_SIZE);
+	int class = LOG2CEIL(pages);
+	struct dyn_mapped_stack *desc;
+	k_spinlock_key_t key;
+	k_thread_stack_t *stack;
+	sys_snode_t *node;
+
+	if (class >= MAPPED_CLASSES) {
+		LOG_DBG("stack size %zu is too large to be mapped", size);
+		return NULL;
+	}
+
+	key = k_spin_lock(&mapped_lock);
+	node = sys_slist_get(&mapped_free[class]);
+	if (node != NULL) {
+		mapped_free_count[class]--;
+		sys_slist_prepend(&mapped_used, node);
+		k_spin_unlock(&mapped_lock, key);
+
+		return CONTAINER_OF(node, struct dyn_mapped_stack, node)->stack;
+	}
+	k_spin_unlock(&mapped_lock, key);
+
+	stack = k_mem_map(mapped_class_size(class), MAPPED_FLAGS);
+	if (stack == NULL) {
+		LOG_DBG("unable to map a stack of %zu bytes", mapped_class_size(class));
+		return NULL;
+	}
+
+	desc = (struct dyn_mapped_stack *)((uint8_t *)stack + mapped_class_size(class)) - 1;
+#ifdef CONFIG_DYNAMIC_THREAD_STACK_MAPPED_LAZY
+	k_mem_pin((uint8_t *)stack + mapped_class_size(class) - CONFIG_MMU_PAGE_SIZE,
+		  CONFIG_MMU_PAGE_SIZE);
+#endif /* CONFIG_DYNAMIC_THREAD_STACK_MAPPED_LAZY */
+	desc->stack = stack;
+	desc->class = class;
+
+	key = k_spin_lock(&mapped_lock);
+	sys_slist_prepend(&mapped_used, &desc->node);
+	k_spin_unlock(&mapped_lock, key);
+
+	return stack;
+}
+
+#ifdef CONFIG_DYNAMIC_THREAD_STACK_MAPPED_LAZY
+bool z_thread_stack_mapped_contains(void *addr)
+{
+	struct dyn_mapped_stack *desc;
+	k_spinlock_key_t key;
+	uint8_t *base;
+	bool found = false;
+
+	/* Pages of freed stacks are only touched again once handed out */
+	key = k_spin_lock(&mapped_lock);
+	SYS_SLIST_FOR_EACH_CONTAINER(&mapped_used, desc, node) {
+		base = (uint8_t *)desc->stack;
+		if (((uint8_t *)addr >= base) &&
+		    ((uint8_t *)addr < (base + mapped_class_size(desc->class)))) {
+			found = true;
+			break;
+		}
+	}
+	k_spin_unlock(&mapped_lock, key);
+
+	return found;
+}
+#endif /* CONFIG_DYNAMIC_THREAD_STACK_MAPPED_LAZY */
+
+/* Returns -ENOENT if the stack was not mapped by z_thread_stack_alloc_mapped() */
+static int z_thread_stack_free_mapped(k_thread_stack_t *stack)
+{
+	struct dyn_mapped_stack *desc;
+	k_spinlock_key_t key;
+	sys_snode_t *prev = NULL;
+	bool cached = false;
+	int class;
+
+	key = k_spin_lock(&mapped_lock);
+	SYS_SLIST_FOR_EACH_CONTAINER(&mapped_used, desc, node) {
+		if (desc->stack == stack) {
+			break;
+		}
+		prev = &desc->node;
+	}
+
+	if (desc == NULL) {
+		k_spin_unlock(&mapped_lock, key);
+		return -ENOENT;
+	}
+
+	sys_slist_remove(&mapped_used, prev, &desc->node);
+	class = desc->class;
+	if (mapped_free_count[class] < CONFIG_DYNAMIC_THREAD_STACK_MAPPED_CACHE_DEPTH) {
+		sys_slist_prepend(&mapped_free[class], &desc->node);
+		mapped_free_count[class]++;
+		cached = true;
+	}
+	k_spin_unlock(&mapped_lock, key);
+
+	if (!cached) {
+		k_mem_unmap(stack, mapped_class_size(class));
+	}
+
+	return 0;
+}
+#endif /* CONFIG_DYNAMIC_THREAD_STACK_MAPPED */
+
 static k_thread_stack_t *z_thread_stack_alloc_dyn(size_t size, int flags)
 {
 	if ((flags & K_USER) == K_USER) {
@@ -76,6 +226,15 @@ k_thread_stack_t *z_impl_k_thread_stack_alloc(size_t size, int flags)
 {
 	k_thread_stack_t *stack = NULL;
 
+#ifdef CONFIG_DYNAMIC_THREAD_STACK_MAPPED
+	if ((flags & K_USER) == 0) {
+		stack = z_thread_stack_alloc_mapped(size);
+		if (stack != NULL) {
+			return stack;
+		}
+	}
+#endif /* CONFIG_DYNAMIC_THREAD_STACK_MAPPED */
+
 	if (IS_ENABLED(CONFIG_DYNAMIC_THREAD_PREFER_ALLOC)) {
 		stack = z_thread_stack_alloc_dyn(size, flags);
 		if (stack == NULL && CONFIG_DYNAMIC_THREAD_POOL_SIZE > 0) {
@@ -128,6 +287,12 @@ int z_impl_k_thread_stack_free(k_thread_stack_t *stack)
 		}
 	}
 
+#ifdef CONFIG_DYNAMIC_THREAD_STACK_MAPPED
+	if (z_thread_stack_free_mapped(stack) == 0) {
+		return 0;
+	}
+#endif /* CONFIG_DYNAMIC_THREAD_STACK_MAPPED */
+
 	if (CONFIG_DYNAMIC_THREAD_POOL_SIZE > 0) {
 		if (IS_ARRAY_ELEMENT(dynamic_stack, stack)) {
 			if (sys_bitarray_free(&dynamic_ba, 1, ARRAY_INDEX(dynamic_stack, stack))) {
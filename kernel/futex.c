@@ -11,6 +11,7 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/init.h>
 #include <ksched.h>
+#include <kthread.h>
 
 static struct z_futex_data *k_futex_find_data(struct k_futex *futex)
 {
@@ -27,8 +28,7 @@ static struct z_futex_data *k_futex_find_data(struct k_futex *futex)
 int z_impl_k_futex_wake(struct k_futex *futex, bool wake_all)
 {
 	k_spinlock_key_t key;
-	unsigned int woken = 0U;
-	struct k_thread *thread;
+	unsigned int woken;
 	struct z_futex_data *futex_data;
 
 	futex_data = k_futex_find_data(futex);
@@ -38,14 +38,7 @@ int z_impl_k_futex_wake(struct k_futex *futex, bool wake_all)
 
 	key = k_spin_lock(&futex_data->lock);
 
-	do {
-		thread = z_unpend_first_thread(&futex_data->wait_q);
-		if (thread != NULL) {
-			woken++;
-			arch_thread_return_value_set(thread, 0);
-			z_ready_thread(thread);
-		}
-	} while (thread && wake_all);
+	woken = z_unpend_n(&futex_data->wait_q, wake_all ? UINT_MAX : 1U, 0);
 
 	if (woken == 0) {
 		k_spin_unlock(&futex_data->lock, key);
@@ -66,6 +59,41 @@ static inline int z_vrfy_k_futex_wake(struct k_futex *futex, bool wake_all)
 }
 #include <zephyr/syscalls/k_futex_wake_mrsh.c>
 
+#ifdef CONFIG_FUTEX_ADAPTIVE_SPIN
+static bool other_cpus_busy(void)
+{
+	unsigned int cpu = arch_curr_cpu()->id;
+
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		if ((i != cpu) && !z_is_idle_thread_object(_kernel.cpus[i].current)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* A futex has no owner to watch, so spin as long as another CPU runs a
+ * thread that may change the value: with all of them idle, only an ISR
+ * could, and blocking right away is the better bet. Returns true if the
+ * value changed.
+ */
+static bool spin_on_value(struct k_futex *futex, int expected)
+{
+	for (unsigned int i = 0; i < CONFIG_FUTEX_SPIN_ITERATIONS; i++) {
+		if (atomic_get(&futex->val) != (atomic_val_t)expected) {
+			return true;
+		}
+		if (!other_cpus_busy()) {
+			break;
+		}
+		arch_spin_relax();
+	}
+
+	return false;
+}
+#endif /* CONFIG_FUTEX_ADAPTIVE_SPIN */
+
 int z_impl_k_futex_wait(struct k_futex *futex, int expected,
 			k_timeout_t timeout)
 {
@@ -78,12 +106,22 @@ int z_impl_k_futex_wait(struct k_futex *futex, int expected,
 		return -EINVAL;
 	}
 
-	if (atomic_get(&futex->val) != (atomic_val_t)expected) {
+#ifdef CONFIG_FUTEX_ADAPTIVE_SPIN
+	if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT) && spin_on_value(futex, expected)) {
 		return -EAGAIN;
 	}
+#endif /* CONFIG_FUTEX_ADAPTIVE_SPIN */
 
 	key = k_spin_lock(&futex_data->lock);
 
+	/* Checked under the lock, so that a waker changing the value and
+	 * calling k_futex_wake() cannot slip in before we are pended.
+	 */
+	if (atomic_get(&futex->val) != (atomic_val_t)expected) {
+		k_spin_unlock(&futex_data->lock, key);
+		return -EAGAIN;
+	}
+
 	ret = z_pend_curr(&futex_data->lock,
 			key, &futex_data->wait_q, timeout);
 	if (ret == -EAGAIN) {
@@ -103,3 +141,70 @@ static inline int z_vrfy_k_futex_wait(struct k_futex *futex, int expected,
 	return z_impl_k_futex_wait(futex, expected, timeout);
 }
 #include <zephyr/syscalls/k_futex_wait_mrsh.c>
+
+int z_impl_k_futex_requeue(struct k_futex *futex, int expected,
+			   struct k_futex *target, unsigned int num_wake,
+			   unsigned int num_requeue)
+{
+	k_spinlock_key_t key;
+	k_spinlock_key_t key2;
+	unsigned int woken;
+	unsigned int moved;
+	struct z_futex_data *futex_data;
+	struct z_futex_data *target_data;
+	struct z_futex_data *first;
+	struct z_futex_data *second;
+
+	futex_data = k_futex_find_data(futex);
+	target_data = k_futex_find_data(target);
+	if ((futex_data == NULL) || (target_data == NULL) ||
+	    (futex_data == target_data)) {
+		return -EINVAL;
+	}
+
+	/* Take both locks in address order, so that two threads requeueing
+	 * between the same futexes in opposite directions cannot deadlock.
+	 */
+	if (futex_data < target_data) {
+		first = futex_data;
+		second = target_data;
+	} else {
+		first = target_data;
+		second = futex_data;
+	}
+
+	key = k_spin_lock(&first->lock);
+	key2 = k_spin_lock(&second->lock);
+
+	if (atomic_get(&futex->val) != (atomic_val_t)expected) {
+		k_spin_unlock(&second->lock, key2);
+		k_spin_unlock(&first->lock, key);
+		return -EAGAIN;
+	}
+
+	woken = z_unpend_n(&futex_data->wait_q, num_wake, 0);
+	moved = z_requeue_n(&futex_data->wait_q, &target_data->wait_q, num_requeue);
+
+	k_spin_unlock(&second->lock, key2);
+
+	if (woken == 0) {
+		k_spin_unlock(&first->lock, key);
+	} else {
+		z_reschedule(&first->lock, key);
+	}
+
+	return woken + moved;
+}
+
+static inline int z_vrfy_k_futex_requeue(struct k_futex *futex, int expected,
+					 struct k_futex *target, unsigned int num_wake,
+					 unsigned int num_requeue)
+{
+	if ((K_SYSCALL_MEMORY_WRITE(futex, sizeof(struct k_futex)) != 0) ||
+	    (K_SYSCALL_MEMORY_WRITE(target, sizeof(struct k_futex)) != 0)) {
+		return -EACCES;
+	}
+
+	return z_impl_k_futex_requeue(futex, expected, target, num_wake, num_requeue);
+}
+#include <zephyr/syscalls/k_futex_requeue_mrsh.c>
@@ -289,8 +289,11 @@ static inline bool arch_is_in_isr(void);
  * will be established. If the page tables already had mappings installed
  * for the virtual memory region, these will be overwritten.
  *
- * If the target architecture supports multiple page sizes, currently
- * only the smallest page size will be used.
+ * If the target architecture supports multiple page sizes, it may map
+ * parts of the region aligned both in virtual and physical address space
+ * on a larger page size with such larger pages, see arch_page_sizes_get().
+ * It must then be able to split them when a part of them is unmapped or
+ * remapped later on.
  *
  * The memory range itself is never accessed by this operation.
  *
@@ -315,6 +318,21 @@ static inline bool arch_is_in_isr(void);
  */
 void arch_mem_map(void *virt, uintptr_t phys, size_t size, uint32_t flags);
 
+/**
+ * Get the page sizes the MMU can map memory with
+ *
+ * Used by the kernel to align virtual memory regions on the largest page
+ * size their physical memory is aligned on and can hold, so that
+ * arch_mem_map() can map them with fewer, larger pages and use fewer TLB
+ * entries. Architectures not implementing this only use
+ * CONFIG_MMU_PAGE_SIZE pages.
+ *
+ * @return Bitmask of the supported page sizes, bit N being set if pages of
+ *         2^N bytes can be mapped. The bit for CONFIG_MMU_PAGE_SIZE is
+ *         always set.
+ */
+uintptr_t arch_page_sizes_get(void);
+
 /**
  * Remove mappings for a provided virtual address range
  *
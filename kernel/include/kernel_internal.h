@@ -304,6 +304,100 @@ void k_thread_abort_cleanup(struct k_thread *thread);
 void k_thread_abort_cleanup_check_reuse(struct k_thread *thread);
 #endif /* CONFIG_THREAD_ABORT_NEED_CLEANUP */
 
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+/**
+ * Lock a mutex whose uncontended state is kept in a lock word.
+ *
+ * Slow path of sys_mutex_lock(), taken when the word shows another owner or
+ * the caller does not know the mutex yet. Adopts the backing k_mutex on
+ * behalf of the owner and pends on it, or counts a recursive lock if the
+ * caller already owns the mutex.
+ *
+ * @param mutex Backing kernel mutex.
+ * @param word Lock word, in the caller's memory.
+ * @param count Recursion count, in the caller's memory.
+ * @param timeout Waiting period to lock the mutex.
+ * @return 0, -EBUSY, -EAGAIN or -EINVAL if the word does not name a thread.
+ */
+int z_mutex_word_lock(struct k_mutex *mutex, atomic_t *word, uint32_t *count,
+		      k_timeout_t timeout);
+
+/**
+ * Unlock a mutex whose uncontended state is kept in a lock word.
+ *
+ * Slow path of sys_mutex_unlock(), drops one recursive lock or hands the
+ * mutex over to the first waiter of the backing k_mutex, if any.
+ *
+ * @param mutex Backing kernel mutex.
+ * @param word Lock word, in the caller's memory.
+ * @param count Recursion count, in the caller's memory.
+ * @return 0, -EINVAL if the mutex is not locked, or -EPERM if it is locked
+ *	   by another thread.
+ */
+int z_mutex_word_unlock(struct k_mutex *mutex, atomic_t *word, uint32_t *count);
+#endif /* CONFIG_SYS_MUTEX_FAST_PATH */
+
+#ifdef CONFIG_DYNAMIC_THREAD_STACK_MAPPED_LAZY
+/**
+ * Tell whether an address is within a lazily mapped dynamic thread stack.
+ *
+ * Pages of those stacks are pinned as they get populated, so that a kernel
+ * thread never faults on a page of its stack that was evicted.
+ *
+ * @param addr Virtual address.
+ * @return true if @a addr is within a stack handed out by
+ *	   k_thread_stack_alloc().
+ */
+bool z_thread_stack_mapped_contains(void *addr);
+#endif /* CONFIG_DYNAMIC_THREAD_STACK_MAPPED_LAZY */
+
+#ifdef CONFIG_HEAP_PERCPU_CACHE
+/**
+ * Allocate a small block from the current CPU's cache of a heap.
+ *
+ * Refills the cache from the heap if it has no block of the right size
+ * class.
+ *
+ * @param heap Heap to allocate from.
+ * @param bytes Number of bytes requested.
+ * @return Block of at least @a bytes bytes, or NULL if @a bytes is not
+ *	   cached or neither the cache nor the heap has a block for it.
+ */
+void *z_heap_cache_alloc(struct k_heap *heap, size_t bytes);
+
+/**
+ * Give the blocks cached by all CPUs back to a heap.
+ *
+ * @param heap Heap whose caches to drain.
+ */
+void z_heap_cache_drain(struct k_heap *heap);
+
+static inline bool z_heap_has_cache(struct k_heap *heap)
+{
+	return heap->cache != NULL;
+}
+#else
+static inline bool z_heap_has_cache(struct k_heap *heap)
+{
+	ARG_UNUSED(heap);
+
+	return false;
+}
+
+static inline void *z_heap_cache_alloc(struct k_heap *heap, size_t bytes)
+{
+	ARG_UNUSED(heap);
+	ARG_UNUSED(bytes);
+
+	return NULL;
+}
+
+static inline void z_heap_cache_drain(struct k_heap *heap)
+{
+	ARG_UNUSED(heap);
+}
+#endif /* CONFIG_HEAP_PERCPU_CACHE */
+
 #ifdef __cplusplus
 }
 #endif
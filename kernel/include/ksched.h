@@ -60,6 +60,8 @@ void z_reschedule(struct k_spinlock *lock, k_spinlock_key_t key);
 void z_reschedule_irqlock(uint32_t key);
 void z_unpend_thread(struct k_thread *thread);
 int z_unpend_all(_wait_q_t *wait_q);
+unsigned int z_unpend_n(_wait_q_t *wait_q, unsigned int n, int swap_retval);
+unsigned int z_requeue_n(_wait_q_t *wait_q, _wait_q_t *target, unsigned int n);
 bool z_thread_prio_set(struct k_thread *thread, int prio);
 void *z_get_next_switch_handle(void *interrupted);
 
@@ -35,6 +35,13 @@
 #define _priq_run_remove	z_priq_mq_remove
 #define _priq_run_yield         z_priq_mq_yield
 #define _priq_run_best		z_priq_mq_best
+ /* Two-level Bitmap Queue Scheduling */
+#elif defined(CONFIG_SCHED_BITMAPQ)
+#define _priq_run_init		z_priq_bm_init
+#define _priq_run_add		z_priq_bm_add
+#define _priq_run_remove	z_priq_bm_remove
+#define _priq_run_yield         z_priq_bm_yield
+#define _priq_run_best		z_priq_bm_best
 #endif
 
 /* Scalable Wait Queue */
@@ -346,4 +353,89 @@ static ALWAYS_INLINE struct k_thread *z_priq_mq_best(struct _priq_mq *pq)
 	return NULL;
 }
 
+#ifdef CONFIG_SCHED_BITMAPQ
+/* l1 could index 32 words, the kernel supports at most 256 priorities */
+BUILD_ASSERT(K_NUM_THREAD_PRIO <= 256, "too many priorities for the bitmap ready queue");
+
+static ALWAYS_INLINE void z_priq_bm_init(struct _priq_bm *pq)
+{
+	pq->l1 = 0U;
+	for (size_t i = 0; i < ARRAY_SIZE(pq->l2); i++) {
+		pq->l2[i] = 0U;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(pq->queues); i++) {
+		sys_dlist_init(&pq->queues[i]);
+	}
+}
+
+/* Insert @a thread into the list of its priority, after all threads
+ * comparing equal or higher, i.e. in deadline order with ties in FIFO
+ * order.  Without SCHED_DEADLINE all threads in a list compare equal.
+ */
+static ALWAYS_INLINE void z_priq_bm_insert(sys_dlist_t *list, struct k_thread *thread)
+{
+#ifdef CONFIG_SCHED_DEADLINE
+	struct k_thread *t;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(list, t, base.qnode_dlist) {
+		if (z_sched_prio_cmp(thread, t) > 0) {
+			sys_dlist_insert(&t->base.qnode_dlist, &thread->base.qnode_dlist);
+			return;
+		}
+	}
+#endif /* CONFIG_SCHED_DEADLINE */
+
+	sys_dlist_append(list, &thread->base.qnode_dlist);
+}
+
+static ALWAYS_INLINE void z_priq_bm_add(struct _priq_bm *pq, struct k_thread *thread)
+{
+	unsigned int idx = thread->base.prio - K_HIGHEST_THREAD_PRIO;
+
+	z_priq_bm_insert(&pq->queues[idx], thread);
+	pq->l2[idx / 32U] |= BIT(idx % 32U);
+	pq->l1 |= BIT(idx / 32U);
+}
+
+static ALWAYS_INLINE void z_priq_bm_remove(struct _priq_bm *pq, struct k_thread *thread)
+{
+	unsigned int idx = thread->base.prio - K_HIGHEST_THREAD_PRIO;
+
+	sys_dlist_dequeue(&thread->base.qnode_dlist);
+	if (unlikely(sys_dlist_is_empty(&pq->queues[idx]))) {
+		pq->l2[idx / 32U] &= ~BIT(idx % 32U);
+		if (pq->l2[idx / 32U] == 0U) {
+			pq->l1 &= ~BIT(idx / 32U);
+		}
+	}
+}
+
+static ALWAYS_INLINE void z_priq_bm_yield(struct _priq_bm *pq)
+{
+#ifndef CONFIG_SMP
+	unsigned int idx = _current->base.prio - K_HIGHEST_THREAD_PRIO;
+
+	sys_dlist_dequeue(&_current->base.qnode_dlist);
+	z_priq_bm_insert(&pq->queues[idx], _current);
+#endif
+}
+
+static ALWAYS_INLINE struct k_thread *z_priq_bm_best(struct _priq_bm *pq)
+{
+	unsigned int word;
+	sys_dnode_t *n;
+
+	if (unlikely(pq->l1 == 0U)) {
+		return NULL;
+	}
+
+	word = u32_count_trailing_zeros(pq->l1);
+	n = sys_dlist_peek_head(&pq->queues[word * 32U +
+					    u32_count_trailing_zeros(pq->l2[word])]);
+
+	return CONTAINER_OF(n, struct k_thread, base.qnode_dlist);
+}
+#endif /* CONFIG_SCHED_BITMAPQ */
+
 #endif /* ZEPHYR_KERNEL_INCLUDE_PRIORITY_Q_H_ */
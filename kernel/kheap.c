@@ -8,9 +8,11 @@
 #include <zephyr/init.h>
 #include <zephyr/linker/linker-defs.h>
 #include <zephyr/sys/iterable_sections.h>
+#include <zephyr/sys/math_extras.h>
 /* private kernel APIs */
 #include <ksched.h>
 #include <wait_q.h>
+#include <kernel_internal.h>
 
 int k_heap_array_get(struct k_heap **heap)
 {
@@ -27,6 +29,9 @@ void k_heap_init(struct k_heap *heap, void *mem, size_t bytes)
 {
 	z_waitq_init(&heap->wait_q);
 	heap->lock = (struct k_spinlock) {};
+#ifdef CONFIG_HEAP_PERCPU_CACHE
+	heap->cache = NULL;
+#endif /* CONFIG_HEAP_PERCPU_CACHE */
 	sys_heap_init(&heap->heap, mem, bytes);
 
 	SYS_PORT_TRACING_OBJ_INIT(k_heap, heap);
@@ -59,7 +64,16 @@ static int statics_init(void)
 		if (do_clear)
 #endif /* CONFIG_DEMAND_PAGING && !CONFIG_LINKER_GENERIC_SECTIONS_PRESENT_AT_BOOT */
 		{
+#ifdef CONFIG_HEAP_PERCPU_CACHE
+			struct k_heap_cache *cache = heap->cache;
+#endif /* CONFIG_HEAP_PERCPU_CACHE */
+
 			k_heap_init(heap, heap->heap.init_mem, heap->heap.init_bytes);
+#ifdef CONFIG_HEAP_PERCPU_CACHE
+			if (cache != NULL) {
+				k_heap_cache_init(heap, cache);
+			}
+#endif /* CONFIG_HEAP_PERCPU_CACHE */
 		}
 	}
 	return 0;
@@ -74,6 +88,202 @@ SYS_INIT_NAMED(statics_init_pre, statics_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_
 SYS_INIT_NAMED(statics_init_post, statics_init, POST_KERNEL, 0);
 #endif /* CONFIG_DEMAND_PAGING && !CONFIG_LINKER_GENERIC_SECTIONS_PRESENT_AT_BOOT */
 
+#ifdef CONFIG_HEAP_PERCPU_CACHE
+/*
+ * Size class N holds blocks with at least 16 << N usable bytes. A CPU only
+ * touches its own cache, with interrupts locked, except when draining the
+ * caches after a failed allocation; the lock of each cache is thus almost
+ * never contended. Cache locks are taken before the heap lock.
+ *
+ * The size of a freed block is read from its chunk header without the heap
+ * lock: the heap only rewrites the size of a chunk when allocating,
+ * reallocating or freeing that very chunk, and the block is still owned by
+ * the caller. Merging it with its neighbors is left to a later batch.
+ *
+ * Frees bypass the caches while a thread waits for memory, so that it is
+ * woken up. The waiter count is read under the cache lock, and a waiter
+ * drains all caches after raising it: a block is either seen by the drain,
+ * or freed to the heap.
+ */
+#define CACHE_MIN_SHIFT 4U
+#define CACHE_MAX_SHIFT (CACHE_MIN_SHIFT + CONFIG_HEAP_PERCPU_CACHE_CLASSES - 1U)
+#define CACHE_BATCH     (CONFIG_HEAP_PERCPU_CACHE_DEPTH / 2)
+
+static int alloc_class(size_t bytes)
+{
+	if ((bytes == 0U) || (bytes > BIT(CACHE_MAX_SHIFT))) {
+		return -1;
+	}
+
+	if (bytes <= BIT(CACHE_MIN_SHIFT)) {
+		return 0;
+	}
+
+	return (int)(32U - u32_count_leading_zeros((uint32_t)bytes - 1U) - CACHE_MIN_SHIFT);
+}
+
+static int free_class(size_t usable)
+{
+	if ((usable < BIT(CACHE_MIN_SHIFT)) || (usable >= BIT(CACHE_MAX_SHIFT + 1U))) {
+		return -1;
+	}
+
+	return (int)(31U - u32_count_leading_zeros((uint32_t)usable) - CACHE_MIN_SHIFT);
+}
+
+void k_heap_cache_init(struct k_heap *heap, struct k_heap_cache *cache)
+{
+	(void)memset(cache, 0, sizeof(*cache));
+	heap->cache = cache;
+}
+
+void *z_heap_cache_alloc(struct k_heap *heap, size_t bytes)
+{
+	int cls = alloc_class(bytes);
+	struct z_heap_cpu_cache *cache;
+	k_spinlock_key_t heap_key;
+	k_spinlock_key_t key;
+	unsigned int irq;
+	void *mem = NULL;
+
+	if ((heap->cache == NULL) || (cls < 0)) {
+		return NULL;
+	}
+
+	irq = arch_irq_lock();
+	cache = &heap->cache->cpu[CPU_ID];
+	key = k_spin_lock(&cache->lock);
+
+	if (cache->count[cls] == 0U) {
+		heap_key = k_spin_lock(&heap->lock);
+		while (cache->count[cls] < CACHE_BATCH) {
+			mem = sys_heap_alloc(&heap->heap, BIT(CACHE_MIN_SHIFT + cls));
+			if (mem == NULL) {
+				break;
+			}
+			cache->blocks[cls][cache->count[cls]++] = mem;
+		}
+		k_spin_unlock(&heap->lock, heap_key);
+	}
+
+	mem = NULL;
+	if (cache->count[cls] != 0U) {
+		mem = cache->blocks[cls][--cache->count[cls]];
+	}
+
+	k_spin_unlock(&cache->lock, key);
+	arch_irq_unlock(irq);
+
+	return mem;
+}
+
+static bool cache_free(struct k_heap *heap, void *mem)
+{
+	struct z_heap_cpu_cache *cache;
+	k_spinlock_key_t heap_key;
+	k_spinlock_key_t key;
+	bool resched = false;
+	unsigned int irq;
+	void **blocks;
+	int cls;
+
+	if ((heap->cache == NULL) || (mem == NULL)) {
+		return false;
+	}
+
+	cls = free_class(sys_heap_usable_size(&heap->heap, mem));
+	if (cls < 0) {
+		return false;
+	}
+
+	irq = arch_irq_lock();
+	cache = &heap->cache->cpu[CPU_ID];
+	key = k_spin_lock(&cache->lock);
+
+	if (atomic_get(&heap->cache->waiters) != 0) {
+		k_spin_unlock(&cache->lock, key);
+		arch_irq_unlock(irq);
+		return false;
+	}
+
+	blocks = cache->blocks[cls];
+	if (cache->count[cls] == CONFIG_HEAP_PERCPU_CACHE_DEPTH) {
+		/* Give the oldest, coldest half back to the heap */
+		heap_key = k_spin_lock(&heap->lock);
+		for (unsigned int i = 0; i < CACHE_BATCH; i++) {
+			sys_heap_free(&heap->heap, blocks[i]);
+		}
+		resched = (z_unpend_all(&heap->wait_q) != 0);
+		k_spin_unlock(&heap->lock, heap_key);
+
+		cache->count[cls] -= CACHE_BATCH;
+		(void)memmove(blocks, &blocks[CACHE_BATCH], cache->count[cls] * sizeof(void *));
+	}
+
+	blocks[cache->count[cls]++] = mem;
+
+	k_spin_unlock(&cache->lock, key);
+	arch_irq_unlock(irq);
+
+	if (resched) {
+		z_reschedule_unlocked();
+	}
+
+	return true;
+}
+
+void z_heap_cache_drain(struct k_heap *heap)
+{
+	struct z_heap_cpu_cache *cache;
+	k_spinlock_key_t heap_key;
+	k_spinlock_key_t key;
+
+	if (heap->cache == NULL) {
+		return;
+	}
+
+	for (unsigned int cpu = 0; cpu < arch_num_cpus(); cpu++) {
+		cache = &heap->cache->cpu[cpu];
+		key = k_spin_lock(&cache->lock);
+		heap_key = k_spin_lock(&heap->lock);
+
+		for (unsigned int cls = 0; cls < CONFIG_HEAP_PERCPU_CACHE_CLASSES; cls++) {
+			for (unsigned int i = 0; i < cache->count[cls]; i++) {
+				sys_heap_free(&heap->heap, cache->blocks[cls][i]);
+			}
+			cache->count[cls] = 0U;
+		}
+
+		k_spin_unlock(&heap->lock, heap_key);
+		k_spin_unlock(&cache->lock, key);
+	}
+}
+
+static inline void heap_waiters_inc(struct k_heap *heap)
+{
+	if (heap->cache != NULL) {
+		(void)atomic_inc(&heap->cache->waiters);
+	}
+}
+
+static inline void heap_waiters_dec(struct k_heap *heap)
+{
+	if (heap->cache != NULL) {
+		(void)atomic_dec(&heap->cache->waiters);
+	}
+}
+#else
+static inline void heap_waiters_inc(struct k_heap *heap)
+{
+	ARG_UNUSED(heap);
+}
+
+static inline void heap_waiters_dec(struct k_heap *heap)
+{
+	ARG_UNUSED(heap);
+}
+#endif /* CONFIG_HEAP_PERCPU_CACHE */
+
 typedef void * (sys_heap_allocator_t)(struct sys_heap *heap, size_t align, size_t bytes);
 
 static void *z_heap_alloc_helper(struct k_heap *heap, size_t align, size_t bytes,
@@ -88,10 +298,23 @@ static void *z_heap_alloc_helper(struct k_heap *heap, size_t align, size_t bytes
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
 
 	bool blocked_alloc = false;
+	bool drained = false;
 
 	while (ret == NULL) {
 		ret = sys_heap_allocator(&heap->heap, align, bytes);
 
+		if ((ret == NULL) && !drained && z_heap_has_cache(heap)) {
+			/* Reclaim the blocks cached by all CPUs and retry */
+			drained = true;
+			if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+				heap_waiters_inc(heap);
+			}
+			k_spin_unlock(&heap->lock, key);
+			z_heap_cache_drain(heap);
+			key = k_spin_lock(&heap->lock);
+			continue;
+		}
+
 		if (!IS_ENABLED(CONFIG_MULTITHREADING) ||
 		    (ret != NULL) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 			break;
@@ -112,6 +335,10 @@ static void *z_heap_alloc_helper(struct k_heap *heap, size_t align, size_t bytes
 		key = k_spin_lock(&heap->lock);
 	}
 
+	if (drained && !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		heap_waiters_dec(heap);
+	}
+
 	k_spin_unlock(&heap->lock, key);
 	return ret;
 }
@@ -120,8 +347,11 @@ void *k_heap_alloc(struct k_heap *heap, size_t bytes, k_timeout_t timeout)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap, alloc, heap, timeout);
 
-	void *ret = z_heap_alloc_helper(heap, 0, bytes, timeout,
-					sys_heap_noalign_alloc);
+	void *ret = z_heap_cache_alloc(heap, bytes);
+
+	if (ret == NULL) {
+		ret = z_heap_alloc_helper(heap, 0, bytes, timeout, sys_heap_noalign_alloc);
+	}
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, alloc, heap, timeout, ret);
 
@@ -201,6 +431,13 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 
 void k_heap_free(struct k_heap *heap, void *mem)
 {
+#ifdef CONFIG_HEAP_PERCPU_CACHE
+	if (cache_free(heap, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC(k_heap, free, heap);
+		return;
+	}
+#endif /* CONFIG_HEAP_PERCPU_CACHE */
+
 	k_spinlock_key_t key = k_spin_lock(&heap->lock);
 
 	sys_heap_free(&heap->heap, mem);
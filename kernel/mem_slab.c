@@ -33,6 +33,7 @@ static int k_mem_slab_stats_raw(struct k_obj_core *obj_core, void *stats)
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
 	key = k_spin_lock(&slab->lock);
 	memcpy(stats, &slab->info, sizeof(slab->info));
+	((struct k_mem_slab_info *)stats)->num_used -= z_mem_slab_num_cached(slab);
 	k_spin_unlock(&slab->lock, key);
 
 	return 0;
@@ -45,12 +46,14 @@ static int k_mem_slab_stats_query(struct k_obj_core *obj_core, void *stats)
 	struct k_mem_slab *slab;
 	k_spinlock_key_t   key;
 	struct sys_memory_stats *ptr = stats;
+	uint32_t num_used;
 
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
 	key = k_spin_lock(&slab->lock);
-	ptr->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
+	num_used = k_mem_slab_num_used_get(slab);
+	ptr->free_bytes = (slab->info.num_blocks - num_used) *
 			  slab->info.block_size;
-	ptr->allocated_bytes = slab->info.num_used * slab->info.block_size;
+	ptr->allocated_bytes = num_used * slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	ptr->max_allocated_bytes = slab->info.max_used * slab->info.block_size;
 #else
@@ -72,7 +75,7 @@ static int k_mem_slab_stats_reset(struct k_obj_core *obj_core)
 	key = k_spin_lock(&slab->lock);
 
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
-	slab->info.max_used = slab->info.num_used;
+	slab->info.max_used = k_mem_slab_num_used_get(slab);
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
 
 	k_spin_unlock(&slab->lock, key);
@@ -179,6 +182,10 @@ int k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 	slab->buffer = buffer;
 	slab->info.num_used = 0U;
 	slab->lock = (struct k_spinlock) {};
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	slab->waiters = ATOMIC_INIT(0);
+	(void)memset(slab->cache, 0, sizeof(slab->cache));
+#endif /* CONFIG_MEM_SLAB_PERCPU_CACHE */
 
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	slab->info.max_used = 0U;
@@ -219,11 +226,276 @@ static bool slab_ptr_is_good(struct k_mem_slab *slab, const void *ptr)
 	       ((offset % slab->info.block_size) == 0);
 }
 
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+/*
+ * Raise the maximum utilization to the number of blocks allocated, leaving
+ * out the blocks cached by the CPUs. Called with the slab lock held.
+ */
+static void slab_max_used_update(struct k_mem_slab *slab)
+{
+	uint32_t cached = z_mem_slab_num_cached(slab);
+
+	/* The counts of the other caches are read without their lock */
+	if (cached <= slab->info.num_used) {
+		slab->info.max_used = MAX(slab->info.num_used - cached,
+					  slab->info.max_used);
+	}
+}
+#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+/*
+ * Each CPU keeps a list of free blocks, linked through their first word like
+ * the free list of the slab, with up to CONFIG_MEM_SLAB_PERCPU_CACHE_DEPTH
+ * blocks. A CPU only touches its own cache, with interrupts locked, except
+ * when draining the caches before an allocation fails or pends; the lock
+ * of each cache is thus almost never contended. Cache locks are taken
+ * before the slab lock.
+ *
+ * Blocks in the caches are off the free list of the slab, so they are
+ * counted in info.num_used; the accessors subtract them.
+ *
+ * Frees bypass the caches while a thread waits for a block, so that it is
+ * woken up. The waiter count is read under the cache lock, and a waiter
+ * drains all caches after raising it: a block is either seen by the drain,
+ * or freed to the slab.
+ */
+#define CACHE_BATCH (CONFIG_MEM_SLAB_PERCPU_CACHE_DEPTH / 2)
+
+/*
+ * Give the @a count blocks of the list starting at @a head to the slab,
+ * handing them to pending threads first. Returns true if one was readied.
+ */
+static bool cache_list_free(struct k_mem_slab *slab, char *head, uint32_t count)
+{
+	struct k_thread *pending_thread;
+	k_spinlock_key_t slab_key;
+	bool resched = false;
+	char *tail;
+
+	slab_key = k_spin_lock(&slab->lock);
+
+	while (count != 0U) {
+		pending_thread = z_unpend_first_thread(&slab->wait_q);
+		if (pending_thread == NULL) {
+			break;
+		}
+
+		/* The block stays in use, by the thread */
+		z_thread_return_value_set_with_data(pending_thread, 0, head);
+		z_ready_thread(pending_thread);
+		resched = true;
+		head = *(char **)head;
+		count--;
+	}
+
+	if (count != 0U) {
+		tail = head;
+		for (uint32_t i = 1; i < count; i++) {
+			tail = *(char **)tail;
+		}
+		*(char **)tail = slab->free_list;
+		slab->free_list = head;
+		slab->info.num_used -= count;
+	}
+
+	k_spin_unlock(&slab->lock, slab_key);
+
+	return resched;
+}
+
+static void *cache_alloc(struct k_mem_slab *slab)
+{
+	struct z_mem_slab_cpu_cache *cache;
+	k_spinlock_key_t slab_key;
+	k_spinlock_key_t key;
+	unsigned int irq;
+	char *mem = NULL;
+	char *tail;
+	uint32_t count;
+
+	irq = arch_irq_lock();
+	cache = &slab->cache[CPU_ID];
+	key = k_spin_lock(&cache->lock);
+
+	if (cache->count == 0U) {
+		/* Take a batch of blocks off the head of the free list */
+		slab_key = k_spin_lock(&slab->lock);
+		if (slab->free_list != NULL) {
+			tail = slab->free_list;
+			for (count = 1U; count < CACHE_BATCH; count++) {
+				if (*(char **)tail == NULL) {
+					break;
+				}
+				tail = *(char **)tail;
+			}
+
+			cache->free_list = slab->free_list;
+			cache->count = count;
+			slab->free_list = *(char **)tail;
+			*(char **)tail = NULL;
+			slab->info.num_used += count;
+			__ASSERT((slab->free_list == NULL &&
+				  slab->info.num_used == slab->info.num_blocks) ||
+				 slab_ptr_is_good(slab, slab->free_list),
+				 "slab corruption detected");
+		}
+		k_spin_unlock(&slab->lock, slab_key);
+	}
+
+	if (cache->count != 0U) {
+		mem = cache->free_list;
+		cache->free_list = *(char **)mem;
+		cache->count--;
+
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+		/* Only blocks handed out count, the lock is taken when the
+		 * maximum may be raised.
+		 */
+		if (k_mem_slab_num_used_get(slab) > slab->info.max_used) {
+			slab_key = k_spin_lock(&slab->lock);
+			slab_max_used_update(slab);
+			k_spin_unlock(&slab->lock, slab_key);
+		}
+#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+	}
+
+	k_spin_unlock(&cache->lock, key);
+	arch_irq_unlock(irq);
+
+	return mem;
+}
+
+static bool cache_free(struct k_mem_slab *slab, void *mem)
+{
+	struct z_mem_slab_cpu_cache *cache;
+	k_spinlock_key_t key;
+	unsigned int irq;
+	char *keep;
+
+	irq = arch_irq_lock();
+	cache = &slab->cache[CPU_ID];
+	key = k_spin_lock(&cache->lock);
+
+	if (atomic_get(&slab->waiters) != 0) {
+		k_spin_unlock(&cache->lock, key);
+		arch_irq_unlock(irq);
+		return false;
+	}
+
+	if (cache->count == CONFIG_MEM_SLAB_PERCPU_CACHE_DEPTH) {
+		/* Keep the most recently freed blocks, give the rest back */
+		keep = cache->free_list;
+		for (uint32_t i = 1; i < (cache->count - CACHE_BATCH); i++) {
+			keep = *(char **)keep;
+		}
+		/* No thread waits, or the waiter count would be raised */
+		(void)cache_list_free(slab, *(char **)keep, CACHE_BATCH);
+		*(char **)keep = NULL;
+		cache->count -= CACHE_BATCH;
+	}
+
+	*(char **)mem = cache->free_list;
+	cache->free_list = mem;
+	cache->count++;
+
+	k_spin_unlock(&cache->lock, key);
+	arch_irq_unlock(irq);
+
+	return true;
+}
+
+static void cache_drain(struct k_mem_slab *slab)
+{
+	struct z_mem_slab_cpu_cache *cache;
+	bool resched = false;
+	k_spinlock_key_t key;
+
+	for (unsigned int cpu = 0; cpu < arch_num_cpus(); cpu++) {
+		cache = &slab->cache[cpu];
+		key = k_spin_lock(&cache->lock);
+
+		if (cache->count != 0U) {
+			/* Threads pended by earlier failed allocations come
+			 * first
+			 */
+			resched |= cache_list_free(slab, cache->free_list, cache->count);
+			cache->free_list = NULL;
+			cache->count = 0U;
+		}
+
+		k_spin_unlock(&cache->lock, key);
+	}
+
+	if (resched) {
+		z_reschedule_unlocked();
+	}
+}
+
+static inline void slab_waiters_inc(struct k_mem_slab *slab)
+{
+	(void)atomic_inc(&slab->waiters);
+}
+
+static inline void slab_waiters_dec(struct k_mem_slab *slab)
+{
+	(void)atomic_dec(&slab->waiters);
+}
+#else
+static inline void *cache_alloc(struct k_mem_slab *slab)
+{
+	ARG_UNUSED(slab);
+
+	return NULL;
+}
+
+static inline bool cache_free(struct k_mem_slab *slab, void *mem)
+{
+	ARG_UNUSED(slab);
+	ARG_UNUSED(mem);
+
+	return false;
+}
+
+static inline void cache_drain(struct k_mem_slab *slab)
+{
+	ARG_UNUSED(slab);
+}
+
+static inline void slab_waiters_inc(struct k_mem_slab *slab)
+{
+	ARG_UNUSED(slab);
+}
+
+static inline void slab_waiters_dec(struct k_mem_slab *slab)
+{
+	ARG_UNUSED(slab);
+}
+#endif /* CONFIG_MEM_SLAB_PERCPU_CACHE */
+
 int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 {
-	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	k_spinlock_key_t key;
 	int result;
 
+	*mem = cache_alloc(slab);
+	if (*mem != NULL) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, 0);
+
+		return 0;
+	}
+
+	if (IS_ENABLED(CONFIG_MEM_SLAB_PERCPU_CACHE)) {
+		/* Reclaim the blocks cached by all CPUs before failing or pending */
+		if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			slab_waiters_inc(slab);
+		}
+		cache_drain(slab);
+	}
+
+	key = k_spin_lock(&slab->lock);
+
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
 
 	if (slab->free_list != NULL) {
@@ -237,8 +509,7 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 			 "slab corruption detected");
 
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
-		slab->info.max_used = MAX(slab->info.num_used,
-					  slab->info.max_used);
+		slab_max_used_update(slab);
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
 
 		result = 0;
@@ -256,6 +527,10 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 			*mem = _current->base.swap_data;
 		}
 
+		if (IS_ENABLED(CONFIG_MEM_SLAB_PERCPU_CACHE)) {
+			slab_waiters_dec(slab);
+		}
+
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
 
 		return result;
@@ -263,6 +538,10 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
 
+	if (IS_ENABLED(CONFIG_MEM_SLAB_PERCPU_CACHE) && !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		slab_waiters_dec(slab);
+	}
+
 	k_spin_unlock(&slab->lock, key);
 
 	return result;
@@ -276,6 +555,13 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
 		return;
 	}
 
+	if (cache_free(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+
+		return;
+	}
+
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
@@ -307,9 +593,10 @@ int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stat
 	}
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	uint32_t num_used = k_mem_slab_num_used_get(slab);
 
-	stats->allocated_bytes = slab->info.num_used * slab->info.block_size;
-	stats->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
+	stats->allocated_bytes = num_used * slab->info.block_size;
+	stats->free_bytes = (slab->info.num_blocks - num_used) *
 			    slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	stats->max_allocated_bytes = slab->info.max_used *
@@ -332,7 +619,7 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab)
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
-	slab->info.max_used = slab->info.num_used;
+	slab->info.max_used = k_mem_slab_num_used_get(slab);
 
 	k_spin_unlock(&slab->lock, key);
 
@@ -8,6 +8,7 @@
 #include <string.h>
 #include <zephyr/sys/math_extras.h>
 #include <zephyr/sys/util.h>
+#include <kernel_internal.h>
 
 typedef void * (sys_heap_allocator_t)(struct sys_heap *heap, size_t align, size_t bytes);
 
@@ -38,9 +39,20 @@ static void *z_alloc_helper(struct k_heap *heap, size_t align, size_t size,
 	 * No point calling k_heap_malloc/k_heap_aligned_alloc with K_NO_WAIT.
 	 * Better bypass them and go directly to sys_heap_*() instead.
 	 */
-	key = k_spin_lock(&heap->lock);
-	mem = sys_heap_allocator(&heap->heap, __align, size);
-	k_spin_unlock(&heap->lock, key);
+	mem = (align == 0) ? z_heap_cache_alloc(heap, size) : NULL;
+	if (mem == NULL) {
+		key = k_spin_lock(&heap->lock);
+		mem = sys_heap_allocator(&heap->heap, __align, size);
+		k_spin_unlock(&heap->lock, key);
+	}
+
+	if ((mem == NULL) && z_heap_has_cache(heap)) {
+		/* Reclaim the blocks cached by all CPUs and retry */
+		z_heap_cache_drain(heap);
+		key = k_spin_lock(&heap->lock);
+		mem = sys_heap_allocator(&heap->heap, __align, size);
+		k_spin_unlock(&heap->lock, key);
+	}
 
 	if (mem == NULL) {
 		return NULL;
@@ -74,7 +86,11 @@ void k_free(void *ptr)
 
 #if (K_HEAP_MEM_POOL_SIZE > 0)
 
+#ifdef CONFIG_HEAP_MEM_POOL_PERCPU_CACHE
+K_HEAP_DEFINE_CACHED(_system_heap, K_HEAP_MEM_POOL_SIZE);
+#else
 K_HEAP_DEFINE(_system_heap, K_HEAP_MEM_POOL_SIZE);
+#endif /* CONFIG_HEAP_MEM_POOL_PERCPU_CACHE */
 #define _SYSTEM_HEAP (&_system_heap)
 
 void *k_aligned_alloc(size_t align, size_t size)
@@ -867,7 +867,17 @@ size_t k_mem_free_get(void)
 	return ret * (size_t)CONFIG_MMU_PAGE_SIZE;
 }
 
-/* Get the default virtual region alignment, here the default MMU page size
+/* Get the default page sizes, only the MMU page size */
+static uintptr_t page_sizes_get(void)
+{
+	return CONFIG_MMU_PAGE_SIZE;
+}
+
+__weak FUNC_ALIAS(page_sizes_get, arch_page_sizes_get, uintptr_t);
+
+/* Get the default virtual region alignment, here the largest page size the
+ * region is aligned on and can hold, so that it can be mapped with the
+ * largest pages. Unaligned regions get MMU_PAGE_SIZE and small pages.
  *
  * @param[in] phys Physical address of region to be mapped, aligned to MMU_PAGE_SIZE
  * @param[in] size Size of region to be mapped, aligned to MMU_PAGE_SIZE
@@ -876,10 +886,20 @@ size_t k_mem_free_get(void)
  */
 static size_t virt_region_align(uintptr_t phys, size_t size)
 {
-	ARG_UNUSED(phys);
-	ARG_UNUSED(size);
+	uintptr_t sizes = arch_page_sizes_get();
+	size_t alignment = CONFIG_MMU_PAGE_SIZE;
 
-	return CONFIG_MMU_PAGE_SIZE;
+	while (sizes != 0U) {
+		size_t page_size = (size_t)1 << u64_count_trailing_zeros(sizes);
+
+		if ((page_size > size) || ((phys & (page_size - 1)) != 0U)) {
+			break;
+		}
+		alignment = MAX(alignment, page_size);
+		sizes &= ~(uintptr_t)page_size;
+	}
+
+	return alignment;
 }
 
 __weak FUNC_ALIAS(virt_region_align, arch_virt_region_align, size_t);
@@ -1610,7 +1630,82 @@ static inline struct k_mem_page_frame *do_eviction_select(bool *dirty)
 	return pf;
 }
 
-static bool do_page_fault(void *addr, bool pin)
+#ifdef CONFIG_DEMAND_PAGING_REFAULT_TRACKING
+/*
+ * Shadows of the most recently evicted data pages, hashed by virtual
+ * address, with the number of evictions that preceded theirs. A page
+ * fault on a shadowed data page is a refault, and the difference with
+ * the current number of evictions is its refault distance.
+ */
+struct paging_shadow {
+	uintptr_t addr;
+	uint32_t evictions;
+};
+
+static struct paging_shadow paging_shadows[CONFIG_DEMAND_PAGING_REFAULT_SHADOWS];
+static uint32_t paging_evictions;
+
+static inline struct paging_shadow *paging_shadow_get(void *addr)
+{
+	uintptr_t page = POINTER_TO_UINT(addr) / CONFIG_MMU_PAGE_SIZE;
+
+	return &paging_shadows[page % ARRAY_SIZE(paging_shadows)];
+}
+
+static void paging_shadow_store(struct k_mem_page_frame *pf)
+{
+	void *addr = k_mem_page_frame_to_virt(pf);
+	struct paging_shadow *shadow = paging_shadow_get(addr);
+
+	shadow->addr = POINTER_TO_UINT(addr);
+	shadow->evictions = paging_evictions;
+	paging_evictions++;
+}
+
+static inline void paging_stats_refault_inc(struct k_thread *faulting_thread,
+					    uint32_t distance)
+{
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	int bin = (distance < 2U) ? 0 : LOG2(distance);
+
+	bin = MIN(bin, K_MEM_PAGING_REFAULT_DISTANCE_BINS - 1);
+
+	paging_stats.workingset.refaults++;
+	paging_stats.workingset.distance[bin]++;
+
+#ifdef CONFIG_DEMAND_PAGING_THREAD_STATS
+	faulting_thread->paging_stats.workingset.refaults++;
+	faulting_thread->paging_stats.workingset.distance[bin]++;
+#else
+	ARG_UNUSED(faulting_thread);
+#endif /* CONFIG_DEMAND_PAGING_THREAD_STATS */
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+}
+
+static void paging_refault_check(struct k_thread *faulting_thread,
+				 struct k_mem_page_frame *pf, void *addr,
+				 bool prefetch)
+{
+	struct paging_shadow *shadow = paging_shadow_get(addr);
+	uint32_t distance;
+
+	if (shadow->addr != POINTER_TO_UINT(addr)) {
+		return;
+	}
+	shadow->addr = 0;
+
+	/* Pages read ahead were not asked for, so they did not refault */
+	if (prefetch) {
+		return;
+	}
+
+	distance = paging_evictions - shadow->evictions - 1U;
+	paging_stats_refault_inc(faulting_thread, distance);
+	k_mem_paging_eviction_refault(pf, distance);
+}
+#endif /* CONFIG_DEMAND_PAGING_REFAULT_TRACKING */
+
+static bool do_page_fault(void *addr, bool pin, bool prefetch)
 {
 	struct k_mem_page_frame *pf;
 	k_spinlock_key_t key;
@@ -1708,7 +1803,26 @@ static bool do_page_fault(void *addr, bool pin)
 	__ASSERT(status == ARCH_PAGE_LOCATION_PAGED_OUT,
 		 "unexpected status value %d", status);
 
-	paging_stats_faults_inc(faulting_thread, key.key);
+#ifdef CONFIG_DEMAND_MAPPING
+	if (prefetch && ((page_in_location == ARCH_UNPAGED_ANON_ZERO) ||
+			 (page_in_location == ARCH_UNPAGED_ANON_UNINIT))) {
+		/*
+		 * Never touched anonymous memory: there is nothing to read
+		 * ahead, and mapping it would only take a page frame the
+		 * owner may never use.
+		 */
+		result = false;
+		goto out;
+	}
+#endif /* CONFIG_DEMAND_MAPPING */
+
+	if (prefetch) {
+#if defined(CONFIG_DEMAND_PAGING_STATS) && (CONFIG_DEMAND_PAGING_PREFETCH_PAGES > 0)
+		paging_stats.pagefaults.prefetched++;
+#endif
+	} else {
+		paging_stats_faults_inc(faulting_thread, key.key);
+	}
 
 	pf = free_page_frame_list_get();
 	if (pf == NULL) {
@@ -1720,6 +1834,9 @@ static bool do_page_fault(void *addr, bool pin)
 			k_mem_page_frame_to_phys(pf));
 
 		paging_stats_eviction_inc(faulting_thread, dirty);
+#ifdef CONFIG_DEMAND_PAGING_REFAULT_TRACKING
+		paging_shadow_store(pf);
+#endif /* CONFIG_DEMAND_PAGING_REFAULT_TRACKING */
 	}
 	ret = page_frame_prepare_locked(pf, &dirty, true, &page_out_location);
 	__ASSERT(ret == 0, "failed to prepare page frame");
@@ -1751,6 +1868,9 @@ static bool do_page_fault(void *addr, bool pin)
 	if (IS_ENABLED(CONFIG_EVICTION_TRACKING) && (!pin)) {
 		k_mem_paging_eviction_add(pf);
 	}
+#ifdef CONFIG_DEMAND_PAGING_REFAULT_TRACKING
+	paging_refault_check(faulting_thread, pf, addr, prefetch);
+#endif /* CONFIG_DEMAND_PAGING_REFAULT_TRACKING */
 out:
 	k_spin_unlock(&z_mm_lock, key);
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
@@ -1768,7 +1888,7 @@ static void do_page_in(void *addr)
 {
 	bool ret;
 
-	ret = do_page_fault(addr, false);
+	ret = do_page_fault(addr, false, false);
 	__ASSERT(ret, "unmapped memory address %p", addr);
 	(void)ret;
 }
@@ -1785,7 +1905,7 @@ static void do_mem_pin(void *addr)
 {
 	bool ret;
 
-	ret = do_page_fault(addr, true);
+	ret = do_page_fault(addr, true, false);
 	__ASSERT(ret, "unmapped memory address %p", addr);
 	(void)ret;
 }
@@ -1798,9 +1918,54 @@ void k_mem_pin(void *addr, size_t size)
 	virt_region_foreach(addr, size, do_mem_pin);
 }
 
+#if CONFIG_DEMAND_PAGING_PREFETCH_PAGES > 0
+/*
+ * Last data page paged in for a page fault, to spot sequential accesses.
+ * This is only a hint, updated without holding any lock.
+ */
+static uintptr_t paging_last_fault;
+
+static void paging_prefetch(uintptr_t page)
+{
+	uintptr_t last = page;
+
+	/* Stops at the first page that is not in the backing store */
+	for (int i = 1; i <= CONFIG_DEMAND_PAGING_PREFETCH_PAGES; i++) {
+		uintptr_t next = page + (i * CONFIG_MMU_PAGE_SIZE);
+
+		if ((next < page) || !do_page_fault(UINT_TO_POINTER(next), false, true)) {
+			break;
+		}
+		last = next;
+	}
+
+	/* So that a fault on the page after the last one read is sequential */
+	paging_last_fault = last;
+}
+#endif /* CONFIG_DEMAND_PAGING_PREFETCH_PAGES > 0 */
+
 bool k_mem_page_fault(void *addr)
 {
-	return do_page_fault(addr, false);
+#if CONFIG_DEMAND_PAGING_PREFETCH_PAGES > 0
+	uintptr_t page = ROUND_DOWN(POINTER_TO_UINT(addr), CONFIG_MMU_PAGE_SIZE);
+
+	if (page == (paging_last_fault + CONFIG_MMU_PAGE_SIZE)) {
+		/*
+		 * Read the following data pages first, so that paging them
+		 * in can never evict the one faulted on.
+		 */
+		paging_prefetch(page);
+	} else {
+		paging_last_fault = page;
+	}
+#endif /* CONFIG_DEMAND_PAGING_PREFETCH_PAGES > 0 */
+
+#ifdef CONFIG_DYNAMIC_THREAD_STACK_MAPPED_LAZY
+	/* Populated kernel stack pages are never evicted */
+	return do_page_fault(addr, z_thread_stack_mapped_contains(addr), false);
+#else
+	return do_page_fault(addr, false, false);
+#endif /* CONFIG_DYNAMIC_THREAD_STACK_MAPPED_LAZY */
 }
 
 static void do_mem_unpin(void *addr)
@@ -40,6 +40,136 @@ static inline bool handle_poll_events(struct k_msgq *msgq)
 #endif /* CONFIG_POLL */
 }
 
+static inline void advance(struct k_msgq *msgq, char **ptr)
+{
+	*ptr += msgq->msg_size;
+	if (*ptr == msgq->buffer_end) {
+		*ptr = msgq->buffer_start;
+	}
+}
+
+/* Address of the slot @a n slots after @a ptr, @a n being at most max_msgs */
+static char *slot_at(struct k_msgq *msgq, char *ptr, uint32_t n)
+{
+	size_t offset = (ptr - msgq->buffer_start) + (size_t)n * msgq->msg_size;
+	size_t size = msgq->buffer_end - msgq->buffer_start;
+
+	if (offset >= size) {
+		offset -= size;
+	}
+
+	return msgq->buffer_start + offset;
+}
+
+/* Describes what a thread pended on the wait queue is waiting for, its
+ * swap_data points to one of these. As the queue may be neither full nor
+ * empty while a slot is reserved or a message claimed, readers and writers
+ * can be pended at the same time.
+ */
+struct msgq_waiter {
+	enum {
+		MSGQ_WAIT_PUT,
+		MSGQ_WAIT_GET,
+		MSGQ_WAIT_RESERVE,
+		MSGQ_WAIT_CLAIM,
+	} op;
+	/* message to copy in or out, or slot granted to the waiter */
+	void *data;
+};
+
+/* A message can be written at the write pointer. Slots of messages
+ * dropped by a purge behind a claimed message are still in use.
+ */
+static inline bool can_write(struct k_msgq *msgq)
+{
+	return ((msgq->flags & K_MSGQ_FLAG_RESERVED) == 0U) &&
+	       ((msgq->used_msgs + msgq->purged_msgs) < msgq->max_msgs);
+}
+
+/* A message can be read at the read pointer */
+static inline bool can_read(struct k_msgq *msgq)
+{
+	return ((msgq->flags & K_MSGQ_FLAG_CLAIMED) == 0U) && (msgq->used_msgs > 0U);
+}
+
+static void write_msg(struct k_msgq *msgq, const void *data)
+{
+	__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
+			msgq->write_ptr < msgq->buffer_end);
+	(void)memcpy(msgq->write_ptr, data, msgq->msg_size);
+	advance(msgq, &msgq->write_ptr);
+	msgq->used_msgs++;
+}
+
+static void read_msg(struct k_msgq *msgq, void *data)
+{
+	(void)memcpy(data, msgq->read_ptr, msgq->msg_size);
+	advance(msgq, &msgq->read_ptr);
+	msgq->used_msgs--;
+}
+
+static struct k_thread *first_runnable_waiter(struct k_msgq *msgq)
+{
+	struct k_thread *thread;
+	struct msgq_waiter *waiter;
+
+	_WAIT_Q_FOR_EACH(&msgq->wait_q, thread) {
+		waiter = thread->base.swap_data;
+
+		if (((waiter->op == MSGQ_WAIT_PUT) || (waiter->op == MSGQ_WAIT_RESERVE)) ?
+		    can_write(msgq) : can_read(msgq)) {
+			return thread;
+		}
+	}
+
+	return NULL;
+}
+
+/* Complete the operations of the pended threads that can now proceed, in
+ * wait queue order, then signal pollers if a message is left to read.
+ * Must be called with the lock held after any change making a message or
+ * a slot available. Returns true if a thread was readied.
+ */
+static bool wake_waiters(struct k_msgq *msgq)
+{
+	struct k_thread *thread;
+	struct msgq_waiter *waiter;
+	bool resched = false;
+
+	for (thread = first_runnable_waiter(msgq); thread != NULL;
+	     thread = first_runnable_waiter(msgq)) {
+		waiter = thread->base.swap_data;
+
+		switch (waiter->op) {
+		case MSGQ_WAIT_PUT:
+			write_msg(msgq, waiter->data);
+			break;
+		case MSGQ_WAIT_GET:
+			read_msg(msgq, waiter->data);
+			break;
+		case MSGQ_WAIT_RESERVE:
+			msgq->flags |= K_MSGQ_FLAG_RESERVED;
+			waiter->data = msgq->write_ptr;
+			break;
+		case MSGQ_WAIT_CLAIM:
+			msgq->flags |= K_MSGQ_FLAG_CLAIMED;
+			waiter->data = msgq->read_ptr;
+			break;
+		}
+
+		z_unpend_thread(thread);
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+		resched = true;
+	}
+
+	if (can_read(msgq) && handle_poll_events(msgq)) {
+		resched = true;
+	}
+
+	return resched;
+}
+
 void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 		 uint32_t max_msgs)
 {
@@ -50,6 +180,7 @@ void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 	msgq->read_ptr = buffer;
 	msgq->write_ptr = buffer;
 	msgq->used_msgs = 0;
+	msgq->purged_msgs = 0;
 	msgq->flags = 0;
 	z_waitq_init(&msgq->wait_q);
 	msgq->lock = (struct k_spinlock) {};
@@ -129,7 +260,9 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 {
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
 
+	struct msgq_waiter waiter = { .op = MSGQ_WAIT_PUT, .data = (void *)data };
 	struct k_thread *pending_thread;
+	struct msgq_waiter *reader;
 	k_spinlock_key_t key;
 	int result;
 	bool resched = false;
@@ -138,28 +271,24 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put, msgq, timeout);
 
-	if (msgq->used_msgs < msgq->max_msgs) {
-		/* message queue isn't full */
-		pending_thread = z_unpend_first_thread(&msgq->wait_q);
-		if (unlikely(pending_thread != NULL)) {
-			resched = true;
-
+	if (can_write(msgq)) {
+		/* message queue isn't full, so pending threads are readers */
+		pending_thread = (msgq->used_msgs == 0U) ? z_waitq_head(&msgq->wait_q) : NULL;
+		reader = (pending_thread != NULL) ? pending_thread->base.swap_data : NULL;
+		if (unlikely(reader != NULL) && (reader->op == MSGQ_WAIT_GET)) {
 			/* give message to waiting thread */
-			(void)memcpy(pending_thread->base.swap_data, data, msgq->msg_size);
+			z_unpend_thread(pending_thread);
+			(void)memcpy(reader->data, data, msgq->msg_size);
 			/* wake up waiting thread */
 			arch_thread_return_value_set(pending_thread, 0);
 			z_ready_thread(pending_thread);
+			resched = true;
 		} else {
-			/* put message in queue */
-			__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
-					msgq->write_ptr < msgq->buffer_end);
-			(void)memcpy(msgq->write_ptr, (char *)data, msgq->msg_size);
-			msgq->write_ptr += msgq->msg_size;
-			if (msgq->write_ptr == msgq->buffer_end) {
-				msgq->write_ptr = msgq->buffer_start;
-			}
-			msgq->used_msgs++;
-			resched = handle_poll_events(msgq);
+			/* put message in queue, a reader waiting in
+			 * k_msgq_get_claim() claims it in place
+			 */
+			write_msg(msgq, data);
+			resched = wake_waiters(msgq);
 		}
 		result = 0;
 	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
@@ -169,7 +298,7 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, put, msgq, timeout);
 
 		/* wait for put message success, failure, or timeout */
-		_current->base.swap_data = (void *) data;
+		_current->base.swap_data = &waiter;
 
 		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, result);
@@ -221,8 +350,8 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 {
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
 
+	struct msgq_waiter waiter = { .op = MSGQ_WAIT_GET, .data = data };
 	k_spinlock_key_t key;
-	struct k_thread *pending_thread;
 	int result;
 	bool resched = false;
 
@@ -230,34 +359,13 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get, msgq, timeout);
 
-	if (msgq->used_msgs > 0U) {
+	if (can_read(msgq)) {
 		/* take first available message from queue */
-		(void)memcpy((char *)data, msgq->read_ptr, msgq->msg_size);
-		msgq->read_ptr += msgq->msg_size;
-		if (msgq->read_ptr == msgq->buffer_end) {
-			msgq->read_ptr = msgq->buffer_start;
-		}
-		msgq->used_msgs--;
+		read_msg(msgq, data);
 
-		/* handle first thread waiting to write (if any) */
-		pending_thread = z_unpend_first_thread(&msgq->wait_q);
-		if (unlikely(pending_thread != NULL)) {
+		/* handle threads waiting to write (if any) */
+		if (unlikely(wake_waiters(msgq))) {
 			SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get, msgq, timeout);
-
-			/* add thread's message to queue */
-			__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
-					msgq->write_ptr < msgq->buffer_end);
-			(void)memcpy(msgq->write_ptr, (char *)pending_thread->base.swap_data,
-			       msgq->msg_size);
-			msgq->write_ptr += msgq->msg_size;
-			if (msgq->write_ptr == msgq->buffer_end) {
-				msgq->write_ptr = msgq->buffer_start;
-			}
-			msgq->used_msgs++;
-
-			/* wake up waiting thread */
-			arch_thread_return_value_set(pending_thread, 0);
-			z_ready_thread(pending_thread);
 			resched = true;
 		}
 		result = 0;
@@ -268,7 +376,7 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get, msgq, timeout);
 
 		/* wait for get message success or timeout */
-		_current->base.swap_data = data;
+		_current->base.swap_data = &waiter;
 
 		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, result);
@@ -336,24 +444,14 @@ int z_impl_k_msgq_peek_at(struct k_msgq *msgq, void *data, uint32_t idx)
 {
 	k_spinlock_key_t key;
 	int result;
-	uint32_t bytes_to_end;
-	uint32_t byte_offset;
-	char *start_addr;
+	uint32_t slot;
 
 	key = k_spin_lock(&msgq->lock);
 
 	if (msgq->used_msgs > idx) {
-		bytes_to_end = (msgq->buffer_end - msgq->read_ptr);
-		byte_offset = idx * msgq->msg_size;
-		start_addr = msgq->read_ptr;
-		/* check item available in start/end of ring buffer */
-		if (bytes_to_end <= byte_offset) {
-			/* Tweak the values in case */
-			byte_offset -= bytes_to_end;
-			/* wrap-around is required */
-			start_addr = msgq->buffer_start;
-		}
-		(void)memcpy(data, start_addr + byte_offset, msgq->msg_size);
+		/* messages dropped by a purge may follow a claimed first one */
+		slot = (idx > 0U) ? (idx + msgq->purged_msgs) : 0U;
+		(void)memcpy(data, slot_at(msgq, msgq->read_ptr, slot), msgq->msg_size);
 		result = 0;
 	} else {
 		/* don't wait for a message to become available */
@@ -378,6 +476,124 @@ static inline int z_vrfy_k_msgq_peek_at(struct k_msgq *msgq, void *data, uint32_
 #include <zephyr/syscalls/k_msgq_peek_at_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+int k_msgq_put_reserve(struct k_msgq *msgq, void **msg, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	struct msgq_waiter waiter = { .op = MSGQ_WAIT_RESERVE };
+	k_spinlock_key_t key;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if (can_write(msgq)) {
+		msgq->flags |= K_MSGQ_FLAG_RESERVED;
+		*msg = msgq->write_ptr;
+		result = 0;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		result = -ENOMSG;
+	} else {
+		/* the thread freeing a slot, or committing the current
+		 * reservation, grants us the reservation
+		 */
+		_current->base.swap_data = &waiter;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		if (result == 0) {
+			*msg = waiter.data;
+		}
+		return result;
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return result;
+}
+
+int k_msgq_put_commit(struct k_msgq *msgq, void *msg)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if (((msgq->flags & K_MSGQ_FLAG_RESERVED) == 0U) || (msg != msgq->write_ptr)) {
+		k_spin_unlock(&msgq->lock, key);
+		return -EINVAL;
+	}
+
+	msgq->flags &= ~K_MSGQ_FLAG_RESERVED;
+	advance(msgq, &msgq->write_ptr);
+	msgq->used_msgs++;
+
+	if (wake_waiters(msgq)) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return 0;
+}
+
+int k_msgq_get_claim(struct k_msgq *msgq, void **msg, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	struct msgq_waiter waiter = { .op = MSGQ_WAIT_CLAIM };
+	k_spinlock_key_t key;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if (can_read(msgq)) {
+		msgq->flags |= K_MSGQ_FLAG_CLAIMED;
+		*msg = msgq->read_ptr;
+		result = 0;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		result = -ENOMSG;
+	} else {
+		/* the thread adding a message, or releasing the current
+		 * claim, claims the first message on our behalf
+		 */
+		_current->base.swap_data = &waiter;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		if (result == 0) {
+			*msg = waiter.data;
+		}
+		return result;
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return result;
+}
+
+int k_msgq_get_release(struct k_msgq *msgq, void *msg)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if (((msgq->flags & K_MSGQ_FLAG_CLAIMED) == 0U) || (msg != msgq->read_ptr)) {
+		k_spin_unlock(&msgq->lock, key);
+		return -EINVAL;
+	}
+
+	/* also free the slots of the messages purged while claimed */
+	msgq->flags &= ~K_MSGQ_FLAG_CLAIMED;
+	msgq->read_ptr = slot_at(msgq, msgq->read_ptr, 1U + msgq->purged_msgs);
+	msgq->purged_msgs = 0U;
+	msgq->used_msgs--;
+
+	if (wake_waiters(msgq)) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return 0;
+}
+
 void z_impl_k_msgq_purge(struct k_msgq *msgq)
 {
 	k_spinlock_key_t key;
@@ -388,7 +604,7 @@ void z_impl_k_msgq_purge(struct k_msgq *msgq)
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_msgq, purge, msgq);
 
-	/* wake up any threads that are waiting to write */
+	/* wake up any threads that are waiting */
 	for (pending_thread = z_unpend_first_thread(&msgq->wait_q);
 	     pending_thread != NULL;
 	     pending_thread = z_unpend_first_thread(&msgq->wait_q)) {
@@ -397,8 +613,17 @@ void z_impl_k_msgq_purge(struct k_msgq *msgq)
 		resched = true;
 	}
 
-	msgq->used_msgs = 0;
-	msgq->read_ptr = msgq->write_ptr;
+	if ((msgq->flags & K_MSGQ_FLAG_CLAIMED) != 0U) {
+		/* the claimed message stays until released, the slots of the
+		 * messages behind it are freed along with it
+		 */
+		msgq->purged_msgs += msgq->used_msgs - 1U;
+		msgq->used_msgs = 1U;
+	} else {
+		/* a reserved slot, at the write pointer, stays reserved */
+		msgq->used_msgs = 0U;
+		msgq->read_ptr = msgq->write_ptr;
+	}
 
 	if (resched) {
 		z_reschedule(&msgq->lock, key);
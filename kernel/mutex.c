@@ -37,6 +37,7 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/tracing/tracing.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/mutex.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/llext/symbol.h>
 LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
@@ -102,45 +103,49 @@ static bool adjust_owner_prio(struct k_mutex *mutex, int32_t new_prio)
 	return false;
 }
 
-int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+/* Whether @a owner is the current thread of the CPU it last ran on. This is
+ * read without any lock, each field being loaded once through a volatile
+ * access: the owner may migrate or be switched out right after, so the
+ * answer can be stale. That is harmless, it only makes a spinner poll once
+ * more or pend one poll early, the mutex being re-checked under the lock.
+ */
+static inline bool owner_running(struct k_thread *owner)
 {
-	int new_prio;
-	k_spinlock_key_t key;
-	bool resched = false;
-
-	__ASSERT(!arch_is_in_isr(), "mutexes cannot be used inside ISRs");
-
-	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mutex, lock, mutex, timeout);
-
-	key = k_spin_lock(&lock);
-
-	if (likely((mutex->lock_count == 0U) || (mutex->owner == _current))) {
+	uint8_t cpu = *(volatile uint8_t *)&owner->base.cpu;
 
-		mutex->owner_orig_prio = (mutex->lock_count == 0U) ?
-					_current->base.prio :
-					mutex->owner_orig_prio;
-
-		mutex->lock_count++;
-		mutex->owner = _current;
-
-		LOG_DBG("%p took mutex %p, count: %d, orig prio: %d",
-			_current, mutex, mutex->lock_count,
-			mutex->owner_orig_prio);
+	return *(struct k_thread *volatile *)&_kernel.cpus[cpu].current == owner;
+}
 
-		k_spin_unlock(&lock, key);
+/* Spin with the lock released while the owner of @a mutex keeps running on
+ * another CPU: it is likely to unlock soon, which is cheaper to wait for
+ * than pending and being switched back in. Returns with the lock held.
+ */
+static k_spinlock_key_t spin_on_owner(struct k_mutex *mutex, k_spinlock_key_t key)
+{
+	struct k_thread *owner = mutex->owner;
+	struct k_thread *volatile *owner_p = &mutex->owner;
 
-		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, 0);
+	k_spin_unlock(&lock, key);
 
-		return 0;
+	for (unsigned int i = 0; i < CONFIG_MUTEX_SPIN_ITERATIONS; i++) {
+		if ((*owner_p != owner) || !owner_running(owner)) {
+			break;
+		}
+		arch_spin_relax();
 	}
 
-	if (unlikely(K_TIMEOUT_EQ(timeout, K_NO_WAIT))) {
-		k_spin_unlock(&lock, key);
-
-		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, -EBUSY);
+	return k_spin_lock(&lock);
+}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
 
-		return -EBUSY;
-	}
+/* Slow path of locking a mutex owned by another thread, called with the lock
+ * held: boost the owner's priority and pend until the mutex is handed over.
+ */
+static int mutex_pend(struct k_mutex *mutex, k_spinlock_key_t key, k_timeout_t timeout)
+{
+	int new_prio;
+	bool resched = false;
 
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_mutex, lock, mutex, timeout);
 
@@ -198,6 +203,54 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 	return -EAGAIN;
 }
 
+int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+
+	__ASSERT(!arch_is_in_isr(), "mutexes cannot be used inside ISRs");
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mutex, lock, mutex, timeout);
+
+	key = k_spin_lock(&lock);
+
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+	if ((mutex->lock_count != 0U) && (mutex->owner != _current) &&
+	    !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		key = spin_on_owner(mutex, key);
+	}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
+	if (likely((mutex->lock_count == 0U) || (mutex->owner == _current))) {
+
+		mutex->owner_orig_prio = (mutex->lock_count == 0U) ?
+					_current->base.prio :
+					mutex->owner_orig_prio;
+
+		mutex->lock_count++;
+		mutex->owner = _current;
+
+		LOG_DBG("%p took mutex %p, count: %d, orig prio: %d",
+			_current, mutex, mutex->lock_count,
+			mutex->owner_orig_prio);
+
+		k_spin_unlock(&lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, 0);
+
+		return 0;
+	}
+
+	if (unlikely(K_TIMEOUT_EQ(timeout, K_NO_WAIT))) {
+		k_spin_unlock(&lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, -EBUSY);
+
+		return -EBUSY;
+	}
+
+	return mutex_pend(mutex, key, timeout);
+}
+
 #ifdef CONFIG_USERSPACE
 static inline int z_vrfy_k_mutex_lock(struct k_mutex *mutex,
 				      k_timeout_t timeout)
@@ -208,6 +261,40 @@ static inline int z_vrfy_k_mutex_lock(struct k_mutex *mutex,
 #include <zephyr/syscalls/k_mutex_lock_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+/* Drop the last lock count of the owner, called with the lock held: restore
+ * its priority and hand the mutex over to the first waiter, if any, which is
+ * returned.
+ */
+static struct k_thread *mutex_release(struct k_mutex *mutex)
+{
+	struct k_thread *new_owner;
+
+	adjust_owner_prio(mutex, mutex->owner_orig_prio);
+
+	/* Get the new owner, if any */
+	new_owner = z_unpend_first_thread(&mutex->wait_q);
+
+	mutex->owner = new_owner;
+
+	LOG_DBG("new owner of mutex %p: %p (prio: %d)",
+		mutex, new_owner, new_owner ? new_owner->base.prio : -1000);
+
+	if (unlikely(new_owner != NULL)) {
+		/*
+		 * new owner is already of higher or equal prio than first
+		 * waiter since the wait queue is priority-based: no need to
+		 * adjust its priority
+		 */
+		mutex->owner_orig_prio = new_owner->base.prio;
+		arch_thread_return_value_set(new_owner, 0);
+		z_ready_thread(new_owner);
+	} else {
+		mutex->lock_count = 0U;
+	}
+
+	return new_owner;
+}
+
 int z_impl_k_mutex_unlock(struct k_mutex *mutex)
 {
 	struct k_thread *new_owner;
@@ -251,28 +338,11 @@ int z_impl_k_mutex_unlock(struct k_mutex *mutex)
 
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
-	adjust_owner_prio(mutex, mutex->owner_orig_prio);
-
-	/* Get the new owner, if any */
-	new_owner = z_unpend_first_thread(&mutex->wait_q);
-
-	mutex->owner = new_owner;
-
-	LOG_DBG("new owner of mutex %p: %p (prio: %d)",
-		mutex, new_owner, new_owner ? new_owner->base.prio : -1000);
+	new_owner = mutex_release(mutex);
 
 	if (unlikely(new_owner != NULL)) {
-		/*
-		 * new owner is already of higher or equal prio than first
-		 * waiter since the wait queue is priority-based: no need to
-		 * adjust its priority
-		 */
-		mutex->owner_orig_prio = new_owner->base.prio;
-		arch_thread_return_value_set(new_owner, 0);
-		z_ready_thread(new_owner);
 		z_reschedule(&lock, key);
 	} else {
-		mutex->lock_count = 0U;
 		k_spin_unlock(&lock, key);
 	}
 
@@ -292,6 +362,192 @@ static inline int z_vrfy_k_mutex_unlock(struct k_mutex *mutex)
 #include <zephyr/syscalls/k_mutex_unlock_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+/* Lock word support for sys_mutex fast paths.
+ *
+ * The word holds the thread owning the mutex, or 0 when it is unlocked, so
+ * that uncontended locking and unlocking is a compare-and-swap done in user
+ * mode. The backing k_mutex is only used once another thread contends: the
+ * contender has the kernel adopt the mutex on behalf of its owner and sets
+ * SYS_MUTEX_CONTENDED in the word, which sends the owner's unlock through
+ * the kernel, where priority inheritance and hand-over work as for any
+ * k_mutex. The word only changes under the lock once that bit is set.
+ */
+static inline struct k_thread *word_owner(atomic_val_t val)
+{
+	return (struct k_thread *)(val & ~SYS_MUTEX_CONTENDED);
+}
+
+/* The word lives in user memory, do not trust it to name a thread: a user
+ * thread could otherwise have the kernel adopt the mutex for, and boost,
+ * arbitrary memory. Only the mutex was checked against the caller's
+ * permissions, the owner just has to be a live thread object.
+ */
+static bool word_owner_valid(struct k_thread *thread)
+{
+	struct k_object *ko = k_object_find(thread);
+
+	if ((ko == NULL) || (ko->type != K_OBJ_THREAD) ||
+	    ((ko->flags & K_OBJ_FLAG_INITIALIZED) == 0U)) {
+		return false;
+	}
+
+	return !z_is_thread_state_set(thread, _THREAD_DEAD);
+}
+
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+/* Same as spin_on_owner(), for an owner that the kernel may not know of */
+static k_spinlock_key_t spin_on_word(atomic_t *word, atomic_val_t val,
+				     k_spinlock_key_t key)
+{
+	struct k_thread *owner = word_owner(val);
+
+	k_spin_unlock(&lock, key);
+
+	for (unsigned int i = 0; i < CONFIG_MUTEX_SPIN_ITERATIONS; i++) {
+		if ((atomic_get(word) != val) || !owner_running(owner)) {
+			break;
+		}
+		arch_spin_relax();
+	}
+
+	return k_spin_lock(&lock);
+}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
+int z_mutex_word_lock(struct k_mutex *mutex, atomic_t *word, uint32_t *count,
+		      k_timeout_t timeout)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	bool spun = false;
+	struct k_thread *owner;
+	atomic_val_t val;
+	int ret;
+
+	for (;;) {
+		val = atomic_get(word);
+		owner = word_owner(val);
+
+		if (val == 0) {
+			/* Raced with the owner's fast unlock */
+			if (atomic_cas(word, 0, (atomic_val_t)_current)) {
+				*count = 1U;
+				k_spin_unlock(&lock, key);
+				return 0;
+			}
+			continue;
+		}
+
+		if (owner == _current) {
+			/* Recursive lock of a mutex the caller stopped caching */
+			(*count)++;
+			k_spin_unlock(&lock, key);
+			return 0;
+		}
+
+		if (!word_owner_valid(owner)) {
+			k_spin_unlock(&lock, key);
+			return -EINVAL;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			k_spin_unlock(&lock, key);
+			return -EBUSY;
+		}
+
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+		if (!spun) {
+			spun = true;
+			key = spin_on_word(word, val, key);
+			continue;
+		}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
+		if ((val & SYS_MUTEX_CONTENDED) != 0) {
+			/* Only the kernel sets the bit, once it tracks the owner */
+			if ((mutex->lock_count == 0U) || (mutex->owner != owner)) {
+				k_spin_unlock(&lock, key);
+				return -EINVAL;
+			}
+			break;
+		}
+
+		if (atomic_cas(word, val, val | SYS_MUTEX_CONTENDED)) {
+			__ASSERT_NO_MSG(mutex->lock_count == 0U);
+
+			mutex->owner = owner;
+			mutex->owner_orig_prio = owner->base.prio;
+			mutex->lock_count = 1U;
+			break;
+		}
+	}
+
+	ARG_UNUSED(spun);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mutex, lock, mutex, timeout);
+
+	/* The unlocking thread updates the word when handing the mutex over */
+	ret = mutex_pend(mutex, key, timeout);
+	if (ret == 0) {
+		*count = 1U;
+	}
+
+	return ret;
+}
+
+int z_mutex_word_unlock(struct k_mutex *mutex, atomic_t *word, uint32_t *count)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct k_thread *new_owner;
+	atomic_val_t val = atomic_get(word);
+
+	if (val == 0) {
+		k_spin_unlock(&lock, key);
+		return -EINVAL;
+	}
+
+	if (word_owner(val) != _current) {
+		k_spin_unlock(&lock, key);
+		return -EPERM;
+	}
+
+	if (*count > 1U) {
+		/* Still held recursively, the word does not change */
+		(*count)--;
+		k_spin_unlock(&lock, key);
+		return 0;
+	}
+
+	/* The mutex may change hands as soon as the word is updated */
+	*count = 0U;
+
+	if ((val & SYS_MUTEX_CONTENDED) == 0) {
+		/* Nobody else writes the word while we own it uncontended */
+		atomic_set(word, 0);
+		k_spin_unlock(&lock, key);
+		return 0;
+	}
+
+	if ((mutex->lock_count == 0U) || (mutex->owner != _current)) {
+		/* Contended bit forged in the word */
+		k_spin_unlock(&lock, key);
+		return -EINVAL;
+	}
+
+	new_owner = mutex_release(mutex);
+
+	if (new_owner != NULL) {
+		atomic_set(word, (atomic_val_t)new_owner | SYS_MUTEX_CONTENDED);
+		z_reschedule(&lock, key);
+	} else {
+		atomic_set(word, 0);
+		k_spin_unlock(&lock, key);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_SYS_MUTEX_FAST_PATH */
+
 #ifdef CONFIG_OBJ_CORE_MUTEX
 static int init_mutex_obj_core_list(void)
 {
@@ -96,6 +96,10 @@ void z_impl_k_mem_paging_stats_get(struct k_mem_paging_stats_t *stats)
 
 	/* Copy statistics */
 	memcpy(stats, &paging_stats, sizeof(paging_stats));
+
+#ifdef CONFIG_EVICTION_WORKING_SET
+	stats->workingset.size = k_mem_paging_eviction_working_set_get();
+#endif /* CONFIG_EVICTION_WORKING_SET */
 }
 
 #ifdef CONFIG_USERSPACE
@@ -35,10 +35,11 @@
  */
 static struct k_spinlock lock;
 
-enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED };
+enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED, MODE_POLLSET };
 
 static int signal_poller(struct k_poll_event *event, uint32_t state);
 static int signal_triggered_work(struct k_poll_event *event, uint32_t status);
+static int signal_pollset(struct k_poll_event *event, uint32_t state);
 
 void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 		       int mode, void *obj)
@@ -82,7 +83,8 @@ static inline bool is_condition_met(struct k_poll_event *event, uint32_t *state)
 		}
 		break;
 	case K_POLL_TYPE_MSGQ_DATA_AVAILABLE:
-		if (event->msgq->used_msgs > 0) {
+		if ((event->msgq->used_msgs > 0) &&
+		    ((event->msgq->flags & K_MSGQ_FLAG_CLAIMED) == 0U)) {
 			*state = K_POLL_STATE_MSGQ_DATA_AVAILABLE;
 			return true;
 		}
@@ -97,6 +99,14 @@ static inline bool is_condition_met(struct k_poll_event *event, uint32_t *state)
 			return true;
 		}
 		break;
+#ifdef CONFIG_RINGQ
+	case K_POLL_TYPE_RINGQ_DATA_AVAILABLE:
+		if (!k_ringq_is_empty(event->ringq)) {
+			*state = K_POLL_STATE_RINGQ_DATA_AVAILABLE;
+			return true;
+		}
+		break;
+#endif /* CONFIG_RINGQ */
 	case K_POLL_TYPE_IGNORE:
 		break;
 	default:
@@ -117,17 +127,25 @@ static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 {
 	struct k_poll_event *pending;
 
+	/* Poll sets have no thread, they are served after all threads */
+	if (poller->mode == MODE_POLLSET) {
+		sys_dlist_append(events, &event->_node);
+		return;
+	}
+
 	pending = (struct k_poll_event *)sys_dlist_peek_tail(events);
 	if ((pending == NULL) ||
-		(z_sched_prio_cmp(poller_thread(pending->poller),
-							   poller_thread(poller)) > 0)) {
+		((pending->poller->mode != MODE_POLLSET) &&
+		 (z_sched_prio_cmp(poller_thread(pending->poller),
+							   poller_thread(poller)) > 0))) {
 		sys_dlist_append(events, &event->_node);
 		return;
 	}
 
 	SYS_DLIST_FOR_EACH_CONTAINER(events, pending, _node) {
-		if (z_sched_prio_cmp(poller_thread(poller),
-					poller_thread(pending->poller)) > 0) {
+		if ((pending->poller->mode == MODE_POLLSET) ||
+		    (z_sched_prio_cmp(poller_thread(poller),
+					poller_thread(pending->poller)) > 0)) {
 			sys_dlist_insert(&pending->_node, &event->_node);
 			return;
 		}
@@ -161,6 +179,14 @@ static inline void register_event(struct k_poll_event *event,
 		__ASSERT(event->pipe != NULL, "invalid pipe\n");
 		add_event(&event->pipe->poll_events, event, poller);
 		break;
+#ifdef CONFIG_RINGQ
+	case K_POLL_TYPE_RINGQ_DATA_AVAILABLE:
+		__ASSERT(event->ringq != NULL, "invalid ring queue\n");
+		add_event(&event->ringq->poll_events, event, poller);
+		/* Make lock-free producers take the slow path */
+		(void)atomic_inc(&event->ringq->waiters);
+		break;
+#endif /* CONFIG_RINGQ */
 	case K_POLL_TYPE_IGNORE:
 		/* nothing to do */
 		break;
@@ -200,6 +226,13 @@ static inline void clear_event_registration(struct k_poll_event *event)
 		__ASSERT(event->pipe != NULL, "invalid pipe\n");
 		remove_event = true;
 		break;
+#ifdef CONFIG_RINGQ
+	case K_POLL_TYPE_RINGQ_DATA_AVAILABLE:
+		__ASSERT(event->ringq != NULL, "invalid ring queue\n");
+		(void)atomic_dec(&event->ringq->waiters);
+		remove_event = true;
+		break;
+#endif /* CONFIG_RINGQ */
 	case K_POLL_TYPE_IGNORE:
 		/* nothing to do */
 		break;
@@ -248,6 +281,17 @@ static inline int register_events(struct k_poll_event *events,
 		} else if (!just_check && poller->is_polling) {
 			register_event(&events[ii], poller);
 			events_registered += 1;
+#ifdef CONFIG_RINGQ
+			/* Ring queue producers do not take a lock, one may
+			 * have added data after the check above but before it
+			 * could see the registration.
+			 */
+			if ((events[ii].type == K_POLL_TYPE_RINGQ_DATA_AVAILABLE) &&
+			    is_condition_met(&events[ii], &state)) {
+				set_event_ready(&events[ii], state);
+				poller->is_polling = false;
+			}
+#endif /* CONFIG_RINGQ */
 		} else {
 			/* Event is not one of those identified in is_condition_met()
 			 * catching non-polling events, or is marked for just check,
@@ -445,6 +489,8 @@ static int signal_poll_event(struct k_poll_event *event, uint32_t state)
 			retcode = signal_poller(event, state);
 		} else if (poller->mode == MODE_TRIGGERED) {
 			retcode = signal_triggered_work(event, state);
+		} else if (poller->mode == MODE_POLLSET) {
+			retcode = signal_pollset(event, state);
 		} else {
 			/* Poller is not poll or triggered mode. No action needed.*/
 			;
@@ -566,6 +612,152 @@ static inline void z_vrfy_k_poll_signal_reset(struct k_poll_signal *sig)
 
 #endif /* CONFIG_USERSPACE */
 
+/* Poll sets.
+ *
+ * An event of a set is in exactly one of three places: registered with its
+ * object, on the ready list of the set, or on its list of events returned
+ * by the last wait. Signaling an event moves it from its object to the
+ * ready list; each wait moves the events it returns to the returned list,
+ * and the next wait re-arms them. The event's node links it in all three.
+ */
+
+/* must be called with interrupts locked */
+static void pollset_arm(struct k_pollset *set, struct k_poll_event *event)
+{
+	uint32_t state;
+
+	event->state = K_POLL_STATE_NOT_READY;
+
+	if (!is_condition_met(event, &state)) {
+		register_event(event, &set->poller);
+#ifdef CONFIG_RINGQ
+		/* See register_events() */
+		if ((event->type != K_POLL_TYPE_RINGQ_DATA_AVAILABLE) ||
+		    !is_condition_met(event, &state)) {
+			return;
+		}
+		clear_event_registration(event);
+#else
+		return;
+#endif /* CONFIG_RINGQ */
+	}
+
+	set_event_ready(event, state);
+	sys_dlist_append(&set->ready, &event->_node);
+}
+
+/* must be called with interrupts locked */
+static int signal_pollset(struct k_poll_event *event, uint32_t state)
+{
+	struct k_pollset *set = CONTAINER_OF(event->poller, struct k_pollset, poller);
+	struct k_thread *thread;
+
+	ARG_UNUSED(state);
+
+	/* The object already unlinked the event */
+	clear_event_registration(event);
+	sys_dlist_append(&set->ready, &event->_node);
+
+	thread = z_unpend_first_thread(&set->wait_q);
+	if (thread != NULL) {
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+	}
+
+	return 0;
+}
+
+void k_pollset_init(struct k_pollset *set)
+{
+	set->poller.is_polling = false;
+	set->poller.mode = MODE_POLLSET;
+	sys_dlist_init(&set->ready);
+	sys_dlist_init(&set->returned);
+	z_waitq_init(&set->wait_q);
+}
+
+void k_pollset_add(struct k_pollset *set, struct k_poll_event *event)
+{
+	__ASSERT(event->mode == K_POLL_MODE_NOTIFY_ONLY, "only NOTIFY_ONLY mode is supported\n");
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	sys_dnode_init(&event->_node);
+	event->poller = NULL;
+	pollset_arm(set, event);
+
+	if (!sys_dlist_is_empty(&set->ready)) {
+		struct k_thread *thread = z_unpend_first_thread(&set->wait_q);
+
+		if (thread != NULL) {
+			arch_thread_return_value_set(thread, 0);
+			z_ready_thread(thread);
+			z_reschedule(&lock, key);
+			return;
+		}
+	}
+
+	k_spin_unlock(&lock, key);
+}
+
+int k_pollset_del(struct k_pollset *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	int ret = 0;
+
+	if (event->poller == &set->poller) {
+		clear_event_registration(event);
+	} else if (sys_dnode_is_linked(&event->_node)) {
+		sys_dlist_remove(&event->_node);
+	} else {
+		ret = -ENOENT;
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+
+int k_pollset_wait(struct k_pollset *set, struct k_poll_event **ready, int max_events,
+		   k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr(), "");
+	__ASSERT(max_events > 0, "no room for events\n");
+
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct k_poll_event *event;
+	bool timed_out = false;
+	int num_ready = 0;
+
+	while ((event = (struct k_poll_event *)sys_dlist_get(&set->returned)) != NULL) {
+		pollset_arm(set, event);
+	}
+
+	for (;;) {
+		while (num_ready < max_events) {
+			event = (struct k_poll_event *)sys_dlist_get(&set->ready);
+			if (event == NULL) {
+				break;
+			}
+			sys_dlist_append(&set->returned, &event->_node);
+			ready[num_ready++] = event;
+		}
+
+		if ((num_ready > 0) || timed_out || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			break;
+		}
+
+		timeout = sys_timepoint_timeout(end);
+		timed_out = (z_pend_curr(&lock, key, &set->wait_q, timeout) != 0);
+		key = k_spin_lock(&lock);
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return (num_ready > 0) ? num_ready : -EAGAIN;
+}
+
 static void triggered_work_handler(struct k_work *work)
 {
 	struct k_work_poll *twork =
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Lock-free bounded multi-producer/multi-consumer ring queues.
+ *
+ * Each slot carries a sequence number telling which lap of the ring it is
+ * ready for: a producer owning position @a pos may fill slot
+ * (pos & mask) once its sequence is @a pos, and publishes the data by
+ * setting it to pos + 1; a consumer owning position @a pos may drain the
+ * slot once its sequence is pos + 1, and recycles it for the next lap by
+ * setting it to pos + mask + 1. Positions are claimed with a
+ * compare-and-swap on the head and tail counters, so neither side ever
+ * takes a lock.
+ *
+ * Producers may fill their slots out of order, so head counts positions
+ * claimed rather than items available. After filling its slot a producer
+ * moves the published position past every filled slot, which is what
+ * k_ringq_num_used_get() and hence pollers look at.
+ *
+ * Sequence numbers are stored minus the slot index, so that an all-zero
+ * slot array is a valid empty queue and K_RINGQ_DEFINE() needs no runtime
+ * initialization.
+ *
+ * The wait queue lock is only taken by consumers about to block on an empty
+ * queue, and by producers when the waiters count says a thread is pended or
+ * polling.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel_structs.h>
+#include <zephyr/sys/atomic.h>
+#include <ksched.h>
+#include <wait_q.h>
+#include <kernel_internal.h>
+
+static inline atomic_val_t pos_add(atomic_val_t pos, uint32_t n)
+{
+	return (atomic_val_t)((unsigned long)pos + n);
+}
+
+/* Signed distance between a slot sequence number and a position */
+static inline atomic_val_t seq_diff(struct k_ringq *ringq, atomic_val_t pos,
+				    atomic_val_t expected)
+{
+	struct k_ringq_slot *slot = &ringq->slots[pos & ringq->mask];
+	unsigned long seq = (unsigned long)atomic_get(&slot->seq) + (pos & ringq->mask);
+
+	return (atomic_val_t)(seq - (unsigned long)expected);
+}
+
+static inline void seq_set(struct k_ringq *ringq, atomic_val_t pos, atomic_val_t seq)
+{
+	struct k_ringq_slot *slot = &ringq->slots[pos & ringq->mask];
+
+	(void)atomic_set(&slot->seq,
+			 (atomic_val_t)((unsigned long)seq - (pos & ringq->mask)));
+}
+
+static bool ringq_try_put(struct k_ringq *ringq, void *data)
+{
+	atomic_val_t pos = atomic_get(&ringq->head);
+	atomic_val_t diff;
+
+	for (;;) {
+		diff = seq_diff(ringq, pos, pos);
+		if (diff == 0) {
+			if (atomic_cas(&ringq->head, pos, pos_add(pos, 1U))) {
+				break;
+			}
+		} else if (diff < 0) {
+			/* Slot not yet drained from the previous lap: full */
+			return false;
+		} else {
+			/* Another producer claimed this position */
+		}
+		pos = atomic_get(&ringq->head);
+	}
+
+	ringq->slots[pos & ringq->mask].data = data;
+	seq_set(ringq, pos, pos_add(pos, 1U));
+
+	/* Slots past the published position that were filled, or already
+	 * filled and drained, are published. A slot still being filled stops
+	 * the scan, its producer will resume it.
+	 */
+	pos = atomic_get(&ringq->published);
+	while (seq_diff(ringq, pos, pos_add(pos, 1U)) >= 0) {
+		if (atomic_cas(&ringq->published, pos, pos_add(pos, 1U))) {
+			pos = pos_add(pos, 1U);
+		} else {
+			pos = atomic_get(&ringq->published);
+		}
+	}
+
+	return true;
+}
+
+static void *ringq_try_get(struct k_ringq *ringq)
+{
+	atomic_val_t pos = atomic_get(&ringq->tail);
+	atomic_val_t diff;
+	void *data;
+
+	for (;;) {
+		diff = seq_diff(ringq, pos, pos_add(pos, 1U));
+		if (diff == 0) {
+			if (atomic_cas(&ringq->tail, pos, pos_add(pos, 1U))) {
+				break;
+			}
+		} else if (diff < 0) {
+			/* Slot not yet filled for this lap: empty */
+			return NULL;
+		} else {
+			/* Another consumer claimed this position */
+		}
+		pos = atomic_get(&ringq->tail);
+	}
+
+	data = ringq->slots[pos & ringq->mask].data;
+	seq_set(ringq, pos, pos_add(pos, ringq->mask + 1U));
+
+	return data;
+}
+
+static inline bool handle_poll_events(struct k_ringq *ringq)
+{
+#ifdef CONFIG_POLL
+	return z_handle_obj_poll_events(&ringq->poll_events,
+					K_POLL_STATE_RINGQ_DATA_AVAILABLE);
+#else
+	ARG_UNUSED(ringq);
+	return false;
+#endif /* CONFIG_POLL */
+}
+
+void k_ringq_init(struct k_ringq *ringq, struct k_ringq_slot *slots,
+		  uint32_t num_slots)
+{
+	__ASSERT(IS_POWER_OF_TWO(num_slots), "ring queue size must be a power of two");
+
+	for (uint32_t i = 0; i < num_slots; i++) {
+		slots[i].seq = ATOMIC_INIT(0);
+	}
+
+	ringq->slots = slots;
+	ringq->mask = num_slots - 1U;
+	ringq->head = ATOMIC_INIT(0);
+	ringq->published = ATOMIC_INIT(0);
+	ringq->tail = ATOMIC_INIT(0);
+	ringq->waiters = ATOMIC_INIT(0);
+	z_waitq_init(&ringq->wait_q);
+	ringq->lock = (struct k_spinlock) {};
+#ifdef CONFIG_POLL
+	sys_dlist_init(&ringq->poll_events);
+#endif /* CONFIG_POLL */
+}
+
+/* Slow path of k_ringq_put(): hand an item over to the first pended
+ * thread, or else signal a poller.
+ */
+static void ringq_wake(struct k_ringq *ringq)
+{
+	k_spinlock_key_t key = k_spin_lock(&ringq->lock);
+	struct k_thread *thread;
+	void *data;
+
+	if (z_waitq_head(&ringq->wait_q) != NULL) {
+		/* A lock-free consumer may have beaten us to the item */
+		data = ringq_try_get(ringq);
+		if (data != NULL) {
+			thread = z_unpend_first_thread(&ringq->wait_q);
+			z_thread_return_value_set_with_data(thread, 0, data);
+			z_ready_thread(thread);
+			z_reschedule(&ringq->lock, key);
+			return;
+		}
+	} else if (handle_poll_events(ringq)) {
+		z_reschedule(&ringq->lock, key);
+		return;
+	} else {
+		/* Waiter is about to re-check the queue under the lock */
+	}
+
+	k_spin_unlock(&ringq->lock, key);
+}
+
+int k_ringq_put(struct k_ringq *ringq, void *data)
+{
+	if (unlikely(!ringq_try_put(ringq, data))) {
+		return -ENOMEM;
+	}
+
+	/* Pairs with the increment in k_ringq_get(): either the waiter sees
+	 * the item when re-checking, or we see the waiter here.
+	 */
+	if (unlikely(atomic_get(&ringq->waiters) != 0)) {
+		ringq_wake(ringq);
+	}
+
+	return 0;
+}
+
+void *k_ringq_get(struct k_ringq *ringq, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	k_spinlock_key_t key;
+	void *data;
+	int ret;
+
+	data = ringq_try_get(ringq);
+	if (likely(data != NULL) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		return data;
+	}
+
+	key = k_spin_lock(&ringq->lock);
+
+	(void)atomic_inc(&ringq->waiters);
+	data = ringq_try_get(ringq);
+	if (data != NULL) {
+		(void)atomic_dec(&ringq->waiters);
+		k_spin_unlock(&ringq->lock, key);
+		return data;
+	}
+
+	ret = z_pend_curr(&ringq->lock, key, &ringq->wait_q, timeout);
+	(void)atomic_dec(&ringq->waiters);
+
+	return (ret != 0) ? NULL : _current->base.swap_data;
+}
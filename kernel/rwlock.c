@@ -0,0 +1,487 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Reader-writer locks with writer preference.
+ *
+ * The state word counts the readers holding the lock and flags a writer
+ * holding it or waiting for it. Readers get in and out with atomic
+ * operations on it as long as neither flag is set; every other transition
+ * happens under the lock of the object, which also makes sure that clearing
+ * a flag and waking the threads it kept out are done together.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel_structs.h>
+#include <zephyr/toolchain.h>
+#include <zephyr/sys/atomic.h>
+#include <ksched.h>
+#include <wait_q.h>
+#include <zephyr/internal/syscall_handler.h>
+#include <zephyr/init.h>
+#include <string.h>
+
+#define RWLOCK_WRITER           BIT(0)
+#define RWLOCK_WRITERS_WAITING  BIT(1)
+#define RWLOCK_READER           BIT(2)
+#define RWLOCK_FLAGS            (RWLOCK_WRITER | RWLOCK_WRITERS_WAITING)
+
+#ifdef CONFIG_OBJ_CORE_RWLOCK
+static struct k_obj_type obj_type_rwlock;
+
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+static int k_rwlock_stats_raw(struct k_obj_core *obj_core, void *stats)
+{
+	__ASSERT((obj_core != NULL) && (stats != NULL), "NULL parameter");
+
+	struct k_rwlock *rwlock = CONTAINER_OF(obj_core, struct k_rwlock, obj_core);
+	k_spinlock_key_t key = k_spin_lock(&rwlock->lock);
+
+	memcpy(stats, &rwlock->stats, sizeof(rwlock->stats));
+	k_spin_unlock(&rwlock->lock, key);
+
+	return 0;
+}
+
+static int k_rwlock_stats_reset(struct k_obj_core *obj_core)
+{
+	__ASSERT(obj_core != NULL, "NULL parameter");
+
+	struct k_rwlock *rwlock = CONTAINER_OF(obj_core, struct k_rwlock, obj_core);
+	k_spinlock_key_t key = k_spin_lock(&rwlock->lock);
+
+	rwlock->stats = (struct k_rwlock_stats) {};
+	k_spin_unlock(&rwlock->lock, key);
+
+	return 0;
+}
+
+static struct k_obj_core_stats_desc rwlock_stats_desc = {
+	.raw_size = sizeof(struct k_rwlock_stats),
+	.query_size = sizeof(struct k_rwlock_stats),
+	.raw   = k_rwlock_stats_raw,
+	.query = k_rwlock_stats_raw,
+	.reset = k_rwlock_stats_reset,
+	.disable = NULL,
+	.enable = NULL,
+};
+
+#define RWLOCK_STATS_INC(rwlock, field) ((rwlock)->stats.field++)
+#endif /* CONFIG_OBJ_CORE_STATS_RWLOCK */
+#endif /* CONFIG_OBJ_CORE_RWLOCK */
+
+#ifndef RWLOCK_STATS_INC
+#define RWLOCK_STATS_INC(rwlock, field) do { } while (false)
+#endif /* RWLOCK_STATS_INC */
+
+static inline atomic_val_t num_readers(atomic_val_t state)
+{
+	return (atomic_val_t)((unsigned long)state / RWLOCK_READER);
+}
+
+static bool try_read_lock(struct k_rwlock *rwlock)
+{
+	atomic_val_t state = atomic_get(&rwlock->state);
+
+	while ((state & RWLOCK_FLAGS) == 0) {
+		if (atomic_cas(&rwlock->state, state, state + RWLOCK_READER)) {
+			return true;
+		}
+		state = atomic_get(&rwlock->state);
+	}
+
+	return false;
+}
+
+static int inherited_prio(int prio, int limit)
+{
+	return z_get_new_prio_with_ceiling(z_is_prio_higher(prio, limit) ? prio : limit);
+}
+
+/* Have the writer run at least at the priority of a thread about to wait */
+static bool boost_writer(struct k_rwlock *rwlock, int prio)
+{
+	struct k_thread *writer = rwlock->writer;
+	int new_prio = inherited_prio(prio, writer->base.prio);
+
+	if (z_is_prio_higher(new_prio, writer->base.prio)) {
+		return z_thread_prio_set(writer, new_prio);
+	}
+
+	return false;
+}
+
+/* Recompute the writer priority after a waiter gave up */
+static bool restore_writer_prio(struct k_rwlock *rwlock)
+{
+	struct k_thread *writer = rwlock->writer;
+	struct k_thread *waiter;
+	int prio = rwlock->writer_orig_prio;
+
+	waiter = z_waitq_head(&rwlock->writers_wait_q);
+	if (waiter != NULL) {
+		prio = inherited_prio(waiter->base.prio, prio);
+	}
+
+	waiter = z_waitq_head(&rwlock->readers_wait_q);
+	if (waiter != NULL) {
+		prio = inherited_prio(waiter->base.prio, prio);
+	}
+
+	if (writer->base.prio != prio) {
+		return z_thread_prio_set(writer, prio);
+	}
+
+	return false;
+}
+
+/* Let all waiting readers in, no writer may hold or wait for the lock */
+static bool wake_readers(struct k_rwlock *rwlock)
+{
+	struct k_thread *thread;
+	bool woken = false;
+
+	for (thread = z_unpend_first_thread(&rwlock->readers_wait_q); thread != NULL;
+	     thread = z_unpend_first_thread(&rwlock->readers_wait_q)) {
+		/* Account for the reader before it can run and unlock */
+		(void)atomic_add(&rwlock->state, RWLOCK_READER);
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+		woken = true;
+	}
+
+	return woken;
+}
+
+/* Give a lock nobody holds to the first waiting writer, or else to all
+ * waiting readers. The flags set keep readers from getting in meanwhile.
+ */
+static bool hand_over(struct k_rwlock *rwlock)
+{
+	struct k_thread *thread = z_unpend_first_thread(&rwlock->writers_wait_q);
+
+	if (thread == NULL) {
+		(void)atomic_set(&rwlock->state, 0);
+		return wake_readers(rwlock);
+	}
+
+	rwlock->writer = thread;
+	rwlock->writer_orig_prio = thread->base.prio;
+	(void)atomic_set(&rwlock->state,
+			 (z_waitq_head(&rwlock->writers_wait_q) != NULL) ?
+			 RWLOCK_FLAGS : RWLOCK_WRITER);
+
+	/* Waiting writers do not outrank it, waiting readers may */
+	(void)restore_writer_prio(rwlock);
+	RWLOCK_STATS_INC(rwlock, write_locks);
+	arch_thread_return_value_set(thread, 0);
+	z_ready_thread(thread);
+
+	return true;
+}
+
+int z_impl_k_rwlock_init(struct k_rwlock *rwlock)
+{
+	rwlock->state = ATOMIC_INIT(0);
+	rwlock->writer = NULL;
+	z_waitq_init(&rwlock->readers_wait_q);
+	z_waitq_init(&rwlock->writers_wait_q);
+	rwlock->lock = (struct k_spinlock) {};
+
+	k_object_init(rwlock);
+
+#ifdef CONFIG_OBJ_CORE_RWLOCK
+	k_obj_core_init_and_link(K_OBJ_CORE(rwlock), &obj_type_rwlock);
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+	rwlock->stats = (struct k_rwlock_stats) {};
+	k_obj_core_stats_register(K_OBJ_CORE(rwlock), &rwlock->stats,
+				  sizeof(struct k_rwlock_stats));
+#endif /* CONFIG_OBJ_CORE_STATS_RWLOCK */
+#endif /* CONFIG_OBJ_CORE_RWLOCK */
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_init(struct k_rwlock *rwlock)
+{
+	K_OOPS(K_SYSCALL_OBJ_INIT(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_init(rwlock);
+}
+#include <zephyr/syscalls/k_rwlock_init_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_rwlock_read_lock(struct k_rwlock *rwlock, k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+	bool resched = false;
+	int ret;
+
+	__ASSERT(!arch_is_in_isr(), "reader-writer locks cannot be used inside ISRs");
+
+	if (likely(try_read_lock(rwlock))) {
+		return 0;
+	}
+
+	key = k_spin_lock(&rwlock->lock);
+
+	/* A writer may have left in the meantime */
+	if (try_read_lock(rwlock)) {
+		k_spin_unlock(&rwlock->lock, key);
+		return 0;
+	}
+
+	if (rwlock->writer == _current) {
+		k_spin_unlock(&rwlock->lock, key);
+		return -EDEADLK;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		k_spin_unlock(&rwlock->lock, key);
+		return -EBUSY;
+	}
+
+	RWLOCK_STATS_INC(rwlock, read_waits);
+
+	/* Blocked by readers only while a writer waits, nobody to boost then */
+	if (rwlock->writer != NULL) {
+		resched = boost_writer(rwlock, _current->base.prio);
+	}
+
+	ret = z_pend_curr(&rwlock->lock, key, &rwlock->readers_wait_q, timeout);
+	if (ret == 0) {
+		return 0;
+	}
+
+	/* timed out */
+
+	key = k_spin_lock(&rwlock->lock);
+
+	if (rwlock->writer != NULL) {
+		resched = restore_writer_prio(rwlock) || resched;
+	}
+
+	if (resched) {
+		z_reschedule(&rwlock->lock, key);
+	} else {
+		k_spin_unlock(&rwlock->lock, key);
+	}
+
+	return -EAGAIN;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_read_lock(struct k_rwlock *rwlock, k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_read_lock(rwlock, timeout);
+}
+#include <zephyr/syscalls/k_rwlock_read_lock_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_rwlock_read_unlock(struct k_rwlock *rwlock)
+{
+	k_spinlock_key_t key;
+	atomic_val_t state;
+
+	__ASSERT(!arch_is_in_isr(), "reader-writer locks cannot be used inside ISRs");
+
+	do {
+		state = atomic_get(&rwlock->state);
+		if (num_readers(state) == 0) {
+			return -EPERM;
+		}
+	} while (!atomic_cas(&rwlock->state, state, state - RWLOCK_READER));
+
+	if (likely((num_readers(state) != 1) ||
+		   ((state & RWLOCK_WRITERS_WAITING) == 0))) {
+		return 0;
+	}
+
+	/* Last reader out while a writer waits: let it in */
+	key = k_spin_lock(&rwlock->lock);
+
+	state = atomic_get(&rwlock->state);
+	if ((state == RWLOCK_WRITERS_WAITING) && hand_over(rwlock)) {
+		z_reschedule(&rwlock->lock, key);
+	} else {
+		k_spin_unlock(&rwlock->lock, key);
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_read_unlock(struct k_rwlock *rwlock)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_read_unlock(rwlock);
+}
+#include <zephyr/syscalls/k_rwlock_read_unlock_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_rwlock_write_lock(struct k_rwlock *rwlock, k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+	atomic_val_t state;
+	bool resched = false;
+	int ret;
+
+	__ASSERT(!arch_is_in_isr(), "reader-writer locks cannot be used inside ISRs");
+
+	key = k_spin_lock(&rwlock->lock);
+
+	if (rwlock->writer == _current) {
+		k_spin_unlock(&rwlock->lock, key);
+		return -EDEADLK;
+	}
+
+	for (;;) {
+		state = atomic_get(&rwlock->state);
+
+		if ((state & ~RWLOCK_WRITERS_WAITING) == 0) {
+			/* Readers may still be racing in */
+			if (atomic_cas(&rwlock->state, state, state | RWLOCK_WRITER)) {
+				rwlock->writer = _current;
+				rwlock->writer_orig_prio = _current->base.prio;
+				RWLOCK_STATS_INC(rwlock, write_locks);
+				k_spin_unlock(&rwlock->lock, key);
+				return 0;
+			}
+			continue;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			k_spin_unlock(&rwlock->lock, key);
+			return -EBUSY;
+		}
+
+		/* Keep new readers out, unless the last one just left */
+		if (((state & RWLOCK_WRITERS_WAITING) != 0) ||
+		    atomic_cas(&rwlock->state, state, state | RWLOCK_WRITERS_WAITING)) {
+			break;
+		}
+	}
+
+	RWLOCK_STATS_INC(rwlock, write_waits);
+
+	if (rwlock->writer != NULL) {
+		resched = boost_writer(rwlock, _current->base.prio);
+	}
+
+	ret = z_pend_curr(&rwlock->lock, key, &rwlock->writers_wait_q, timeout);
+	if (ret == 0) {
+		/* Handed over by hand_over() */
+		return 0;
+	}
+
+	/* timed out */
+
+	key = k_spin_lock(&rwlock->lock);
+
+	if (z_waitq_head(&rwlock->writers_wait_q) == NULL) {
+		/* Last waiting writer gone, let in the readers it kept out */
+		state = atomic_and(&rwlock->state, ~RWLOCK_WRITERS_WAITING);
+		if ((state & RWLOCK_WRITER) == 0) {
+			resched = wake_readers(rwlock) || resched;
+		}
+	}
+
+	if (rwlock->writer != NULL) {
+		resched = restore_writer_prio(rwlock) || resched;
+	}
+
+	if (resched) {
+		z_reschedule(&rwlock->lock, key);
+	} else {
+		k_spin_unlock(&rwlock->lock, key);
+	}
+
+	return -EAGAIN;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_write_lock(struct k_rwlock *rwlock, k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_write_lock(rwlock, timeout);
+}
+#include <zephyr/syscalls/k_rwlock_write_lock_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_rwlock_write_unlock(struct k_rwlock *rwlock)
+{
+	k_spinlock_key_t key;
+	bool resched = false;
+
+	__ASSERT(!arch_is_in_isr(), "reader-writer locks cannot be used inside ISRs");
+
+	key = k_spin_lock(&rwlock->lock);
+
+	if (rwlock->writer == NULL) {
+		k_spin_unlock(&rwlock->lock, key);
+		return -EINVAL;
+	}
+
+	if (rwlock->writer != _current) {
+		k_spin_unlock(&rwlock->lock, key);
+		return -EPERM;
+	}
+
+	if (_current->base.prio != rwlock->writer_orig_prio) {
+		resched = z_thread_prio_set(_current, rwlock->writer_orig_prio);
+	}
+
+	rwlock->writer = NULL;
+
+	resched = hand_over(rwlock) || resched;
+
+	if (resched) {
+		z_reschedule(&rwlock->lock, key);
+	} else {
+		k_spin_unlock(&rwlock->lock, key);
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_write_unlock(struct k_rwlock *rwlock)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_write_unlock(rwlock);
+}
+#include <zephyr/syscalls/k_rwlock_write_unlock_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+#ifdef CONFIG_OBJ_CORE_RWLOCK
+static int init_rwlock_obj_core_list(void)
+{
+	/* Initialize rwlock object type */
+
+	z_obj_type_init(&obj_type_rwlock, K_OBJ_TYPE_RWLOCK_ID,
+			offsetof(struct k_rwlock, obj_core));
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+	k_obj_type_stats_init(&obj_type_rwlock, &rwlock_stats_desc);
+#endif /* CONFIG_OBJ_CORE_STATS_RWLOCK */
+
+	/* Initialize and link statically defined rwlocks */
+
+	STRUCT_SECTION_FOREACH(k_rwlock, rwlock) {
+		k_obj_core_init_and_link(K_OBJ_CORE(rwlock), &obj_type_rwlock);
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+		k_obj_core_stats_register(K_OBJ_CORE(rwlock), &rwlock->stats,
+					  sizeof(struct k_rwlock_stats));
+#endif /* CONFIG_OBJ_CORE_STATS_RWLOCK */
+	}
+
+	return 0;
+}
+
+SYS_INIT(init_rwlock_obj_core_list, PRE_KERNEL_1,
+	 CONFIG_KERNEL_INIT_PRIORITY_OBJECTS);
+#endif /* CONFIG_OBJ_CORE_RWLOCK */
@@ -45,6 +45,105 @@ BUILD_ASSERT(CONFIG_NUM_COOP_PRIORITIES >= CONFIG_NUM_METAIRQ_PRIORITIES,
 	     "CONFIG_NUM_METAIRQ_PRIORITIES as Meta IRQs are just a special class of cooperative "
 	     "threads.");
 
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+/* All the run queues are protected by _sched_spinlock, like the thread
+ * states.  Each queue keeps its length and the priority of its head, so
+ * that picking a queue or a thread to steal does not walk the others.
+ */
+
+/* Head priority of an empty run queue */
+#define RUNQ_PRIO_EMPTY INT_MAX
+
+static ALWAYS_INLINE bool thread_runs_on(struct k_thread *thread, int cpu)
+{
+#ifdef CONFIG_SCHED_CPU_MASK
+	return (thread->base.cpu_mask & BIT(cpu)) != 0;
+#else
+	ARG_UNUSED(thread);
+	ARG_UNUSED(cpu);
+	return true;
+#endif /* CONFIG_SCHED_CPU_MASK */
+}
+
+/* Called after each change to the contents of the queue */
+static ALWAYS_INLINE void runq_update_prio(struct _ready_q *ready_q)
+{
+	struct k_thread *head = _priq_run_best(&ready_q->runq);
+
+	ready_q->best_prio = (head != NULL) ? head->base.prio : RUNQ_PRIO_EMPTY;
+}
+
+/* Picks the CPU whose run queue a newly ready thread joins: the one it
+ * last ran on, for cache affinity, unless that queue is longer than the
+ * shortest one the thread may run on by more than the configured
+ * imbalance.
+ */
+static int runq_select_cpu(struct k_thread *thread)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	int cpu = thread->base.cpu;
+	unsigned int best_len = 0;
+	int best = -1;
+
+	for (int i = 0; i < num_cpus; i++) {
+		unsigned int len = _kernel.cpus[i].ready_q.nr_ready;
+
+		if (thread_runs_on(thread, i) && ((best < 0) || (len < best_len))) {
+			best = i;
+			best_len = len;
+		}
+	}
+
+	if (best < 0) {
+		/* Legal per the API, see the PIN_ONLY variant of thread_runq() */
+		return 0;
+	}
+
+	if ((cpu < num_cpus) && thread_runs_on(thread, cpu) &&
+	    (_kernel.cpus[cpu].ready_q.nr_ready <=
+	     best_len + CONFIG_SCHED_PER_CPU_RUNQ_IMBALANCE)) {
+		return cpu;
+	}
+
+	return best;
+}
+
+/* Given the best thread of the current CPU's run queue, returns the best
+ * thread it may run from any CPU's queue.  Threads queued elsewhere are
+ * taken over only when strictly higher priority, or when the local queue
+ * is empty, so that global priority order is preserved while threads
+ * otherwise stay on the CPU they were queued on.
+ *
+ * Only queues whose head priority could beat the current candidate get
+ * inspected.
+ */
+static struct k_thread *runq_steal(struct k_thread *thread)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	int currcpu = _current_cpu->id;
+	int prio = (thread != NULL) ? thread->base.prio : RUNQ_PRIO_EMPTY;
+
+	for (int i = 0; i < num_cpus; i++) {
+		struct _ready_q *ready_q = &_kernel.cpus[i].ready_q;
+		struct k_thread *t;
+
+		if ((i == currcpu) || (ready_q->best_prio == RUNQ_PRIO_EMPTY) ||
+		    (ready_q->best_prio > prio)) {
+			continue;
+		}
+
+		t = _priq_run_best(&ready_q->runq);
+		if ((t != NULL) && thread_runs_on(t, currcpu) &&
+		    ((thread == NULL) || (z_sched_prio_cmp(t, thread) > 0))) {
+			thread = t;
+			prio = t->base.prio;
+		}
+	}
+
+	return thread;
+}
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
+
 static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 {
 #ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
@@ -59,6 +158,8 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 	cpu = m == 0 ? 0 : u32_count_trailing_zeros(m);
 
 	return &_kernel.cpus[cpu].ready_q.runq;
+#elif defined(CONFIG_SCHED_PER_CPU_RUNQ)
+	return &_kernel.cpus[thread->base.runq_cpu].ready_q.runq;
 #else
 	ARG_UNUSED(thread);
 	return &_kernel.ready_q.runq;
@@ -67,7 +168,7 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 
 static ALWAYS_INLINE void *curr_cpu_runq(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	return &arch_curr_cpu()->ready_q.runq;
 #else
 	return &_kernel.ready_q.runq;
@@ -78,24 +179,52 @@ static ALWAYS_INLINE void runq_add(struct k_thread *thread)
 {
 	__ASSERT_NO_MSG(!z_is_idle_thread_object(thread));
 
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	int cpu = runq_select_cpu(thread);
+	struct _ready_q *ready_q = &_kernel.cpus[cpu].ready_q;
+
+	thread->base.runq_cpu = cpu;
+	_priq_run_add(&ready_q->runq, thread);
+	ready_q->nr_ready++;
+	runq_update_prio(ready_q);
+#else
 	_priq_run_add(thread_runq(thread), thread);
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
 }
 
 static ALWAYS_INLINE void runq_remove(struct k_thread *thread)
 {
 	__ASSERT_NO_MSG(!z_is_idle_thread_object(thread));
 
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	int cpu = thread->base.runq_cpu;
+	struct _ready_q *ready_q = &_kernel.cpus[cpu].ready_q;
+
+	_priq_run_remove(&ready_q->runq, thread);
+	ready_q->nr_ready--;
+	runq_update_prio(ready_q);
+#else
 	_priq_run_remove(thread_runq(thread), thread);
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
 }
 
 static ALWAYS_INLINE void runq_yield(void)
 {
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
 	_priq_run_yield(curr_cpu_runq());
+	runq_update_prio(&_current_cpu->ready_q);
+#else
+	_priq_run_yield(curr_cpu_runq());
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
 }
 
 static ALWAYS_INLINE struct k_thread *runq_best(void)
 {
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	return runq_steal(_priq_run_best(curr_cpu_runq()));
+#else
 	return _priq_run_best(curr_cpu_runq());
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
 }
 
 /* _current is never in the run queue until context switch on
@@ -940,14 +1069,72 @@ int z_unpend_all(_wait_q_t *wait_q)
 	return need_sched;
 }
 
+unsigned int z_unpend_n(_wait_q_t *wait_q, unsigned int n, int swap_retval)
+{
+	unsigned int woken = 0U;
+	struct k_thread *thread;
+
+	/* One scheduler lock round trip for the whole batch; ready_thread()
+	 * only flags the IPIs, which go out together on the caller's next
+	 * reschedule.
+	 */
+	K_SPINLOCK(&_sched_spinlock) {
+		while (woken < n) {
+			thread = _priq_wait_best(&wait_q->waitq);
+			if (thread == NULL) {
+				break;
+			}
+
+			unpend_thread_no_timeout(thread);
+			z_abort_thread_timeout(thread);
+			arch_thread_return_value_set(thread, swap_retval);
+			if (thread_active_elsewhere(thread) == NULL) {
+				ready_thread(thread);
+			}
+			woken++;
+		}
+	}
+
+	return woken;
+}
+
+unsigned int z_requeue_n(_wait_q_t *wait_q, _wait_q_t *target, unsigned int n)
+{
+	unsigned int moved = 0U;
+	struct k_thread *thread;
+
+	/* Threads stay pending with their timeouts armed, only the wait
+	 * queue they will be woken up from changes.
+	 */
+	K_SPINLOCK(&_sched_spinlock) {
+		while (moved < n) {
+			thread = _priq_wait_best(&wait_q->waitq);
+			if (thread == NULL) {
+				break;
+			}
+
+			_priq_wait_remove(&wait_q->waitq, thread);
+			thread->base.pended_on = target;
+			_priq_wait_add(&target->waitq, thread);
+			moved++;
+		}
+	}
+
+	return moved;
+}
+
 void init_ready_q(struct _ready_q *ready_q)
 {
 	_priq_run_init(&ready_q->runq);
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	ready_q->nr_ready = 0;
+	ready_q->best_prio = RUNQ_PRIO_EMPTY;
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
 }
 
 void z_sched_init(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
 		init_ready_q(&_kernel.cpus[i].ready_q);
 	}
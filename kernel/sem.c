@@ -129,6 +129,43 @@ static inline void z_vrfy_k_sem_give(struct k_sem *sem)
 #include <zephyr/syscalls/k_sem_give_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+void z_impl_k_sem_give_n(struct k_sem *sem, unsigned int count)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	unsigned int woken;
+	bool resched;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_sem, give_n, sem, count);
+
+	/* Wake all the waiters the units can satisfy at once, so that they
+	 * cost a single reschedule instead of one per k_sem_give().
+	 */
+	woken = z_unpend_n(&sem->wait_q, count, 0);
+	resched = (woken != 0U);
+
+	if (count > woken) {
+		sem->count += MIN(count - woken, sem->limit - sem->count);
+		resched = handle_poll_events(sem) || resched;
+	}
+
+	if (resched) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_sem, give_n, sem, count);
+}
+
+#ifdef CONFIG_USERSPACE
+static inline void z_vrfy_k_sem_give_n(struct k_sem *sem, unsigned int count)
+{
+	K_OOPS(K_SYSCALL_OBJ(sem, K_OBJ_SEM));
+	z_impl_k_sem_give_n(sem, count);
+}
+#include <zephyr/syscalls/k_sem_give_n_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
 int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 {
 	int ret;
@@ -19,6 +19,14 @@ static K_KERNEL_STACK_DEFINE(sys_work_q_stack,
 
 struct k_work_q k_sys_work_q;
 
+#if defined(CONFIG_SYSTEM_WORKQUEUE_WORKERS) && (CONFIG_SYSTEM_WORKQUEUE_WORKERS > 1)
+#define NUM_EXTRA_WORKERS (CONFIG_SYSTEM_WORKQUEUE_WORKERS - 1)
+
+static K_KERNEL_STACK_ARRAY_DEFINE(sys_work_q_worker_stacks, NUM_EXTRA_WORKERS,
+				   CONFIG_SYSTEM_WORKQUEUE_STACK_SIZE);
+static struct k_work_q_worker sys_work_q_workers[NUM_EXTRA_WORKERS];
+#endif /* CONFIG_SYSTEM_WORKQUEUE_WORKERS > 1 */
+
 static int k_sys_work_q_init(void)
 {
 	static const struct k_work_queue_config cfg = {
@@ -26,12 +34,26 @@ static int k_sys_work_q_init(void)
 		.no_yield = IS_ENABLED(CONFIG_SYSTEM_WORKQUEUE_NO_YIELD),
 		.essential = true,
 		.work_timeout_ms = CONFIG_SYSTEM_WORKQUEUE_WORK_TIMEOUT_MS,
+#ifdef NUM_EXTRA_WORKERS
+		.workers = sys_work_q_workers,
+		.num_workers = NUM_EXTRA_WORKERS,
+#endif /* NUM_EXTRA_WORKERS */
 	};
 
+#ifdef NUM_EXTRA_WORKERS
+	for (int i = 0; i < NUM_EXTRA_WORKERS; i++) {
+		sys_work_q_workers[i].stack = sys_work_q_worker_stacks[i];
+		sys_work_q_workers[i].stack_size =
+			K_KERNEL_STACK_SIZEOF(sys_work_q_worker_stacks[i]);
+		sys_work_q_workers[i].cpu = -1;
+	}
+#endif /* NUM_EXTRA_WORKERS */
+
 	k_work_queue_start(&k_sys_work_q,
 			    sys_work_q_stack,
 			    K_KERNEL_STACK_SIZEOF(sys_work_q_stack),
 			    CONFIG_SYSTEM_WORKQUEUE_PRIORITY, &cfg);
+
 	return 0;
 }
 
@@ -11,10 +11,93 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/drivers/timer/system_timer.h>
 #include <zephyr/sys_clock.h>
+#include <zephyr/sys/math_extras.h>
+#include <zephyr/sys/barrier.h>
 
 static uint64_t curr_tick;
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+/*
+ * Hierarchical timing wheel.  Each level has 64 slots, level N slots
+ * spanning 64^N ticks.  A timeout is filed at the lowest level whose
+ * higher-order digits of its expiry tick match those of curr_tick, so
+ * every occupied slot lies strictly ahead of the current position.
+ * When curr_tick reaches the start of an occupied slot at level N > 0
+ * its timeouts are cascaded into the lower levels.  Timeouts beyond
+ * the reach of the top level wait in an unsorted overflow list which
+ * is refiled each time the top level wraps.
+ *
+ * In this mode _timeout.dticks holds the absolute expiry tick.
+ */
+#define WHEEL_BITS   6
+#define WHEEL_SLOTS  BIT(WHEEL_BITS)
+#define WHEEL_MASK   (WHEEL_SLOTS - 1)
+#define WHEEL_LEVELS CONFIG_TIMEOUT_WHEEL_LEVELS
+
+static struct {
+	/* Slot lists are lazily initialized on first insertion, the
+	 * occupied bitmask is authoritative for emptiness.
+	 */
+	sys_dlist_t slots[WHEEL_LEVELS][WHEEL_SLOTS];
+	uint64_t occupied[WHEEL_LEVELS];
+} wheel;
+
+static sys_dlist_t wheel_overflow = SYS_DLIST_STATIC_INIT(&wheel_overflow);
+#elif defined(CONFIG_TIMEOUT_QUEUE_PER_CPU)
+/*
+ * Per-CPU timeout queues.  A timeout is armed on the queue of the CPU
+ * arming it, which records its index in _timeout.cpu, so arming and
+ * aborting only contend on that queue's lock.  Each queue is sorted by
+ * absolute expiry tick, which in this mode is what _timeout.dticks
+ * holds.
+ *
+ * timeout_lock only serializes the writers of curr_tick, which is also
+ * published through a sequence counter so that arming a timeout reads
+ * it without the lock.  sys_clock_announce() holds it just to advance
+ * time.  Each CPU then runs the expired timeouts of its
+ * own queue under that queue's lock, and of the queues of other CPUs
+ * which are due and not being run already, so that timeouts armed by
+ * a CPU which went idle still fire.  Timeouts of one queue expire in
+ * order, timeouts of different queues may expire concurrently.
+ *
+ * The expiry of the head of each queue is published through a
+ * sequence counter, so that computing the next system timer event
+ * does not take the queue locks.
+ *
+ * Lock order is timeout_lock, then a queue lock.  No two queue locks
+ * are ever held at once.
+ */
+struct timeout_q {
+	struct k_spinlock lock;
+	sys_dlist_t list;
+	/* Expiry of the head, UINT64_MAX when empty, see q_next() */
+	uint64_t next;
+	atomic_t next_seq;
+	/* Set while a CPU runs the expired timeouts of the queue */
+	bool draining;
+};
+
+#define TIMEOUT_Q_INIT(i, _) {					\
+	.list = SYS_DLIST_STATIC_INIT(&timeout_q[i].list),	\
+	.next = UINT64_MAX,					\
+}
+
+static struct timeout_q timeout_q[CONFIG_MP_MAX_NUM_CPUS] = {
+	LISTIFY(CONFIG_MP_MAX_NUM_CPUS, TIMEOUT_Q_INIT, (,))
+};
+
+static atomic_t curr_tick_seq;
+
+/* Expiry tick of the timeout each CPU is running the callback of, new
+ * relative timeouts armed from the callback are relative to it.
+ */
+static struct {
+	uint64_t tick;
+	bool firing;
+} cpu_fire[CONFIG_MP_MAX_NUM_CPUS];
+#else
 static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 
 /*
  * The timeout code shall take no locks other than its own (timeout_lock), nor
@@ -40,6 +123,259 @@ static inline unsigned int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+static inline int wheel_level(uint64_t expiry)
+{
+	uint64_t diff = expiry ^ curr_tick;
+
+	if (diff == 0U) {
+		return 0;
+	}
+
+	return MIN((63 - u64_count_leading_zeros(diff)) / WHEEL_BITS, WHEEL_LEVELS);
+}
+
+static inline unsigned int wheel_slot(uint64_t expiry, int level)
+{
+	return (expiry >> (WHEEL_BITS * level)) & WHEEL_MASK;
+}
+
+static void wheel_insert(struct _timeout *t)
+{
+	uint64_t expiry = t->dticks;
+	int level = wheel_level(expiry);
+	unsigned int slot;
+	sys_dlist_t *list;
+
+	if (level == WHEEL_LEVELS) {
+		sys_dlist_append(&wheel_overflow, &t->node);
+		return;
+	}
+
+	slot = wheel_slot(expiry, level);
+	list = &wheel.slots[level][slot];
+	if (list->head == NULL) {
+		sys_dlist_init(list);
+	}
+	sys_dlist_append(list, &t->node);
+	wheel.occupied[level] |= BIT64(slot);
+}
+
+static void remove_timeout(struct _timeout *t)
+{
+	uint64_t expiry = t->dticks;
+	int level = wheel_level(expiry);
+	unsigned int slot;
+
+	sys_dlist_remove(&t->node);
+
+	if (level < WHEEL_LEVELS) {
+		slot = wheel_slot(expiry, level);
+		if (sys_dlist_is_empty(&wheel.slots[level][slot])) {
+			wheel.occupied[level] &= ~BIT64(slot);
+		}
+	}
+}
+
+/* Absolute tick of the next point at which the wheel needs service:
+ * either a level 0 expiry or the start of an occupied higher-level slot
+ * (or of the next top level wrap if the overflow list is populated).
+ * Levels are ordered, so the first non-empty one wins.
+ */
+static uint64_t wheel_next_event(void)
+{
+	for (int level = 0; level < WHEEL_LEVELS; level++) {
+		uint64_t occupied = wheel.occupied[level];
+		unsigned int shift = WHEEL_BITS * level;
+
+		if (occupied != 0U) {
+			uint64_t base = (curr_tick >> (shift + WHEEL_BITS)) << WHEEL_BITS;
+
+			return (base | u64_count_trailing_zeros(occupied)) << shift;
+		}
+	}
+
+	if (!sys_dlist_is_empty(&wheel_overflow)) {
+		unsigned int shift = WHEEL_BITS * WHEEL_LEVELS;
+
+		return ((curr_tick >> shift) + 1U) << shift;
+	}
+
+	return UINT64_MAX;
+}
+
+static void wheel_refile(sys_dlist_t *list)
+{
+	sys_dnode_t *node;
+
+	while ((node = sys_dlist_get(list)) != NULL) {
+		wheel_insert(CONTAINER_OF(node, struct _timeout, node));
+	}
+}
+
+/* Called with curr_tick sitting on a service point returned by
+ * wheel_next_event().  Refiling never lands a timeout in a slot at the
+ * current position of a level above 0, so one top-down pass suffices.
+ */
+static void wheel_cascade(void)
+{
+	unsigned int shift = WHEEL_BITS * WHEEL_LEVELS;
+
+	if (((curr_tick & (BIT64(shift) - 1U)) == 0U) &&
+	    !sys_dlist_is_empty(&wheel_overflow)) {
+		sys_dlist_t pending = SYS_DLIST_STATIC_INIT(&pending);
+		sys_dnode_t *node;
+
+		while ((node = sys_dlist_get(&wheel_overflow)) != NULL) {
+			sys_dlist_append(&pending, node);
+		}
+		wheel_refile(&pending);
+	}
+
+	for (int level = WHEEL_LEVELS - 1; level > 0; level--) {
+		unsigned int slot = wheel_slot(curr_tick, level);
+
+		if ((wheel.occupied[level] & BIT64(slot)) != 0U) {
+			wheel.occupied[level] &= ~BIT64(slot);
+			wheel_refile(&wheel.slots[level][slot]);
+		}
+	}
+}
+
+/* Returns a timeout expiring at exactly curr_tick, if any */
+static struct _timeout *wheel_expired(void)
+{
+	unsigned int slot = wheel_slot(curr_tick, 0);
+
+	if ((wheel.occupied[0] & BIT64(slot)) == 0U) {
+		return NULL;
+	}
+
+	return CONTAINER_OF(sys_dlist_peek_head(&wheel.slots[0][slot]),
+			    struct _timeout, node);
+}
+
+/* Ticks from curr_tick until the wheel next needs service */
+static int64_t first_dticks(void)
+{
+	uint64_t next = wheel_next_event();
+
+	return (next == UINT64_MAX) ? INT64_MAX : (int64_t)(next - curr_tick);
+}
+#elif defined(CONFIG_TIMEOUT_QUEUE_PER_CPU)
+static struct _timeout *q_first(struct timeout_q *q)
+{
+	sys_dnode_t *t = sys_dlist_peek_head(&q->list);
+
+	return (t == NULL) ? NULL : CONTAINER_OF(t, struct _timeout, node);
+}
+
+/* Must be called with the queue lock held, which serializes writers */
+static void q_update_next(struct timeout_q *q)
+{
+	struct _timeout *t = q_first(q);
+
+	(void)atomic_inc(&q->next_seq);
+	q->next = (t == NULL) ? UINT64_MAX : (uint64_t)t->dticks;
+	(void)atomic_inc(&q->next_seq);
+}
+
+/* Lock-free read of the expiry of the head of a queue.  A writer holds
+ * the queue lock with interrupts masked, so the retry loop is short and
+ * cannot be entered on the CPU of the writer.
+ */
+static uint64_t q_next(struct timeout_q *q)
+{
+	atomic_val_t seq;
+	uint64_t next;
+
+	do {
+		seq = atomic_get(&q->next_seq);
+		next = q->next;
+		barrier_dmem_fence_full();
+	} while (((seq & 1) != 0) || (atomic_get(&q->next_seq) != seq));
+
+	return next;
+}
+
+static void q_insert(struct timeout_q *q, struct _timeout *to)
+{
+	struct _timeout *t;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&q->list, t, node) {
+		if (t->dticks > to->dticks) {
+			sys_dlist_insert(&t->node, &to->node);
+			return;
+		}
+	}
+
+	sys_dlist_append(&q->list, &to->node);
+}
+
+/* Locks the queue a timeout is (or was last) filed on */
+static struct timeout_q *q_lock_owner(const struct _timeout *to, k_spinlock_key_t *key)
+{
+	struct timeout_q *q;
+
+	for (;;) {
+		q = &timeout_q[to->cpu];
+		*key = k_spin_lock(&q->lock);
+		if (q == &timeout_q[to->cpu]) {
+			return q;
+		}
+		k_spin_unlock(&q->lock, *key);
+	}
+}
+
+static void remove_timeout(struct _timeout *t)
+{
+	sys_dlist_remove(&t->node);
+}
+
+/* Must be called with timeout_lock held, which serializes writers */
+static void tick_set(uint64_t tick)
+{
+	(void)atomic_inc(&curr_tick_seq);
+	curr_tick = tick;
+	(void)atomic_inc(&curr_tick_seq);
+}
+
+/* Lock-free read of curr_tick, plus the ticks elapsed since it was last
+ * announced if @a with_elapsed, both being read consistently.
+ */
+static uint64_t tick_get(bool with_elapsed)
+{
+	atomic_val_t seq;
+	uint64_t tick;
+
+	do {
+		seq = atomic_get(&curr_tick_seq);
+		tick = curr_tick;
+		if (with_elapsed) {
+			tick += sys_clock_elapsed();
+		}
+		barrier_dmem_fence_full();
+	} while (((seq & 1) != 0) || (atomic_get(&curr_tick_seq) != seq));
+
+	return tick;
+}
+
+static int64_t first_dticks(void)
+{
+	uint64_t next = UINT64_MAX;
+
+	for (unsigned int i = 0; i < ARRAY_SIZE(timeout_q); i++) {
+		next = MIN(next, q_next(&timeout_q[i]));
+	}
+
+	if (next == UINT64_MAX) {
+		return INT64_MAX;
+	}
+
+	/* Expired timeouts not run yet are due now */
+	return (next > curr_tick) ? (int64_t)(next - curr_tick) : 0;
+}
+#else
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -63,6 +399,14 @@ static void remove_timeout(struct _timeout *t)
 	sys_dlist_remove(&t->node);
 }
 
+static int64_t first_dticks(void)
+{
+	struct _timeout *to = first();
+
+	return (to == NULL) ? INT64_MAX : to->dticks;
+}
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
 static int32_t elapsed(void)
 {
 	/* While sys_clock_announce() is executing, new relative timeouts will be
@@ -86,19 +430,20 @@ static int32_t elapsed(void)
 
 static int32_t next_timeout(int32_t ticks_elapsed)
 {
-	struct _timeout *to = first();
+	int64_t dticks = first_dticks();
 	int32_t ret;
 
-	if ((to == NULL) ||
-	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
+	if ((dticks == INT64_MAX) ||
+	    ((dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
 		ret = MAX_WAIT;
 	} else {
-		ret = MAX(0, to->dticks - ticks_elapsed);
+		ret = MAX(0, dticks - ticks_elapsed);
 	}
 
 	return ret;
 }
 
+#ifndef CONFIG_TIMEOUT_QUEUE_PER_CPU
 k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t timeout)
 {
 	k_ticks_t ticks = 0;
@@ -115,9 +460,9 @@ k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t tim
 	to->fn = fn;
 
 	K_SPINLOCK(&timeout_lock) {
-		struct _timeout *t;
 		int32_t ticks_elapsed;
 		bool has_elapsed = false;
+		bool is_first;
 
 		if (Z_IS_TIMEOUT_RELATIVE(timeout)) {
 			ticks_elapsed = elapsed();
@@ -131,6 +476,15 @@ k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t tim
 			ticks = timeout.ticks;
 		}
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+		uint64_t prev_event = wheel_next_event();
+
+		to->dticks += curr_tick;
+		wheel_insert(to);
+		is_first = (wheel_next_event() != prev_event);
+#else
+		struct _timeout *t;
+
 		for (t = first(); t != NULL; t = next(t)) {
 			if (t->dticks > to->dticks) {
 				t->dticks -= to->dticks;
@@ -144,7 +498,10 @@ k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t tim
 			sys_dlist_append(&timeout_list, &to->node);
 		}
 
-		if (to == first() && announce_remaining == 0) {
+		is_first = (to == first());
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
+		if (is_first && announce_remaining == 0) {
 			if (!has_elapsed) {
 				/* In case of absolute timeout that is first to expire
 				 * elapsed need to be read from the system clock.
@@ -164,9 +521,16 @@ int z_abort_timeout(struct _timeout *to)
 
 	K_SPINLOCK(&timeout_lock) {
 		if (sys_dnode_is_linked(&to->node)) {
-			bool is_first = (to == first());
+			bool is_first;
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+			uint64_t prev_event = wheel_next_event();
 
 			remove_timeout(to);
+			is_first = (wheel_next_event() != prev_event);
+#else
+			is_first = (to == first());
+			remove_timeout(to);
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 			to->dticks = TIMEOUT_DTICKS_ABORTED;
 			ret = 0;
 			if (is_first) {
@@ -177,10 +541,119 @@ int z_abort_timeout(struct _timeout *to)
 
 	return ret;
 }
+#else
+k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t timeout)
+{
+	struct timeout_q *q;
+	k_spinlock_key_t key;
+	unsigned int irq_key;
+	unsigned int cpu;
+	k_ticks_t ticks;
+	bool firing;
+	bool is_first;
+
+	if (K_TIMEOUT_EQ(timeout, K_FOREVER)) {
+		return 0;
+	}
+
+#ifdef CONFIG_KERNEL_COHERENCE
+	__ASSERT_NO_MSG(arch_mem_coherent(to));
+#endif /* CONFIG_KERNEL_COHERENCE */
+
+	__ASSERT(!sys_dnode_is_linked(&to->node), "");
+	to->fn = fn;
+
+	/* Stay on this CPU until the timeout is filed on its queue */
+	irq_key = arch_irq_lock();
+	cpu = arch_curr_cpu()->id;
+	firing = cpu_fire[cpu].firing;
+
+	if (Z_IS_TIMEOUT_RELATIVE(timeout)) {
+		uint64_t base = firing ? cpu_fire[cpu].tick : tick_get(true);
+
+		to->dticks = base + timeout.ticks + 1;
+		ticks = to->dticks;
+	} else {
+		uint64_t now = tick_get(false);
+		k_ticks_t dticks = Z_TICK_ABS(timeout.ticks) - now;
+
+		to->dticks = now + MAX(1, dticks);
+		ticks = timeout.ticks;
+	}
+
+	q = &timeout_q[cpu];
+	key = k_spin_lock(&q->lock);
+
+	to->cpu = cpu;
+	q_insert(q, to);
+	is_first = (to == q_first(q));
+	if (is_first) {
+		q_update_next(q);
+	}
+
+	k_spin_unlock(&q->lock, key);
+	arch_irq_unlock(irq_key);
+
+	/* Only a new head of a queue can move the next expiry, a CPU running
+	 * expired timeouts reprograms the timer when done.
+	 */
+	if (is_first && !firing) {
+		K_SPINLOCK(&timeout_lock) {
+			sys_clock_set_timeout(next_timeout(elapsed()), false);
+		}
+	}
+
+	return ticks;
+}
+
+int z_abort_timeout(struct _timeout *to)
+{
+	struct timeout_q *q;
+	k_spinlock_key_t key;
+	bool is_first = false;
+	int ret = -EINVAL;
+
+	q = q_lock_owner(to, &key);
+	if (sys_dnode_is_linked(&to->node)) {
+		is_first = (to == q_first(q));
+		remove_timeout(to);
+		if (is_first) {
+			q_update_next(q);
+		}
+		to->dticks = TIMEOUT_DTICKS_ABORTED;
+		ret = 0;
+	}
+	k_spin_unlock(&q->lock, key);
+
+	if (is_first) {
+		K_SPINLOCK(&timeout_lock) {
+			sys_clock_set_timeout(next_timeout(elapsed()), false);
+		}
+	}
+
+	return ret;
+}
+#endif /* !CONFIG_TIMEOUT_QUEUE_PER_CPU */
 
 /* must be locked */
 static k_ticks_t timeout_rem(const struct _timeout *timeout)
 {
+#if defined(CONFIG_TIMEOUT_QUEUE_WHEEL)
+	return (k_ticks_t)((uint64_t)timeout->dticks - curr_tick);
+#elif defined(CONFIG_TIMEOUT_QUEUE_PER_CPU)
+	/* Aborting only takes the owning queue's lock */
+	k_ticks_t ticks = 0;
+	struct timeout_q *q;
+	k_spinlock_key_t key;
+
+	q = q_lock_owner(timeout, &key);
+	if (sys_dnode_is_linked(&timeout->node)) {
+		ticks = (k_ticks_t)((uint64_t)timeout->dticks - curr_tick);
+	}
+	k_spin_unlock(&q->lock, key);
+
+	return ticks;
+#else
 	k_ticks_t ticks = 0;
 
 	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
@@ -191,6 +664,7 @@ static k_ticks_t timeout_rem(const struct _timeout *timeout)
 	}
 
 	return ticks;
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 }
 
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
@@ -230,6 +704,74 @@ int32_t z_get_next_timeout_expiry(void)
 	return ret;
 }
 
+#ifdef CONFIG_TIMEOUT_QUEUE_PER_CPU
+/* Runs the timeouts of a queue due at or before @a now on this CPU,
+ * unless another CPU is already doing so.
+ */
+static void q_drain(struct timeout_q *q, unsigned int cpu, uint64_t now)
+{
+	k_spinlock_key_t key = k_spin_lock(&q->lock);
+	struct _timeout *t;
+
+	if (q->draining) {
+		/* The timer is reprogrammed for anything it leaves behind */
+		k_spin_unlock(&q->lock, key);
+		return;
+	}
+
+	q->draining = true;
+
+	while (((t = q_first(q)) != NULL) && ((uint64_t)t->dticks <= now)) {
+		remove_timeout(t);
+		q_update_next(q);
+
+		cpu_fire[cpu].tick = t->dticks;
+		cpu_fire[cpu].firing = true;
+		t->dticks = 0;
+
+		k_spin_unlock(&q->lock, key);
+		t->fn(t);
+		key = k_spin_lock(&q->lock);
+	}
+
+	cpu_fire[cpu].firing = false;
+	q->draining = false;
+
+	k_spin_unlock(&q->lock, key);
+}
+
+void sys_clock_announce(int32_t ticks)
+{
+	k_spinlock_key_t key;
+	unsigned int cpu;
+	uint64_t now;
+
+	/* Called from the timer interrupt, so this stays on one CPU while
+	 * the callbacks run with interrupts enabled.
+	 */
+	key = k_spin_lock(&timeout_lock);
+	cpu = arch_curr_cpu()->id;
+	tick_set(curr_tick + ticks);
+	now = curr_tick;
+	k_spin_unlock(&timeout_lock, key);
+
+	q_drain(&timeout_q[cpu], cpu, now);
+
+	for (unsigned int i = 0; i < ARRAY_SIZE(timeout_q); i++) {
+		if ((i != cpu) && (q_next(&timeout_q[i]) <= now)) {
+			q_drain(&timeout_q[i], cpu, now);
+		}
+	}
+
+	K_SPINLOCK(&timeout_lock) {
+		sys_clock_set_timeout(next_timeout(elapsed()), false);
+	}
+
+#ifdef CONFIG_TIMESLICING
+	z_time_slice();
+#endif /* CONFIG_TIMESLICING */
+}
+#else
 void sys_clock_announce(int32_t ticks)
 {
 	k_spinlock_key_t key = k_spin_lock(&timeout_lock);
@@ -248,6 +790,28 @@ void sys_clock_announce(int32_t ticks)
 
 	announce_remaining = ticks;
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	for (uint64_t next = wheel_next_event();
+	     next <= curr_tick + announce_remaining;
+	     next = wheel_next_event()) {
+		int dt = next - curr_tick;
+		struct _timeout *t;
+
+		curr_tick = next;
+		wheel_cascade();
+
+		while ((t = wheel_expired()) != NULL) {
+			remove_timeout(t);
+			t->dticks = 0;
+
+			k_spin_unlock(&timeout_lock, key);
+			t->fn(t);
+			key = k_spin_lock(&timeout_lock);
+		}
+
+		announce_remaining -= dt;
+	}
+#else
 	struct _timeout *t;
 
 	for (t = first();
@@ -268,6 +832,7 @@ void sys_clock_announce(int32_t ticks)
 	if (t != NULL) {
 		t->dticks -= announce_remaining;
 	}
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 
 	curr_tick += announce_remaining;
 	announce_remaining = 0;
@@ -280,6 +845,7 @@ void sys_clock_announce(int32_t ticks)
 	z_time_slice();
 #endif /* CONFIG_TIMESLICING */
 }
+#endif /* CONFIG_TIMEOUT_QUEUE_PER_CPU */
 
 int64_t sys_clock_tick_get(void)
 {
@@ -353,7 +919,56 @@ k_timeout_t sys_timepoint_timeout(k_timepoint_t timepoint)
 #ifdef CONFIG_ZTEST
 void z_impl_sys_clock_tick_set(uint64_t tick)
 {
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	K_SPINLOCK(&timeout_lock) {
+		sys_dlist_t pending = SYS_DLIST_STATIC_INIT(&pending);
+		struct _timeout *t;
+		sys_dnode_t *node;
+
+		/* Keep pending timeouts relative to the new tick value and
+		 * refile them, their wheel positions depend on curr_tick.
+		 */
+		for (int level = 0; level < WHEEL_LEVELS; level++) {
+			for (int slot = 0; slot < WHEEL_SLOTS; slot++) {
+				if ((wheel.occupied[level] & BIT64(slot)) == 0U) {
+					continue;
+				}
+				while ((node = sys_dlist_get(&wheel.slots[level][slot])) != NULL) {
+					sys_dlist_append(&pending, node);
+				}
+			}
+			wheel.occupied[level] = 0U;
+		}
+		while ((node = sys_dlist_get(&wheel_overflow)) != NULL) {
+			sys_dlist_append(&pending, node);
+		}
+
+		SYS_DLIST_FOR_EACH_CONTAINER(&pending, t, node) {
+			t->dticks += tick - curr_tick;
+		}
+
+		curr_tick = tick;
+		wheel_refile(&pending);
+	}
+#elif defined(CONFIG_TIMEOUT_QUEUE_PER_CPU)
+	K_SPINLOCK(&timeout_lock) {
+		/* Keep pending timeouts relative to the new tick value */
+		for (unsigned int i = 0; i < ARRAY_SIZE(timeout_q); i++) {
+			K_SPINLOCK(&timeout_q[i].lock) {
+				struct _timeout *t;
+
+				SYS_DLIST_FOR_EACH_CONTAINER(&timeout_q[i].list, t, node) {
+					t->dticks += tick - curr_tick;
+				}
+				q_update_next(&timeout_q[i]);
+			}
+		}
+
+		tick_set(tick);
+	}
+#else
 	curr_tick = tick;
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 }
 
 void z_vrfy_sys_clock_tick_set(uint64_t tick)
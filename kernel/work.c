@@ -192,6 +192,9 @@ static void queue_flusher_locked(struct k_work_q *queue,
 				 struct z_work_flusher *flusher)
 {
 	init_flusher(flusher);
+#ifdef CONFIG_WORKQUEUE_POOL
+	flusher->target = work;
+#endif /* CONFIG_WORKQUEUE_POOL */
 
 	if ((flags_get(&work->flags) & K_WORK_QUEUED) != 0U) {
 		sys_slist_insert(&queue->pending, &work->node,
@@ -216,6 +219,198 @@ static inline void queue_remove_locked(struct k_work_q *queue,
 	}
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+static void work_queue_main(void *workq_ptr, void *p2, void *p3);
+
+/* Take the next work item a thread of the queue may run.
+ *
+ * Invoked with work lock held.
+ *
+ * Items are taken in order, skipping those run by another thread of the
+ * queue: an item submitted again while running stays queued until its
+ * handler returns.  A flusher is skipped while its work item runs; if the
+ * item is queued ahead of the flusher it is taken first.
+ *
+ * @param queue the queue from which to take work
+ *
+ * @return the node of the work item, or NULL if none may run
+ */
+static sys_snode_t *queue_get_locked(struct k_work_q *queue)
+{
+	sys_snode_t *prev = NULL;
+	struct k_work *work;
+	struct k_work *running;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&queue->pending, work, node) {
+		running = work;
+		if (flag_test(&work->flags, K_WORK_FLUSHING_BIT)) {
+			running = CONTAINER_OF(work, struct z_work_flusher, work)->target;
+		}
+
+		if (!flag_test(&running->flags, K_WORK_RUNNING_BIT)) {
+			sys_slist_remove(&queue->pending, prev, &work->node);
+			return &work->node;
+		}
+
+		prev = &work->node;
+	}
+
+	return NULL;
+}
+
+/* Test whether a thread animates a queue.
+ *
+ * Invoked with work lock held.
+ */
+static bool queue_thread_locked(struct k_work_q *queue, struct k_thread *thread)
+{
+	struct k_work_q_worker *worker;
+
+	if (thread == queue->thread_id) {
+		return true;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&queue->workers, worker, node) {
+		if (thread == &worker->thread) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static inline void queue_busy_locked(struct k_work_q *queue)
+{
+	queue->num_busy++;
+	flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+}
+
+static inline void queue_idle_locked(struct k_work_q *queue)
+{
+	queue->num_busy--;
+	if (queue->num_busy == 0U) {
+		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+	}
+}
+
+/* Account for a thread leaving a stopping queue.
+ *
+ * Invoked with work lock held.
+ *
+ * @return true if it was the last thread of the queue
+ */
+static inline bool queue_exit_locked(struct k_work_q *queue)
+{
+	queue->num_threads--;
+
+	return queue->num_threads == 0U;
+}
+
+static inline void queue_threads_init(struct k_work_q *queue)
+{
+	sys_slist_init(&queue->workers);
+	queue->num_threads = 1U;
+	queue->num_busy = 0U;
+}
+
+/* Start the additional threads of a queue.
+ *
+ * The queue state must be in place, the threads take items as soon as
+ * they are started.
+ *
+ * @param queue the queue the threads process
+ * @param cfg configuration listing the threads, may be NULL
+ * @param prio priority of the threads
+ */
+static void queue_workers_start(struct k_work_q *queue,
+				const struct k_work_queue_config *cfg, int prio)
+{
+	struct k_work_q_worker *worker;
+	k_spinlock_key_t key;
+
+	if ((cfg == NULL) || (cfg->num_workers == 0U)) {
+		return;
+	}
+
+	__ASSERT_NO_MSG(cfg->workers != NULL);
+
+	for (size_t i = 0; i < cfg->num_workers; i++) {
+		worker = &cfg->workers[i];
+
+		__ASSERT_NO_MSG(worker->stack != NULL);
+		__ASSERT((worker->cpu < 0) ||
+			 (IS_ENABLED(CONFIG_SCHED_CPU_MASK) &&
+			  (worker->cpu < (int)arch_num_cpus())),
+			 "cannot pin work queue thread to CPU %d", worker->cpu);
+
+		key = k_spin_lock(&lock);
+		sys_slist_append(&queue->workers, &worker->node);
+		queue->num_threads++;
+		k_spin_unlock(&lock, key);
+
+		(void)k_thread_create(&worker->thread, worker->stack, worker->stack_size,
+				      work_queue_main, queue, NULL, NULL,
+				      prio, 0, K_FOREVER);
+
+		if (cfg->name != NULL) {
+			(void)k_thread_name_set(&worker->thread, cfg->name);
+		}
+
+		if (cfg->essential) {
+			worker->thread.base.user_options |= K_ESSENTIAL;
+		}
+
+#ifdef CONFIG_SCHED_CPU_MASK
+		if (worker->cpu >= 0) {
+			(void)k_thread_cpu_pin(&worker->thread, worker->cpu);
+		}
+#endif /* CONFIG_SCHED_CPU_MASK */
+
+		k_thread_start(&worker->thread);
+	}
+}
+#else
+static inline sys_snode_t *queue_get_locked(struct k_work_q *queue)
+{
+	return sys_slist_get(&queue->pending);
+}
+
+static inline bool queue_thread_locked(struct k_work_q *queue, struct k_thread *thread)
+{
+	return thread == queue->thread_id;
+}
+
+static inline void queue_busy_locked(struct k_work_q *queue)
+{
+	flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+}
+
+static inline void queue_idle_locked(struct k_work_q *queue)
+{
+	flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+}
+
+static inline bool queue_exit_locked(struct k_work_q *queue)
+{
+	ARG_UNUSED(queue);
+
+	return true;
+}
+
+static inline void queue_threads_init(struct k_work_q *queue)
+{
+	ARG_UNUSED(queue);
+}
+
+static inline void queue_workers_start(struct k_work_q *queue,
+				       const struct k_work_queue_config *cfg, int prio)
+{
+	ARG_UNUSED(queue);
+	ARG_UNUSED(cfg);
+	ARG_UNUSED(prio);
+}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 /* Potentially notify a queue that it needs to look for pending work.
  *
  * This may make the work queue thread ready, but as the lock is held it
@@ -265,7 +460,7 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	}
 
 	int ret;
-	bool chained = (_current == queue->thread_id) && !k_is_in_isr();
+	bool chained = queue_thread_locked(queue, _current) && !k_is_in_isr();
 	bool draining = flag_test(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 	bool plugged = flag_test(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
 
@@ -630,7 +825,7 @@ static void work_timeout_handler(struct _timeout *record)
 
 static void work_timeout_start_locked(struct k_work_q *queue, struct k_work *work)
 {
-	if (K_TIMEOUT_EQ(queue->work_timeout, K_FOREVER)) {
+	if (K_TIMEOUT_EQ(queue->work_timeout, K_FOREVER) || (_current != queue->thread_id)) {
 		return;
 	}
 
@@ -640,7 +835,7 @@ static void work_timeout_start_locked(struct k_work_q *queue, struct k_work *wor
 
 static void work_timeout_stop_locked(struct k_work_q *queue)
 {
-	if (K_TIMEOUT_EQ(queue->work_timeout, K_FOREVER)) {
+	if (K_TIMEOUT_EQ(queue->work_timeout, K_FOREVER) || (_current != queue->thread_id)) {
 		return;
 	}
 
@@ -667,12 +862,12 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		bool yield;
 
 		/* Check for and prepare any new work. */
-		node = sys_slist_get(&queue->pending);
+		node = queue_get_locked(queue);
 		if (node != NULL) {
 			/* Mark that there's some work active that's
 			 * not on the pending list.
 			 */
-			flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+			queue_busy_locked(queue);
 			work = CONTAINER_OF(node, struct k_work, node);
 			flag_set(&work->flags, K_WORK_RUNNING_BIT);
 			flag_clear(&work->flags, K_WORK_QUEUED_BIT);
@@ -690,7 +885,9 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			 * This means that if node is not NULL, then work will not be NULL.
 			 */
 			handler = work->handler;
-		} else if (flag_test_and_clear(&queue->flags,
+		} else if (!flag_test(&queue->flags, K_WORK_QUEUE_BUSY_BIT) &&
+			   sys_slist_is_empty(&queue->pending) &&
+			   flag_test_and_clear(&queue->flags,
 					       K_WORK_QUEUE_DRAIN_BIT)) {
 			/* Not busy and draining: move threads waiting for
 			 * drain to ready state.  The held spinlock inhibits
@@ -703,9 +900,12 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			 */
 			(void)z_sched_wake_all(&queue->drainq, 1, NULL);
 		} else if (flag_test(&queue->flags, K_WORK_QUEUE_STOP_BIT)) {
-			/* User has requested that the queue stop. Clear the status flags and exit.
+			/* User has requested that the queue stop. Clear the status flags
+			 * once the last thread of the queue exits.
 			 */
-			flags_set(&queue->flags, 0);
+			if (queue_exit_locked(queue)) {
+				flags_set(&queue->flags, 0);
+			}
 			k_spin_unlock(&lock, key);
 			return;
 		} else {
@@ -755,7 +955,7 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			finalize_cancel_locked(work);
 		}
 
-		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+		queue_idle_locked(queue);
 		yield = !flag_test(&queue->flags, K_WORK_QUEUE_NO_YIELD_BIT);
 		k_spin_unlock(&lock, key);
 
@@ -804,8 +1004,10 @@ void k_work_queue_run(struct k_work_q *queue, const struct k_work_queue_config *
 	sys_slist_init(&queue->pending);
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
+	queue_threads_init(queue);
 	queue->thread_id = _current;
 	flags_set(&queue->flags, flags);
+	queue_workers_start(queue, cfg, k_thread_priority_get(_current));
 	work_queue_main(queue, NULL, NULL);
 }
 
@@ -826,6 +1028,7 @@ void k_work_queue_start(struct k_work_q *queue,
 	sys_slist_init(&queue->pending);
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
+	queue_threads_init(queue);
 
 	if ((cfg != NULL) && cfg->no_yield) {
 		flags |= K_WORK_QUEUE_NO_YIELD;
@@ -859,6 +1062,7 @@ void k_work_queue_start(struct k_work_q *queue,
 
 	k_thread_start(&queue->thread);
 	queue->thread_id = &queue->thread;
+	queue_workers_start(queue, cfg, prio);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
 }
@@ -915,6 +1119,34 @@ int k_work_queue_unplug(struct k_work_q *queue)
 	return ret;
 }
 
+/* Wait for all threads of a stopping queue to exit.
+ *
+ * @param queue the queue being stopped
+ * @param timeout how long to wait for all threads
+ *
+ * @retval 0 if all threads exited
+ * @retval -EAGAIN if some thread did not exit within @p timeout
+ */
+static int queue_join(struct k_work_q *queue, k_timeout_t timeout)
+{
+#ifdef CONFIG_WORKQUEUE_POOL
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	struct k_work_q_worker *worker;
+	int ret = k_thread_join(queue->thread_id, timeout);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&queue->workers, worker, node) {
+		if (ret != 0) {
+			break;
+		}
+		ret = k_thread_join(&worker->thread, sys_timepoint_timeout(end));
+	}
+
+	return ret;
+#else
+	return k_thread_join(queue->thread_id, timeout);
+#endif /* CONFIG_WORKQUEUE_POOL */
+}
+
 int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout)
 {
 	__ASSERT_NO_MSG(queue);
@@ -935,10 +1167,14 @@ int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout)
 	}
 
 	flag_set(&queue->flags, K_WORK_QUEUE_STOP_BIT);
+#ifdef CONFIG_WORKQUEUE_POOL
+	(void)z_sched_wake_all(&queue->notifyq, 0, NULL);
+#else
 	notify_queue_locked(queue);
+#endif /* CONFIG_WORKQUEUE_POOL */
 	k_spin_unlock(&lock, key);
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_work_queue, stop, queue, timeout);
-	if (k_thread_join(queue->thread_id, timeout)) {
+	if (queue_join(queue, timeout)) {
 		key = k_spin_lock(&lock);
 		flag_clear(&queue->flags, K_WORK_QUEUE_STOP_BIT);
 		k_spin_unlock(&lock, key);
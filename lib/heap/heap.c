@@ -37,11 +37,11 @@ static void free_list_remove_bidx(struct z_heap *h, chunkid_t c, int bidx)
 
 	CHECK(!chunk_used(h, c));
 	CHECK(b->next != 0);
-	CHECK(h->avail_buckets & BIT(bidx));
+	CHECK(bucket_avail(h, bidx));
 
 	if (next_free_chunk(h, c) == c) {
 		/* this is the last chunk */
-		h->avail_buckets &= ~BIT(bidx);
+		bucket_set_avail(h, bidx, false);
 		b->next = 0;
 	} else {
 		chunkid_t first = prev_free_chunk(h, c),
@@ -70,15 +70,15 @@ static void free_list_add_bidx(struct z_heap *h, chunkid_t c, int bidx)
 	struct z_heap_bucket *b = &h->buckets[bidx];
 
 	if (b->next == 0U) {
-		CHECK((h->avail_buckets & BIT(bidx)) == 0);
+		CHECK(!bucket_avail(h, bidx));
 
 		/* Empty list, first item */
-		h->avail_buckets |= BIT(bidx);
+		bucket_set_avail(h, bidx, true);
 		b->next = c;
 		set_prev_free_chunk(h, c, c);
 		set_next_free_chunk(h, c, c);
 	} else {
-		CHECK(h->avail_buckets & BIT(bidx));
+		CHECK(bucket_avail(h, bidx));
 
 		/* Insert before (!) the "next" pointer */
 		chunkid_t second = b->next;
@@ -165,6 +165,9 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 	if (mem == NULL) {
 		return; /* ISO C free() semantics */
 	}
+#ifdef CONFIG_SYS_HEAP_ANALYSIS
+	uint32_t start = k_cycle_get_32();
+#endif
 	struct z_heap *h = heap->heap;
 	chunkid_t c = mem_to_chunkid(h, mem);
 
@@ -194,7 +197,15 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 				  chunksz_to_bytes(h, chunk_size(h, c)));
 #endif
 
+#ifdef CONFIG_SYS_HEAP_ANALYSIS
+	size_t freed_bytes = chunksz_to_bytes(h, chunk_size(h, c));
+#endif
+
 	free_chunk(h, c);
+
+#ifdef CONFIG_SYS_HEAP_ANALYSIS
+	heap_analysis_free(heap, freed_bytes, start);
+#endif
 }
 
 size_t sys_heap_usable_size(struct sys_heap *heap, void *mem)
@@ -208,13 +219,75 @@ size_t sys_heap_usable_size(struct sys_heap *heap, void *mem)
 	return chunk_sz - (addr - chunk_base);
 }
 
-static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
+#ifdef CONFIG_SYS_HEAP_TLSF
+/* Also returns the number of chunks tried in "tries", and whether a
+ * larger bucket than the size class of the request was used in
+ * "fallback".
+ */
+static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz, uint32_t *tries,
+			     bool *fallback)
+{
+	unsigned int usable_sz = sz - min_chunk_size(h) + 1;
+	uint32_t *sl_avail = tlsf_sl_avail(h);
+	int nb_rows = tlsf_nb_rows(h);
+	uint32_t sl_mask;
+	int bi, row;
+
+	*tries = 0U;
+	*fallback = false;
+
+	/* Round the size up to the start of the next bucket, so that any
+	 * chunk of that bucket and of the ones above fits: the first
+	 * chunk found is used, without ever walking a list. This wastes
+	 * less than 1 / TLSF_SL_COUNT of the chunk at worst.
+	 */
+	if (usable_sz >= TLSF_SL_COUNT) {
+		usable_sz += BIT(31 - __builtin_clz(usable_sz) - TLSF_SL_LOG2) - 1;
+	}
+	bi = usable_sz_bucket_idx(usable_sz);
+	row = bi >> TLSF_SL_LOG2;
+	if (row >= nb_rows) {
+		return 0;
+	}
+
+	/* The smallest available bucket in the same row, or else in the
+	 * smallest available row above
+	 */
+	sl_mask = sl_avail[row] & ~BIT_MASK(bi & (TLSF_SL_COUNT - 1));
+	if (sl_mask == 0U) {
+		uint32_t fl_mask = h->avail_buckets & ~BIT_MASK(row + 1);
+
+		if (fl_mask == 0U) {
+			return 0;
+		}
+		row = __builtin_ctz(fl_mask);
+		sl_mask = sl_avail[row];
+	}
+
+	int bucket = (row << TLSF_SL_LOG2) + __builtin_ctz(sl_mask);
+	chunkid_t c = h->buckets[bucket].next;
+
+	*tries = 1U;
+	*fallback = bucket != bi;
+	free_list_remove_bidx(h, c, bucket);
+	CHECK(chunk_size(h, c) >= sz);
+	return c;
+}
+#else
+/* Also returns the number of chunks tried in the smallest bucket in
+ * "tries", and whether a larger bucket was used in "fallback".
+ */
+static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz, uint32_t *tries,
+			     bool *fallback)
 {
 	int bi = bucket_idx(h, sz);
 	struct z_heap_bucket *b = &h->buckets[bi];
 
 	CHECK(bi <= bucket_idx(h, h->end_chunk));
 
+	*tries = 0U;
+	*fallback = false;
+
 	/* First try a bounded count of items from the minimal bucket
 	 * size.  These may not fit, trying (e.g.) three means that
 	 * (assuming that chunk sizes are evenly distributed[1]) we
@@ -234,6 +307,7 @@ static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 		int i = CONFIG_SYS_HEAP_ALLOC_LOOPS;
 		do {
 			chunkid_t c = b->next;
+			(*tries)++;
 			if (chunk_size(h, c) >= sz) {
 				free_list_remove_bidx(h, c, bi);
 				return c;
@@ -252,6 +326,7 @@ static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 		int minbucket = __builtin_ctz(bmask);
 		chunkid_t c = h->buckets[minbucket].next;
 
+		*fallback = true;
 		free_list_remove_bidx(h, c, minbucket);
 		CHECK(chunk_size(h, c) >= sz);
 		return c;
@@ -259,20 +334,29 @@ static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 
 	return 0;
 }
+#endif /* CONFIG_SYS_HEAP_TLSF */
 
 void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 {
 	struct z_heap *h = heap->heap;
+	uint32_t tries;
+	bool fallback;
 	void *mem;
 
 	if (bytes == 0U) {
 		return NULL;
 	}
 
+#ifdef CONFIG_SYS_HEAP_ANALYSIS
+	uint32_t start = k_cycle_get_32();
+#endif
 	chunksz_t chunk_sz = bytes_to_chunksz(h, bytes, 0);
-	chunkid_t c = alloc_chunk(h, chunk_sz);
+	chunkid_t c = alloc_chunk(h, chunk_sz, &tries, &fallback);
 
 	if (c == 0U) {
+#ifdef CONFIG_SYS_HEAP_ANALYSIS
+		heap_analysis_alloc(heap, bytes, start, tries, fallback, false);
+#endif
 		return NULL;
 	}
 
@@ -295,6 +379,10 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 				   chunksz_to_bytes(h, chunk_size(h, c)));
 #endif
 
+#ifdef CONFIG_SYS_HEAP_ANALYSIS
+	heap_analysis_alloc(heap, bytes, start, tries, fallback, true);
+#endif
+
 	IF_ENABLED(CONFIG_MSAN, (__msan_allocated_memory(mem, bytes)));
 	return mem;
 }
@@ -310,6 +398,8 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 {
 	struct z_heap *h = heap->heap;
 	size_t gap, rew;
+	uint32_t tries;
+	bool fallback;
 
 	/*
 	 * Split align and rewind values (if any).
@@ -335,15 +425,22 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 		return NULL;
 	}
 
+#ifdef CONFIG_SYS_HEAP_ANALYSIS
+	uint32_t start = k_cycle_get_32();
+#endif
+
 	/*
 	 * Find a free block that is guaranteed to fit.
 	 * We over-allocate to account for alignment and then free
 	 * the extra allocations afterwards.
 	 */
 	chunksz_t padded_sz = bytes_to_chunksz(h, bytes, align - gap);
-	chunkid_t c0 = alloc_chunk(h, padded_sz);
+	chunkid_t c0 = alloc_chunk(h, padded_sz, &tries, &fallback);
 
 	if (c0 == 0) {
+#ifdef CONFIG_SYS_HEAP_ANALYSIS
+		heap_analysis_alloc(heap, bytes, start, tries, fallback, false);
+#endif
 		return NULL;
 	}
 	uint8_t *mem = chunk_mem(h, c0);
@@ -380,6 +477,10 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 				   chunksz_to_bytes(h, chunk_size(h, c)));
 #endif
 
+#ifdef CONFIG_SYS_HEAP_ANALYSIS
+	heap_analysis_alloc(heap, bytes, start, tries, fallback, true);
+#endif
+
 	IF_ENABLED(CONFIG_MSAN, (__msan_allocated_memory(mem, bytes)));
 	return mem;
 }
@@ -557,13 +658,16 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 	h->max_allocated_bytes = 0;
 #endif
 
+#ifdef CONFIG_SYS_HEAP_ANALYSIS
+	(void)memset(&heap->analysis, 0, sizeof(heap->analysis));
+#endif
+
 #if CONFIG_SYS_HEAP_ARRAY_SIZE
 	sys_heap_array_save(heap);
 #endif
 
-	int nb_buckets = bucket_idx(h, heap_sz) + 1;
-	chunksz_t chunk0_size = chunksz(sizeof(struct z_heap) +
-				     nb_buckets * sizeof(struct z_heap_bucket));
+	int nb_buckets = heap_nb_buckets(h);
+	chunksz_t chunk0_size = chunksz(heap_meta_bytes(h));
 
 	__ASSERT(chunk0_size + min_chunk_size(h) <= heap_sz, "heap size is too small");
 
@@ -571,6 +675,12 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 		h->buckets[i].next = 0;
 	}
 
+#ifdef CONFIG_SYS_HEAP_TLSF
+	for (int i = 0; i < tlsf_nb_rows(h); i++) {
+		tlsf_sl_avail(h)[i] = 0U;
+	}
+#endif
+
 	/* chunk containing our struct z_heap */
 	set_chunk_size(h, 0, chunk0_size);
 	set_left_chunk_size(h, 0, 0);
@@ -258,10 +258,145 @@ static inline size_t chunksz_to_bytes(struct z_heap *h, chunksz_t chunksz_in)
 	return chunksz_in * CHUNK_UNIT - chunk_header_bytes(h);
 }
 
+#ifdef CONFIG_SYS_HEAP_TLSF
+/*
+ * With the TLSF engine, the free lists ("buckets") are grouped in rows of
+ * TLSF_SL_COUNT lists. Counting sizes in chunk units above the minimum
+ * chunk size, rows 0 and 1 hold sizes below 2 * TLSF_SL_COUNT one by one,
+ * so that bucket N holds size N, and each further row splits one power of
+ * two in TLSF_SL_COUNT equal ranges. avail_buckets has a bit per row with
+ * an available bucket, and each row has a bitmap of its available buckets
+ * stored after the bucket array.
+ */
+#define TLSF_SL_LOG2  CONFIG_SYS_HEAP_TLSF_SL_LOG2
+#define TLSF_SL_COUNT BIT(TLSF_SL_LOG2)
+
+static inline int usable_sz_bucket_idx(unsigned int usable_sz)
+{
+	if (usable_sz < TLSF_SL_COUNT) {
+		return usable_sz;
+	}
+
+	int fl = 31 - __builtin_clz(usable_sz);
+
+	return ((fl - TLSF_SL_LOG2 + 1) << TLSF_SL_LOG2) +
+	       (usable_sz >> (fl - TLSF_SL_LOG2)) - TLSF_SL_COUNT;
+}
+
+/* Smallest size, above the minimum chunk size, of a bucket */
+static inline unsigned int bucket_min_usable_sz(int bidx)
+{
+	int row = bidx >> TLSF_SL_LOG2;
+
+	if (row == 0) {
+		return bidx;
+	}
+
+	return (TLSF_SL_COUNT + (bidx & (TLSF_SL_COUNT - 1))) << (row - 1);
+}
+#else
+static inline int usable_sz_bucket_idx(unsigned int usable_sz)
+{
+	return 31 - __builtin_clz(usable_sz);
+}
+
+/* Smallest size, above the minimum chunk size, of a bucket */
+static inline unsigned int bucket_min_usable_sz(int bidx)
+{
+	return 1U << bidx;
+}
+#endif /* CONFIG_SYS_HEAP_TLSF */
+
 static inline int bucket_idx(struct z_heap *h, chunksz_t sz)
 {
 	unsigned int usable_sz = sz - min_chunk_size(h) + 1;
-	return 31 - __builtin_clz(usable_sz);
+	return usable_sz_bucket_idx(usable_sz);
+}
+
+/* Smallest chunk size stored in a bucket */
+static inline chunksz_t bucket_min_chunk_size(struct z_heap *h, int bidx)
+{
+	return bucket_min_usable_sz(bidx) - 1 + min_chunk_size(h);
+}
+
+/* Number of buckets following struct z_heap */
+static inline int heap_nb_buckets(struct z_heap *h)
+{
+	return bucket_idx(h, h->end_chunk) + 1;
+}
+
+#ifdef CONFIG_SYS_HEAP_TLSF
+/* Number of rows, the last one possibly partial */
+static inline int tlsf_nb_rows(struct z_heap *h)
+{
+	return (bucket_idx(h, h->end_chunk) >> TLSF_SL_LOG2) + 1;
+}
+
+/* Bitmaps of available buckets of each row */
+static inline uint32_t *tlsf_sl_avail(struct z_heap *h)
+{
+	return (uint32_t *)&h->buckets[heap_nb_buckets(h)];
+}
+#endif
+
+/* Size of struct z_heap and of the bucket data following it */
+static inline size_t heap_meta_bytes(struct z_heap *h)
+{
+	size_t bytes = sizeof(struct z_heap) +
+		       heap_nb_buckets(h) * sizeof(struct z_heap_bucket);
+
+#ifdef CONFIG_SYS_HEAP_TLSF
+	bytes += tlsf_nb_rows(h) * sizeof(uint32_t);
+#endif
+	return bytes;
+}
+
+static inline bool bucket_avail(struct z_heap *h, int bidx)
+{
+#ifdef CONFIG_SYS_HEAP_TLSF
+	return (tlsf_sl_avail(h)[bidx >> TLSF_SL_LOG2] &
+		BIT(bidx & (TLSF_SL_COUNT - 1))) != 0U;
+#else
+	return (h->avail_buckets & BIT(bidx)) != 0U;
+#endif
+}
+
+static inline void bucket_set_avail(struct z_heap *h, int bidx, bool avail)
+{
+#ifdef CONFIG_SYS_HEAP_TLSF
+	uint32_t *sl_avail = &tlsf_sl_avail(h)[bidx >> TLSF_SL_LOG2];
+
+	if (avail) {
+		*sl_avail |= BIT(bidx & (TLSF_SL_COUNT - 1));
+		h->avail_buckets |= BIT(bidx >> TLSF_SL_LOG2);
+	} else {
+		*sl_avail &= ~BIT(bidx & (TLSF_SL_COUNT - 1));
+		if (*sl_avail == 0U) {
+			h->avail_buckets &= ~BIT(bidx >> TLSF_SL_LOG2);
+		}
+	}
+#else
+	if (avail) {
+		h->avail_buckets |= BIT(bidx);
+	} else {
+		h->avail_buckets &= ~BIT(bidx);
+	}
+#endif
+}
+
+/* Highest available bucket, holding the largest free chunk, or -1 */
+static inline int bucket_last_avail(struct z_heap *h)
+{
+	if (h->avail_buckets == 0U) {
+		return -1;
+	}
+
+	int last = 31 - __builtin_clz(h->avail_buckets);
+
+#ifdef CONFIG_SYS_HEAP_TLSF
+	last = (last << TLSF_SL_LOG2) + 31 - __builtin_clz(tlsf_sl_avail(h)[last]);
+#endif
+	return last;
 }
 
 static inline void get_alloc_info(struct z_heap *h, size_t *alloc_bytes,
@@ -281,4 +416,16 @@ static inline void get_alloc_info(struct z_heap *h, size_t *alloc_bytes,
 	}
 }
 
+#ifdef CONFIG_SYS_HEAP_ANALYSIS
+/* Record an allocation of "bytes" started at cycle "start", which tried
+ * "tries" chunks of the smallest bucket and may have fallen back to a
+ * larger one.
+ */
+void heap_analysis_alloc(struct sys_heap *heap, size_t bytes, uint32_t start,
+			 uint32_t tries, bool fallback, bool success);
+
+/* Record a free of a "bytes" block started at cycle "start" */
+void heap_analysis_free(struct sys_heap *heap, size_t bytes, uint32_t start);
+#endif
+
 #endif /* ZEPHYR_INCLUDE_LIB_OS_HEAP_H_ */
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/sys/sys_heap.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/sys/math_extras.h>
+#include <zephyr/kernel.h>
+#include <string.h>
+#include "heap.h"
+
+static unsigned int size_class(size_t bytes)
+{
+	unsigned int cls = 0U;
+
+	/* Class N holds up to 8 << N bytes */
+	while ((cls < (CONFIG_SYS_HEAP_ANALYSIS_SIZE_CLASSES - 1U)) &&
+	       (bytes > (8UL << cls))) {
+		cls++;
+	}
+
+	return cls;
+}
+
+static unsigned int latency_bin(uint32_t start)
+{
+	uint32_t cycles = k_cycle_get_32() - start;
+	unsigned int bin = 31U - u32_count_leading_zeros(cycles | 1U);
+
+	return MIN(bin, CONFIG_SYS_HEAP_ANALYSIS_LATENCY_BINS - 1U);
+}
+
+/* The largest free chunk is in the highest non-empty bucket */
+static size_t largest_free_bytes(struct z_heap *h)
+{
+	int bidx = bucket_last_avail(h);
+	chunksz_t largest = 0;
+	chunkid_t first, c;
+
+	if (bidx < 0) {
+		return 0;
+	}
+
+	first = h->buckets[bidx].next;
+	c = first;
+	do {
+		largest = MAX(largest, chunk_size(h, c));
+		c = next_free_chunk(h, c);
+	} while (c != first);
+
+	return chunksz_to_bytes(h, largest);
+}
+
+void heap_analysis_alloc(struct sys_heap *heap, size_t bytes, uint32_t start,
+			 uint32_t tries, bool fallback, bool success)
+{
+	struct sys_heap_analysis *a = &heap->analysis;
+
+	a->alloc_latency[size_class(bytes)][latency_bin(start)]++;
+	a->alloc_walk[MIN(tries, SYS_HEAP_ANALYSIS_WALK_BINS - 1U)]++;
+	if (fallback) {
+		a->alloc_fallbacks++;
+	}
+
+	if (!success) {
+		a->alloc_failures++;
+		a->last_failure_bytes = bytes;
+		a->last_failure_largest_free = largest_free_bytes(heap->heap);
+	}
+}
+
+void heap_analysis_free(struct sys_heap *heap, size_t bytes, uint32_t start)
+{
+	heap->analysis.free_latency[size_class(bytes)][latency_bin(start)]++;
+}
+
+static void bucket_info_get(struct z_heap *h, int bidx,
+			    struct sys_heap_bucket_info *info)
+{
+	chunkid_t first = h->buckets[bidx].next;
+	chunkid_t c = first;
+
+	(void)memset(info, 0, sizeof(*info));
+	if (first == 0U) {
+		return;
+	}
+
+	do {
+		size_t bytes = chunksz_to_bytes(h, chunk_size(h, c));
+
+		info->free_blocks++;
+		info->free_bytes += bytes;
+		info->largest_free_bytes = MAX(info->largest_free_bytes, bytes);
+		c = next_free_chunk(h, c);
+	} while (c != first);
+}
+
+int sys_heap_fragmentation_get(struct sys_heap *heap,
+			       struct sys_heap_bucket_info *buckets,
+			       int max_buckets)
+{
+	struct z_heap *h;
+	int nb_buckets;
+
+	if ((heap == NULL) || (buckets == NULL)) {
+		return -EINVAL;
+	}
+
+	h = heap->heap;
+	nb_buckets = heap_nb_buckets(h);
+
+	for (int i = 0; i < MIN(nb_buckets, max_buckets); i++) {
+		bucket_info_get(h, i, &buckets[i]);
+	}
+
+	return nb_buckets;
+}
+
+int sys_heap_analysis_get(struct sys_heap *heap,
+			  struct sys_heap_analysis *analysis)
+{
+	if ((heap == NULL) || (analysis == NULL)) {
+		return -EINVAL;
+	}
+
+	*analysis = heap->analysis;
+
+	return 0;
+}
+
+int sys_heap_analysis_reset(struct sys_heap *heap)
+{
+	if (heap == NULL) {
+		return -EINVAL;
+	}
+
+	(void)memset(&heap->analysis, 0, sizeof(heap->analysis));
+
+	return 0;
+}
+
+/* The image has no alignment requirement, so it is only written bytewise */
+static uint8_t *dump_bytes(uint8_t *out, const void *in, size_t size)
+{
+	(void)memcpy(out, in, size);
+
+	return out + size;
+}
+
+static uint8_t *dump_word(uint8_t *out, size_t value)
+{
+	uint32_t word = MIN(value, UINT32_MAX);
+
+	return dump_bytes(out, &word, sizeof(word));
+}
+
+int sys_heap_analysis_dump(struct sys_heap *heap, void *buf, size_t len)
+{
+	struct sys_heap_analysis_dump_hdr hdr;
+	const struct sys_heap_analysis *a;
+	struct sys_heap_bucket_info info;
+	struct z_heap *h;
+	uint8_t *out = buf;
+	int nb_buckets;
+	size_t size;
+
+	if ((heap == NULL) || (buf == NULL)) {
+		return -EINVAL;
+	}
+
+	a = &heap->analysis;
+	h = heap->heap;
+	nb_buckets = heap_nb_buckets(h);
+	size = sizeof(hdr) + sizeof(a->alloc_latency) + sizeof(a->free_latency) +
+	       sizeof(a->alloc_walk) + (4U + 3U * nb_buckets) * sizeof(uint32_t);
+	if (len < size) {
+		return -ENOSPC;
+	}
+
+	hdr = (struct sys_heap_analysis_dump_hdr) {
+		.magic = SYS_HEAP_ANALYSIS_DUMP_MAGIC,
+		.version = SYS_HEAP_ANALYSIS_DUMP_VERSION,
+		.size_classes = CONFIG_SYS_HEAP_ANALYSIS_SIZE_CLASSES,
+		.latency_bins = CONFIG_SYS_HEAP_ANALYSIS_LATENCY_BINS,
+		.walk_bins = SYS_HEAP_ANALYSIS_WALK_BINS,
+		.buckets = nb_buckets,
+		.heap_bytes = MIN((size_t)h->end_chunk * CHUNK_UNIT, UINT32_MAX),
+		.cycles_per_sec = sys_clock_hw_cycles_per_sec(),
+	};
+
+	out = dump_bytes(out, &hdr, sizeof(hdr));
+	out = dump_bytes(out, a->alloc_latency, sizeof(a->alloc_latency));
+	out = dump_bytes(out, a->free_latency, sizeof(a->free_latency));
+	out = dump_bytes(out, a->alloc_walk, sizeof(a->alloc_walk));
+	out = dump_word(out, a->alloc_fallbacks);
+	out = dump_word(out, a->alloc_failures);
+	out = dump_word(out, a->last_failure_bytes);
+	out = dump_word(out, a->last_failure_largest_free);
+
+	for (int i = 0; i < nb_buckets; i++) {
+		bucket_info_get(h, i, &info);
+		out = dump_word(out, info.free_blocks);
+		out = dump_word(out, info.free_bytes);
+		out = dump_word(out, info.largest_free_bytes);
+	}
+
+	return size;
+}
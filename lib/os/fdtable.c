@@ -23,6 +23,7 @@
 #include <zephyr/sys/speculation.h>
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/sys/atomic.h>
+#include <zephyr/zvfs/epoll.h>
 
 struct stat;
 
@@ -392,6 +393,11 @@ int zvfs_close(int fd)
 		return -1;
 	}
 
+#ifdef CONFIG_ZVFS_EPOLL
+	/* The poll events of the epoll instances point into the object */
+	zvfs_epoll_fd_closed(fd);
+#endif /* CONFIG_ZVFS_EPOLL */
+
 	(void)k_mutex_lock(&fdtable[fd].lock, K_FOREVER);
 	if (fdtable[fd].vtable->close != NULL) {
 		/* close() is optional - e.g. stdinout_fd_op_vtable */
@@ -0,0 +1,579 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/bitarray.h>
+#include <zephyr/sys/fdtable.h>
+#include <zephyr/sys/slist.h>
+#include <zephyr/zvfs/epoll.h>
+
+/* Most poll events a descriptor asks for, see the TLS socket POLL_PREPARE,
+ * plus one for the zero-copy send completions of native sockets.
+ */
+#define ZVFS_EPOLL_PEV_MAX (3 + IS_ENABLED(CONFIG_NET_CONTEXT_ZEROCOPY))
+
+/* Ready poll events taken from the set at a time */
+#define ZVFS_EPOLL_BATCH 8
+
+/* The poll events of the item are in the poll set */
+#define ZVFS_EPOLL_ITEM_ARMED BIT(0)
+/* The item is checked on every wait, see epoll_item_heat() */
+#define ZVFS_EPOLL_ITEM_HOT   BIT(1)
+
+#define ZVFS_EPOLL_POLL_EVENTS (ZVFS_EPOLLIN | ZVFS_EPOLLPRI | ZVFS_EPOLLOUT)
+
+struct zvfs_epoll_item {
+	sys_snode_t hot_node;
+	union zvfs_epoll_data data;
+	uint32_t events;
+	/* wait during which the item was last looked at, see epoll_collect() */
+	uint32_t stamp;
+	int fd;
+	uint8_t num_pev;
+	uint8_t seen;
+	uint8_t flags;
+	struct k_poll_event pev[ZVFS_EPOLL_PEV_MAX];
+};
+
+struct zvfs_epoll {
+	struct k_pollset set;
+	sys_slist_t hot;
+	uint32_t stamp;
+	/* threads blocked on the set with epoll_lock dropped */
+	unsigned int waiters;
+	/* raised by a close while there are waiters, see zvfs_epoll_close_op() */
+	struct k_poll_signal closed;
+	struct k_poll_event closed_pev;
+	bool closing;
+	bool in_use;
+	struct zvfs_epoll_item items[CONFIG_ZVFS_EPOLL_MAX_FDS];
+};
+
+SYS_BITARRAY_DEFINE_STATIC(eps_bitarray, CONFIG_ZVFS_EPOLL_MAX);
+static struct zvfs_epoll eps[CONFIG_ZVFS_EPOLL_MAX];
+static const struct fd_op_vtable zvfs_epoll_fd_vtable;
+
+/* Protects all epoll instances; never held while blocking in a wait */
+static K_MUTEX_DEFINE(epoll_lock);
+
+static struct zvfs_epoll_item *epoll_item_find(struct zvfs_epoll *ep, int fd)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(ep->items); i++) {
+		if (ep->items[i].fd == fd) {
+			return &ep->items[i];
+		}
+	}
+
+	return NULL;
+}
+
+/*
+ * Descriptors that are ready without any poll event firing, like datagram
+ * sockets polled for output or sockets in error, are checked on every wait
+ * instead.
+ */
+static void epoll_item_heat(struct zvfs_epoll *ep, struct zvfs_epoll_item *item)
+{
+	if ((item->flags & ZVFS_EPOLL_ITEM_HOT) == 0) {
+		item->flags |= ZVFS_EPOLL_ITEM_HOT;
+		sys_slist_append(&ep->hot, &item->hot_node);
+	}
+}
+
+static int epoll_item_arm(struct zvfs_epoll *ep, struct zvfs_epoll_item *item)
+{
+	struct zvfs_pollfd pfd = {
+		.fd = item->fd,
+		.events = item->events & ZVFS_EPOLL_POLL_EVENTS,
+	};
+	struct k_poll_event *pev = item->pev;
+	const struct fd_op_vtable *vtable;
+	struct k_mutex *lock;
+	void *obj;
+	int ret;
+
+	obj = zvfs_get_fd_obj_and_vtable(item->fd, &vtable, &lock);
+	if (obj == NULL) {
+		return -EBADF;
+	}
+
+	/* The tag finds the item back from a ready poll event */
+	for (size_t i = 0; i < ARRAY_SIZE(item->pev); i++) {
+		item->pev[i].tag = i;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+	ret = zvfs_fdtable_call_ioctl(vtable, obj, ZFD_IOCTL_POLL_PREPARE, &pfd, &pev,
+				      item->pev + ARRAY_SIZE(item->pev));
+	k_mutex_unlock(lock);
+
+	if (ret == -EXDEV) {
+		/* Offloaded sockets only support the offloaded zvfs_poll() */
+		return -EPERM;
+	} else if ((ret < 0) && (ret != -EALREADY)) {
+		return ret;
+	}
+
+	item->num_pev = pev - item->pev;
+	for (int i = 0; i < item->num_pev; i++) {
+		k_pollset_add(&ep->set, &item->pev[i]);
+	}
+
+	item->flags |= ZVFS_EPOLL_ITEM_ARMED;
+
+	if (ret == -EALREADY) {
+		epoll_item_heat(ep, item);
+	}
+
+	return 0;
+}
+
+static void epoll_item_disarm(struct zvfs_epoll *ep, struct zvfs_epoll_item *item)
+{
+	if ((item->flags & ZVFS_EPOLL_ITEM_ARMED) != 0) {
+		for (int i = 0; i < item->num_pev; i++) {
+			(void)k_pollset_del(&ep->set, &item->pev[i]);
+		}
+	}
+
+	if ((item->flags & ZVFS_EPOLL_ITEM_HOT) != 0) {
+		(void)sys_slist_find_and_remove(&ep->hot, &item->hot_node);
+	}
+
+	item->flags = 0;
+}
+
+/* Check which events of the item hold and fill @a out if any do */
+static bool epoll_item_report(struct zvfs_epoll *ep, struct zvfs_epoll_item *item,
+			      struct zvfs_epoll_event *out)
+{
+	struct zvfs_pollfd pfd = {
+		.fd = item->fd,
+		.events = item->events & ZVFS_EPOLL_POLL_EVENTS,
+	};
+	struct k_poll_event *pev = item->pev;
+	const struct fd_op_vtable *vtable;
+	struct k_mutex *lock;
+	void *obj;
+	int ret;
+
+	obj = zvfs_get_fd_obj_and_vtable(item->fd, &vtable, &lock);
+	if (obj == NULL) {
+		pfd.revents = ZVFS_POLLNVAL;
+	} else {
+		(void)k_mutex_lock(lock, K_FOREVER);
+		ret = zvfs_fdtable_call_ioctl(vtable, obj, ZFD_IOCTL_POLL_UPDATE, &pfd, &pev);
+		k_mutex_unlock(lock);
+
+		if (ret == -EAGAIN) {
+			return false;
+		} else if (ret < 0) {
+			pfd.revents |= ZVFS_POLLERR;
+		}
+	}
+
+	if ((pfd.revents & (ZVFS_POLLERR | ZVFS_POLLHUP | ZVFS_POLLNVAL)) != 0) {
+		/* These hold until the descriptor is closed */
+		epoll_item_heat(ep, item);
+	}
+
+	if (pfd.revents == 0) {
+		return false;
+	}
+
+	out->events = pfd.revents;
+	out->data = item->data;
+
+	if ((item->events & ZVFS_EPOLLONESHOT) != 0) {
+		epoll_item_disarm(ep, item);
+	}
+
+	return true;
+}
+
+/*
+ * Report the items of the hot list and of the ready poll events, the first
+ * @a n of which were already taken from the set. Every call to
+ * k_pollset_wait() re-arms the events it returned before, which puts those
+ * still ready back at the end of the ready list, so the ready list is
+ * walked until an event already seen during this wait shows up again.
+ */
+static int epoll_collect(struct zvfs_epoll *ep, struct k_poll_event **ready, int n,
+			 struct zvfs_epoll_event *events, int maxevents)
+{
+	struct zvfs_epoll_item *item, *next;
+	uint32_t stamp = ++ep->stamp;
+	bool wrapped = false;
+	int count = 0;
+	int request;
+
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&ep->hot, item, next, hot_node) {
+		if (count == maxevents) {
+			break;
+		}
+
+		item->stamp = stamp;
+		item->seen = 0;
+
+		if (epoll_item_report(ep, item, &events[count])) {
+			count++;
+		}
+	}
+
+	for (;;) {
+		for (int i = 0; i < n; i++) {
+			struct k_poll_event *pev = ready[i];
+			bool fresh = false;
+
+			item = CONTAINER_OF(pev - pev->tag, struct zvfs_epoll_item, pev[0]);
+
+			if (item->stamp != stamp) {
+				item->stamp = stamp;
+				item->seen = 0;
+				fresh = true;
+			}
+
+			if ((item->seen & BIT(pev->tag)) != 0) {
+				wrapped = true;
+				continue;
+			}
+
+			item->seen |= BIT(pev->tag);
+
+			/* Items may be removed while the lock is dropped to wait */
+			if (!fresh || (item->fd < 0) || (count == maxevents) ||
+			    ((item->flags & ZVFS_EPOLL_ITEM_ARMED) == 0)) {
+				continue;
+			}
+
+			if (epoll_item_report(ep, item, &events[count])) {
+				count++;
+			}
+		}
+
+		request = MIN(maxevents - count, ZVFS_EPOLL_BATCH);
+		if (wrapped || (request == 0)) {
+			break;
+		}
+
+		n = k_pollset_wait(&ep->set, ready, request, K_NO_WAIT);
+		if (n < 0) {
+			break;
+		}
+	}
+
+	return count;
+}
+
+static void epoll_release(struct zvfs_epoll *ep)
+{
+	ep->closing = false;
+	ep->in_use = false;
+	(void)sys_bitarray_free(&eps_bitarray, 1, ep - eps);
+}
+
+/*
+ * Threads blocked in zvfs_epoll_wait() still use the set after the instance
+ * is closed, so the instance is only released by the last of them. The
+ * close signal wakes up one waiter at a time: each one re-adds the still
+ * raised signal to the set on its way out, which wakes up the next.
+ */
+static void epoll_leave(struct zvfs_epoll *ep)
+{
+	if (ep->waiters == 0) {
+		epoll_release(ep);
+	} else {
+		(void)k_pollset_del(&ep->set, &ep->closed_pev);
+		k_pollset_add(&ep->set, &ep->closed_pev);
+	}
+}
+
+static int zvfs_epoll_close_op(void *obj)
+{
+	struct zvfs_epoll *ep = obj;
+
+	(void)k_mutex_lock(&epoll_lock, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(ep->items); i++) {
+		if (ep->items[i].fd >= 0) {
+			epoll_item_disarm(ep, &ep->items[i]);
+			ep->items[i].fd = -1;
+		}
+	}
+
+	if (ep->waiters == 0) {
+		epoll_release(ep);
+	} else {
+		ep->closing = true;
+		(void)k_poll_signal_raise(&ep->closed, 0);
+	}
+
+	k_mutex_unlock(&epoll_lock);
+
+	return 0;
+}
+
+static int zvfs_epoll_ioctl_op(void *obj, unsigned int request, va_list args)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(request);
+	ARG_UNUSED(args);
+
+	errno = EOPNOTSUPP;
+
+	return -1;
+}
+
+static const struct fd_op_vtable zvfs_epoll_fd_vtable = {
+	.close = zvfs_epoll_close_op,
+	.ioctl = zvfs_epoll_ioctl_op,
+};
+
+/*
+ * Public-facing API
+ */
+
+int zvfs_epoll_create1(int flags)
+{
+	struct zvfs_epoll *ep;
+	size_t offset;
+	int fd;
+
+	if ((flags & ~ZVFS_EPOLL_CLOEXEC) != 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (sys_bitarray_alloc(&eps_bitarray, 1, &offset) < 0) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	ep = &eps[offset];
+
+	fd = zvfs_reserve_fd();
+	if (fd < 0) {
+		(void)sys_bitarray_free(&eps_bitarray, 1, offset);
+		return -1;
+	}
+
+	(void)k_mutex_lock(&epoll_lock, K_FOREVER);
+
+	k_pollset_init(&ep->set);
+	sys_slist_init(&ep->hot);
+
+	for (size_t i = 0; i < ARRAY_SIZE(ep->items); i++) {
+		ep->items[i].fd = -1;
+		ep->items[i].flags = 0;
+	}
+
+	k_poll_signal_init(&ep->closed);
+	k_poll_event_init(&ep->closed_pev, K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY,
+			  &ep->closed);
+	k_pollset_add(&ep->set, &ep->closed_pev);
+
+	ep->waiters = 0;
+	ep->closing = false;
+	ep->in_use = true;
+
+	k_mutex_unlock(&epoll_lock);
+
+	zvfs_finalize_fd(fd, ep, &zvfs_epoll_fd_vtable);
+
+	return fd;
+}
+
+int zvfs_epoll_ctl(int epfd, int op, int fd, struct zvfs_epoll_event *event)
+{
+	struct zvfs_epoll_item *item;
+	struct zvfs_epoll *ep;
+	int ret = 0;
+
+	ep = zvfs_get_fd_obj(epfd, &zvfs_epoll_fd_vtable, EINVAL);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (op != ZVFS_EPOLL_CTL_DEL) {
+		if (event == NULL) {
+			errno = EFAULT;
+			return -1;
+		}
+
+		if ((event->events & ZVFS_EPOLLET) != 0) {
+			errno = EINVAL;
+			return -1;
+		}
+	}
+
+	if (zvfs_get_fd_obj(fd, NULL, EBADF) == NULL) {
+		return -1;
+	}
+
+	/* Nesting epoll instances is not supported */
+	if (zvfs_get_fd_obj(fd, &zvfs_epoll_fd_vtable, 0) != NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	(void)k_mutex_lock(&epoll_lock, K_FOREVER);
+
+	item = epoll_item_find(ep, fd);
+
+	switch (op) {
+	case ZVFS_EPOLL_CTL_ADD:
+		if (item != NULL) {
+			ret = -EEXIST;
+			break;
+		}
+
+		item = epoll_item_find(ep, -1);
+		if (item == NULL) {
+			ret = -ENOSPC;
+			break;
+		}
+
+		item->fd = fd;
+		item->events = event->events;
+		item->data = event->data;
+
+		ret = epoll_item_arm(ep, item);
+		if (ret < 0) {
+			epoll_item_disarm(ep, item);
+			item->fd = -1;
+		}
+		break;
+
+	case ZVFS_EPOLL_CTL_MOD:
+		if (item == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		epoll_item_disarm(ep, item);
+
+		item->events = event->events;
+		item->data = event->data;
+
+		ret = epoll_item_arm(ep, item);
+		if (ret < 0) {
+			epoll_item_disarm(ep, item);
+			item->fd = -1;
+		}
+		break;
+
+	case ZVFS_EPOLL_CTL_DEL:
+		if (item == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		epoll_item_disarm(ep, item);
+		item->fd = -1;
+		break;
+
+	default:
+		ret = -EINVAL;
+		break;
+	}
+
+	k_mutex_unlock(&epoll_lock);
+
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return 0;
+}
+
+int zvfs_epoll_wait(int epfd, struct zvfs_epoll_event *events, int maxevents,
+		    k_timeout_t timeout)
+{
+	struct k_poll_event *ready[ZVFS_EPOLL_BATCH];
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	struct zvfs_epoll *ep;
+	int count;
+	int n;
+
+	if ((events == NULL) || (maxevents <= 0)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	ep = zvfs_get_fd_obj(epfd, &zvfs_epoll_fd_vtable, EINVAL);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	(void)k_mutex_lock(&epoll_lock, K_FOREVER);
+
+	if (!ep->in_use || ep->closing) {
+		/* Closed since looked up */
+		k_mutex_unlock(&epoll_lock);
+		errno = EBADF;
+		return -1;
+	}
+
+	n = k_pollset_wait(&ep->set, ready, MIN(maxevents, ZVFS_EPOLL_BATCH), K_NO_WAIT);
+
+	for (;;) {
+		count = epoll_collect(ep, ready, MAX(n, 0), events, maxevents);
+		if (count > 0) {
+			break;
+		}
+
+		timeout = sys_timepoint_timeout(end);
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			break;
+		}
+
+		ep->waiters++;
+		k_mutex_unlock(&epoll_lock);
+		n = k_pollset_wait(&ep->set, ready, MIN(maxevents, ZVFS_EPOLL_BATCH), timeout);
+		(void)k_mutex_lock(&epoll_lock, K_FOREVER);
+		ep->waiters--;
+
+		if (ep->closing) {
+			epoll_leave(ep);
+			k_mutex_unlock(&epoll_lock);
+			errno = EBADF;
+			return -1;
+		}
+
+		if (n < 0) {
+			/* Timed out, only the hot list is left to look at */
+			end = sys_timepoint_calc(K_NO_WAIT);
+		}
+	}
+
+	k_mutex_unlock(&epoll_lock);
+
+	return count;
+}
+
+void zvfs_epoll_fd_closed(int fd)
+{
+	struct zvfs_epoll_item *item;
+
+	(void)k_mutex_lock(&epoll_lock, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(eps); i++) {
+		if (!eps[i].in_use) {
+			continue;
+		}
+
+		item = epoll_item_find(&eps[i], fd);
+		if (item != NULL) {
+			epoll_item_disarm(&eps[i], item);
+			item->fd = -1;
+		}
+	}
+
+	k_mutex_unlock(&epoll_lock);
+}
@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Compressed RAM backing store implementation
+ */
+#include <mmu.h>
+#include <string.h>
+#include <kernel_arch_interface.h>
+#include <zephyr/kernel/mm/demand_paging.h>
+#include <zephyr/spinlock.h>
+
+#include "lz4.h"
+
+/*
+ * Evicted pages are LZ4-compressed into a pool of fixed-size chunks, like
+ * zram does into zsmalloc. The chunks holding a page are linked into a
+ * list rather than contiguous, so any free chunk will do and the pool
+ * never fragments. Pages which would not save a single chunk once
+ * compressed are stored as they are.
+ *
+ * Location tokens are slot numbers times the page size, as architectures
+ * store them in page table entries. A slot is taken when the kernel asks
+ * for a location, but the size of the page is only known when it is paged
+ * out, so enough chunks for an uncompressed page are reserved until then.
+ *
+ * Like the RAM-based test backing store, locations are freed as soon as
+ * pages are paged in, so all data pages are treated as dirty.
+ */
+
+#define ZRAM_CHUNK_SIZE  CONFIG_BACKING_STORE_ZRAM_CHUNK_SIZE
+#define ZRAM_CHUNKS      (CONFIG_BACKING_STORE_ZRAM_POOL_SIZE / ZRAM_CHUNK_SIZE)
+#define ZRAM_PAGE_CHUNKS DIV_ROUND_UP(CONFIG_MMU_PAGE_SIZE, ZRAM_CHUNK_SIZE)
+#define ZRAM_NONE        UINT16_MAX
+
+BUILD_ASSERT(ZRAM_CHUNKS < ZRAM_NONE, "too many chunks in compressed RAM pool");
+BUILD_ASSERT(ZRAM_CHUNKS >= (2 * ZRAM_PAGE_CHUNKS),
+	     "compressed RAM pool must hold at least two pages");
+BUILD_ASSERT(CONFIG_BACKING_STORE_ZRAM_PAGES < ZRAM_NONE,
+	     "too many pages in compressed RAM backing store");
+
+struct zram_slot {
+	/* First chunk of the page, or next free slot */
+	uint16_t chunk;
+	/* Compressed size, CONFIG_MMU_PAGE_SIZE if stored as is, or 0 if
+	 * not paged out yet
+	 */
+	uint32_t size;
+};
+
+static struct k_spinlock zram_lock;
+
+static uint8_t zram_pool[ZRAM_CHUNKS][ZRAM_CHUNK_SIZE] __aligned(sizeof(void *));
+/* Next chunk of the same page, or next free chunk */
+static uint16_t zram_next[ZRAM_CHUNKS];
+static uint16_t zram_free_chunk;
+static uint32_t zram_free_chunks;
+/* Chunks promised to locations which were not paged out yet */
+static uint32_t zram_reserved_chunks;
+
+static struct zram_slot zram_slots[CONFIG_BACKING_STORE_ZRAM_PAGES];
+static uint16_t zram_free_slot;
+static uint32_t zram_free_slots;
+
+static unsigned long zram_pages;
+static unsigned long zram_incompressible;
+static size_t zram_compressed_size;
+
+/* Only used by page-in and page-out, which are serialized */
+static LZ4_stream_t zram_lz4;
+static uint8_t zram_buf[CONFIG_MMU_PAGE_SIZE] __aligned(sizeof(void *));
+
+static struct zram_slot *location_to_slot(uintptr_t location)
+{
+	__ASSERT(location % CONFIG_MMU_PAGE_SIZE == 0,
+		 "unaligned location 0x%lx", location);
+	__ASSERT(location <
+		 (CONFIG_BACKING_STORE_ZRAM_PAGES * CONFIG_MMU_PAGE_SIZE),
+		 "bad location 0x%lx, past bounds of backing store", location);
+
+	return &zram_slots[location / CONFIG_MMU_PAGE_SIZE];
+}
+
+static void zram_write(uint16_t chunk, const uint8_t *src, size_t size)
+{
+	while (size > 0) {
+		size_t len = MIN(size, ZRAM_CHUNK_SIZE);
+
+		(void)memcpy(zram_pool[chunk], src, len);
+		src += len;
+		size -= len;
+		chunk = zram_next[chunk];
+	}
+}
+
+static void zram_read(uint16_t chunk, uint8_t *dst, size_t size)
+{
+	while (size > 0) {
+		size_t len = MIN(size, ZRAM_CHUNK_SIZE);
+
+		(void)memcpy(dst, zram_pool[chunk], len);
+		dst += len;
+		size -= len;
+		chunk = zram_next[chunk];
+	}
+}
+
+int k_mem_paging_backing_store_location_get(struct k_mem_page_frame *pf,
+					    uintptr_t *location,
+					    bool page_fault)
+{
+	/* Keep room for a page so that page faults can always evict one */
+	uint32_t needed = page_fault ? 1U : 2U;
+	k_spinlock_key_t key;
+	uint16_t slot;
+	int ret = 0;
+
+	key = k_spin_lock(&zram_lock);
+	if ((zram_free_slots < needed) ||
+	    ((zram_free_chunks - zram_reserved_chunks) < (needed * ZRAM_PAGE_CHUNKS))) {
+		ret = -ENOMEM;
+		goto out;
+	}
+
+	slot = zram_free_slot;
+	zram_free_slot = zram_slots[slot].chunk;
+	zram_free_slots--;
+
+	zram_slots[slot].chunk = ZRAM_NONE;
+	zram_slots[slot].size = 0U;
+	zram_reserved_chunks += ZRAM_PAGE_CHUNKS;
+
+	*location = slot * CONFIG_MMU_PAGE_SIZE;
+out:
+	k_spin_unlock(&zram_lock, key);
+
+	return ret;
+}
+
+void k_mem_paging_backing_store_location_free(uintptr_t location)
+{
+	struct zram_slot *slot = location_to_slot(location);
+	k_spinlock_key_t key;
+	uint16_t chunk, last;
+
+	key = k_spin_lock(&zram_lock);
+	last = slot->chunk;
+	if (slot->size == 0U) {
+		zram_reserved_chunks -= ZRAM_PAGE_CHUNKS;
+	} else {
+		/* Prepend the whole list of chunks to the free list */
+		for (chunk = slot->chunk; chunk != ZRAM_NONE; chunk = zram_next[chunk]) {
+			last = chunk;
+			zram_free_chunks++;
+		}
+		zram_next[last] = zram_free_chunk;
+		zram_free_chunk = slot->chunk;
+
+		zram_pages--;
+		if (slot->size == CONFIG_MMU_PAGE_SIZE) {
+			zram_incompressible--;
+		}
+		zram_compressed_size -= slot->size;
+	}
+
+	slot->chunk = zram_free_slot;
+	zram_free_slot = slot - zram_slots;
+	zram_free_slots++;
+	k_spin_unlock(&zram_lock, key);
+}
+
+void k_mem_paging_backing_store_page_out(uintptr_t location)
+{
+	struct zram_slot *slot = location_to_slot(location);
+	const uint8_t *src = zram_buf;
+	k_spinlock_key_t key;
+	uint16_t *link;
+	uint32_t chunks;
+	int size;
+
+	size = LZ4_compress_fast_extState(&zram_lz4, (const char *)K_MEM_SCRATCH_PAGE,
+					  (char *)zram_buf, CONFIG_MMU_PAGE_SIZE,
+					  CONFIG_MMU_PAGE_SIZE - ZRAM_CHUNK_SIZE, 1);
+	if (size <= 0) {
+		/* Would not save a single chunk */
+		src = K_MEM_SCRATCH_PAGE;
+		size = CONFIG_MMU_PAGE_SIZE;
+	}
+	chunks = DIV_ROUND_UP(size, ZRAM_CHUNK_SIZE);
+
+	key = k_spin_lock(&zram_lock);
+	__ASSERT(zram_free_chunks >= chunks, "chunk count mismatch");
+
+	/* Take the chunks from the head of the free list, in order */
+	link = &zram_free_chunk;
+	for (uint32_t i = 0; i < chunks; i++) {
+		link = &zram_next[*link];
+	}
+	slot->chunk = zram_free_chunk;
+	zram_free_chunk = *link;
+	*link = ZRAM_NONE;
+	slot->size = size;
+
+	zram_free_chunks -= chunks;
+	zram_reserved_chunks -= ZRAM_PAGE_CHUNKS;
+
+	zram_pages++;
+	if (size == CONFIG_MMU_PAGE_SIZE) {
+		zram_incompressible++;
+	}
+	zram_compressed_size += size;
+	k_spin_unlock(&zram_lock, key);
+
+	zram_write(slot->chunk, src, size);
+}
+
+void k_mem_paging_backing_store_page_in(uintptr_t location)
+{
+	struct zram_slot *slot = location_to_slot(location);
+	int ret;
+
+	if (slot->size == CONFIG_MMU_PAGE_SIZE) {
+		zram_read(slot->chunk, K_MEM_SCRATCH_PAGE, CONFIG_MMU_PAGE_SIZE);
+		return;
+	}
+
+	zram_read(slot->chunk, zram_buf, slot->size);
+	ret = LZ4_decompress_safe((const char *)zram_buf, (char *)K_MEM_SCRATCH_PAGE,
+				  slot->size, CONFIG_MMU_PAGE_SIZE);
+	__ASSERT(ret == CONFIG_MMU_PAGE_SIZE, "corrupted page at location 0x%lx",
+		 location);
+	(void)ret;
+}
+
+void k_mem_paging_backing_store_page_finalize(struct k_mem_page_frame *pf,
+					      uintptr_t location)
+{
+#ifdef CONFIG_DEMAND_MAPPING
+	/* ignore those */
+	if (location == ARCH_UNPAGED_ANON_ZERO || location == ARCH_UNPAGED_ANON_UNINIT) {
+		return;
+	}
+#endif
+	k_mem_paging_backing_store_location_free(location);
+}
+
+void k_mem_paging_backing_store_init(void)
+{
+	for (uint16_t i = 0; i < ZRAM_CHUNKS; i++) {
+		zram_next[i] = (i + 1 < ZRAM_CHUNKS) ? (i + 1) : ZRAM_NONE;
+	}
+	zram_free_chunk = 0U;
+	zram_free_chunks = ZRAM_CHUNKS;
+
+	for (uint16_t i = 0; i < ARRAY_SIZE(zram_slots); i++) {
+		zram_slots[i].chunk = (i + 1 < ARRAY_SIZE(zram_slots)) ? (i + 1) : ZRAM_NONE;
+	}
+	zram_free_slot = 0U;
+	zram_free_slots = ARRAY_SIZE(zram_slots);
+}
+
+void k_mem_paging_zram_stats_get(struct k_mem_paging_zram_stats *stats)
+{
+	k_spinlock_key_t key = k_spin_lock(&zram_lock);
+
+	stats->pages = zram_pages;
+	stats->incompressible = zram_incompressible;
+	stats->compressed_size = zram_compressed_size;
+	stats->used_size = (ZRAM_CHUNKS - zram_free_chunks) * ZRAM_CHUNK_SIZE;
+	stats->pool_size = sizeof(zram_pool);
+
+	k_spin_unlock(&zram_lock, key);
+}
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * CLOCK-Pro style eviction algorithm for demand paging
+ */
+#include <zephyr/kernel.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+
+#include <zephyr/kernel/mm/demand_paging.h>
+
+/*
+ * Page frames are either hot, part of the working set, or cold. A single
+ * clock hand sweeps the page frames looking for a cold page frame whose
+ * accessed bit is clear:
+ *
+ * - a hot page frame that was accessed has its accessed bit cleared,
+ * - a hot page frame that was not accessed is demoted to cold if there
+ *   are more hot page frames than the target,
+ * - a cold page frame that was accessed has its accessed bit cleared and
+ *   starts a test period, or is promoted to hot if it was in one already,
+ * - a cold page frame that was not accessed is evicted.
+ *
+ * Pages only used once, such as by a scan, stay cold and are evicted
+ * first, while the working set stays hot. A page refaulting shortly after
+ * its eviction was evicted too early: it is brought back as hot and the
+ * number of cold page frames is raised, so that cold pages get more time
+ * to prove themselves. A cold page evicted at the end of its test period
+ * lowers it instead.
+ */
+
+#define CP_HOT  BIT(0)
+#define CP_TEST BIT(1)
+
+static uint8_t cp_state[ARRAY_SIZE(k_mem_page_frames)];
+static uint32_t cp_hand;
+
+/* Evictable page frames, as counted by the last revolution of the hand */
+static uint32_t cp_evictable;
+static uint32_t cp_counted;
+
+static uint32_t cp_hot;
+static uint32_t cp_cold_target;
+
+static inline uint32_t cp_hot_target(void)
+{
+	return cp_evictable - cp_cold_target;
+}
+
+static void cp_cold_target_set(uint32_t target)
+{
+	cp_cold_target = CLAMP(target, 1U, MAX(cp_evictable, 2U) - 1U);
+}
+
+static void cp_state_clear(uint32_t idx)
+{
+	if ((cp_state[idx] & CP_HOT) != 0U) {
+		cp_hot--;
+	}
+	cp_state[idx] = 0U;
+}
+
+static void cp_hand_advance(void)
+{
+	cp_hand++;
+	if (cp_hand == ARRAY_SIZE(k_mem_page_frames)) {
+		cp_hand = 0U;
+		cp_evictable = cp_counted;
+		cp_counted = 0U;
+		cp_cold_target_set(cp_cold_target);
+	}
+}
+
+struct k_mem_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	struct k_mem_page_frame *pf, *fallback = NULL;
+	uint32_t idx, steps;
+	uintptr_t flags;
+	bool accessed;
+
+	/* No accessed bit is left after one revolution and no more hot
+	 * page frames than the target after two, so three are enough.
+	 */
+	for (steps = 0U; steps < (3U * ARRAY_SIZE(k_mem_page_frames)); steps++) {
+		idx = cp_hand;
+		pf = &k_mem_page_frames[idx];
+		cp_hand_advance();
+
+		if (!k_mem_page_frame_is_evictable(pf)) {
+			cp_state_clear(idx);
+			continue;
+		}
+		cp_counted++;
+		if (fallback == NULL) {
+			fallback = pf;
+		}
+
+		flags = arch_page_info_get(k_mem_page_frame_to_virt(pf), NULL, false);
+		accessed = (flags & ARCH_DATA_PAGE_ACCESSED) != 0UL;
+
+		/* Implies a mismatch with page frame ontology and page
+		 * tables
+		 */
+		__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0U,
+			 "non-present page, %s",
+			 ((flags & ARCH_DATA_PAGE_NOT_MAPPED) != 0U) ?
+			 "un-mapped" : "paged out");
+
+		if (accessed) {
+			/* Clear accessed bit in page tables */
+			(void)arch_page_info_get(k_mem_page_frame_to_virt(pf),
+						 NULL, true);
+
+			if ((cp_state[idx] & CP_HOT) != 0U) {
+				continue;
+			}
+			if ((cp_state[idx] & CP_TEST) != 0U) {
+				cp_state[idx] = CP_HOT;
+				cp_hot++;
+			} else {
+				cp_state[idx] |= CP_TEST;
+			}
+			continue;
+		}
+
+		if ((cp_state[idx] & CP_HOT) != 0U) {
+			if (cp_hot > cp_hot_target()) {
+				cp_state_clear(idx);
+			}
+			continue;
+		}
+
+		if ((cp_state[idx] & CP_TEST) != 0U) {
+			/* Not used again in its test period */
+			cp_cold_target_set(cp_cold_target - 1U);
+		}
+		fallback = pf;
+		break;
+	}
+
+	/* Shouldn't ever happen unless every page is pinned */
+	__ASSERT(fallback != NULL, "no page to evict");
+
+	/* Whatever the page frame receives next starts cold */
+	cp_state_clear(fallback - k_mem_page_frames);
+
+	flags = arch_page_info_get(k_mem_page_frame_to_virt(fallback), NULL, false);
+	*dirty_ptr = (flags & ARCH_DATA_PAGE_DIRTY) != 0UL;
+
+	return fallback;
+}
+
+void k_mem_paging_eviction_refault(struct k_mem_page_frame *pf, uint32_t distance)
+{
+	uint32_t idx = pf - k_mem_page_frames;
+
+	/* Only pages that twice the memory would have kept resident */
+	if (distance >= cp_evictable) {
+		return;
+	}
+
+	if ((cp_state[idx] & CP_HOT) == 0U) {
+		cp_state[idx] = CP_HOT;
+		cp_hot++;
+	}
+	cp_cold_target_set(cp_cold_target + 1U);
+}
+
+unsigned long k_mem_paging_eviction_working_set_get(void)
+{
+	return cp_hot;
+}
+
+void k_mem_paging_eviction_init(void)
+{
+	uintptr_t phys;
+	struct k_mem_page_frame *pf;
+
+	K_MEM_PAGE_FRAME_FOREACH(phys, pf) {
+		if (k_mem_page_frame_is_evictable(pf)) {
+			cp_evictable++;
+		}
+	}
+
+	cp_cold_target_set(cp_evictable / 2U);
+}
+
+#ifdef CONFIG_EVICTION_TRACKING
+/*
+ * Empty functions defined here so that architectures unconditionally
+ * implement eviction tracking can still use this algorithm for
+ * testing.
+ */
+
+void k_mem_paging_eviction_add(struct k_mem_page_frame *pf)
+{
+	ARG_UNUSED(pf);
+}
+
+void k_mem_paging_eviction_remove(struct k_mem_page_frame *pf)
+{
+	ARG_UNUSED(pf);
+}
+
+void k_mem_paging_eviction_accessed(uintptr_t phys)
+{
+	ARG_UNUSED(phys);
+}
+
+#endif /* CONFIG_EVICTION_TRACKING */
@@ -17,6 +17,8 @@
 LOG_MODULE_REGISTER(net_conn, CONFIG_NET_CONN_LOG_LEVEL);
 
 #include <errno.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/barrier.h>
 #include <zephyr/sys/util.h>
 
 #include <zephyr/net/net_core.h>
@@ -113,6 +115,109 @@ void conn_register_debug(struct net_conn *conn,
 
 static K_MUTEX_DEFINE(conn_lock);
 
+#if defined(CONFIG_NET_CONN_HASH)
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_NET_CONN_HASH_BUCKETS),
+	     "CONFIG_NET_CONN_HASH_BUCKETS must be a power of two");
+
+/* Unicast packets are matched against the connections in three sets,
+ * on top of conn_used. Connections with the same rank have the same
+ * ports set so are in the same set, and the ones matching the same
+ * packet in the same bucket, in the order of conn_used. So the
+ * best match is the same as when walking conn_used.
+ */
+
+/* Connections with both ports set, hashed on both */
+static sys_slist_t conn_connected[CONFIG_NET_CONN_HASH_BUCKETS];
+
+/* Connections with only their local port set, hashed on it */
+static sys_slist_t conn_listeners[CONFIG_NET_CONN_HASH_BUCKETS];
+
+/* All other connections */
+static sys_slist_t conn_wild;
+
+/* Sequence count of the changes to the sets and to the connections in
+ * them, odd while one is in progress. Changes are made with conn_lock
+ * held, and the receive path reads the sets without taking it, then
+ * checks the count did not change meanwhile.
+ */
+static atomic_t conn_seq;
+
+/* Ports are in network byte order */
+static inline uint32_t conn_hash(uint16_t local_port, uint16_t remote_port)
+{
+	uint32_t key = ((uint32_t)local_port << 16) | remote_port;
+
+	return ((key * 0x9e3779b1U) >> 16) & (CONFIG_NET_CONN_HASH_BUCKETS - 1U);
+}
+
+static sys_slist_t *conn_hash_list(struct net_conn *conn)
+{
+	uint16_t local_port = net_sin(&conn->local_addr)->sin_port;
+	uint16_t remote_port = net_sin(&conn->remote_addr)->sin_port;
+
+	/* Ports are only compared for these families */
+	if ((conn->family != AF_INET && conn->family != AF_INET6 &&
+	     conn->family != AF_UNSPEC) ||
+	    !(conn->flags & NET_CONN_LOCAL_PORT_SPEC)) {
+		return &conn_wild;
+	}
+
+	if (conn->flags & NET_CONN_REMOTE_PORT_SPEC) {
+		return &conn_connected[conn_hash(local_port, remote_port)];
+	}
+
+	return &conn_listeners[conn_hash(local_port, 0U)];
+}
+
+/* The connection must be in conn_used already */
+static void conn_hash_add(struct net_conn *conn)
+{
+	struct net_conn *prev = NULL;
+	struct net_conn *used;
+
+	conn->hash_list = conn_hash_list(conn);
+
+	/* Keep the order of conn_used */
+	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, used, node) {
+		if (used == conn) {
+			break;
+		}
+
+		if (used->hash_list == conn->hash_list) {
+			prev = used;
+		}
+	}
+
+	if (prev != NULL) {
+		sys_slist_insert(conn->hash_list, &prev->hash_node, &conn->hash_node);
+	} else {
+		sys_slist_prepend(conn->hash_list, &conn->hash_node);
+	}
+}
+
+static void conn_hash_del(struct net_conn *conn)
+{
+	sys_slist_find_and_remove(conn->hash_list, &conn->hash_node);
+}
+
+static inline void conn_write_begin(void)
+{
+	(void)atomic_inc(&conn_seq);
+	barrier_dmem_fence_full();
+}
+
+static inline void conn_write_end(void)
+{
+	barrier_dmem_fence_full();
+	(void)atomic_inc(&conn_seq);
+}
+#else
+#define conn_hash_add(...)
+#define conn_hash_del(...)
+#define conn_write_begin(...)
+#define conn_write_end(...)
+#endif /* CONFIG_NET_CONN_HASH */
+
 static struct net_conn *conn_get_unused(void)
 {
 	sys_snode_t *node;
@@ -134,18 +239,22 @@ static struct net_conn *conn_get_unused(void)
 
 static void conn_set_used(struct net_conn *conn)
 {
-	conn->flags |= NET_CONN_IN_USE;
-
 	k_mutex_lock(&conn_lock, K_FOREVER);
+	conn_write_begin();
+	conn->flags |= NET_CONN_IN_USE;
 	sys_slist_prepend(&conn_used, &conn->node);
+	conn_hash_add(conn);
+	conn_write_end();
 	k_mutex_unlock(&conn_lock);
 }
 
 static void conn_set_unused(struct net_conn *conn)
 {
-	(void)memset(conn, 0, sizeof(*conn));
-
 	k_mutex_lock(&conn_lock, K_FOREVER);
+	/* The receive path may still be looking at the connection */
+	conn_write_begin();
+	(void)memset(conn, 0, sizeof(*conn));
+	conn_write_end();
 	sys_slist_prepend(&conn_unused, &conn->node);
 	k_mutex_unlock(&conn_lock);
 }
@@ -435,10 +544,10 @@ int net_conn_register(uint16_t proto, enum net_sock_type type, uint8_t family,
 		*handle = (struct net_conn_handle *)conn;
 	}
 
-	conn_set_used(conn);
-
 	conn->v6only = net_context_is_v6only_set(context);
 
+	conn_set_used(conn);
+
 	conn_register_debug(conn, remote_port, local_port);
 
 	return 0;
@@ -462,7 +571,10 @@ int net_conn_unregister(struct net_conn_handle *handle)
 	NET_DBG("Connection handler %p removed", conn);
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
+	conn_write_begin();
 	sys_slist_find_and_remove(&conn_used, &conn->node);
+	conn_hash_del(conn);
+	conn_write_end();
 	k_mutex_unlock(&conn_lock);
 
 	conn_set_unused(conn);
@@ -489,15 +601,25 @@ int net_conn_update(struct net_conn_handle *handle,
 		return -ENOENT;
 	}
 
+	k_mutex_lock(&conn_lock, K_FOREVER);
+	conn_write_begin();
+	conn_hash_del(conn);
+
 	net_conn_change_callback(conn, cb, user_data);
 
 	ret = net_conn_change_local(conn, local_addr, local_port);
 	if (ret < 0) {
-		return ret;
+		goto out;
 	}
 
 	ret = net_conn_change_remote(conn, remote_addr, remote_port);
 
+out:
+	/* The ports might have changed */
+	conn_hash_add(conn);
+	conn_write_end();
+	k_mutex_unlock(&conn_lock);
+
 	return ret;
 }
 
@@ -596,18 +718,25 @@ static bool conn_are_endpoints_valid(struct net_pkt *pkt, uint8_t family,
 	return !are_invalid_endpoints;
 }
 
-/* Is the candidate connection matching the packet's interface? */
+/* Is the candidate connection matching the packet's interface?
+ *
+ * The lookup may run without conn_lock, so the context is read once: it
+ * can be cleared meanwhile, but contexts are never freed, and the result
+ * is thrown away if the connection changed.
+ */
 static bool is_iface_matching(struct net_conn *conn, struct net_pkt *pkt)
 {
-	if (conn->context == NULL) {
+	struct net_context *context = *(struct net_context *volatile *)&conn->context;
+
+	if (context == NULL) {
 		return true;
 	}
 
-	if (!net_context_is_bound_to_iface(conn->context)) {
+	if (!net_context_is_bound_to_iface(context)) {
 		return true;
 	}
 
-	return (net_pkt_iface(pkt) == net_context_get_iface(conn->context));
+	return (net_pkt_iface(pkt) == net_context_get_iface(context));
 }
 
 #if defined(CONFIG_NET_SOCKETS_PACKET) || defined(CONFIG_NET_SOCKETS_INET_RAW)
@@ -873,6 +1002,181 @@ enum net_verdict net_conn_can_input(struct net_pkt *pkt, uint8_t proto)
 }
 #endif /* defined(CONFIG_NET_SOCKETS_CAN) */
 
+/* Is the candidate connection matching the packet? */
+static bool conn_match(struct net_conn *conn, struct net_pkt *pkt,
+		       union net_ip_header *ip_hdr, uint8_t proto,
+		       uint16_t src_port, uint16_t dst_port)
+{
+	uint8_t pkt_family = net_pkt_family(pkt);
+
+	/* Is the candidate connection matching the packet's interface? */
+	if (!is_iface_matching(conn, pkt)) {
+		return false; /* wrong interface */
+	}
+
+	/* Is the candidate connection matching the packet's protocol family? */
+	if (conn->family != AF_UNSPEC && conn->family != pkt_family) {
+		if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
+			if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
+			      !conn->v6only && conn->type != SOCK_RAW)) {
+				return false;
+			}
+		} else {
+			return false; /* wrong protocol family */
+		}
+
+		/* We might have a match for v4-to-v6 mapping, check more */
+	}
+
+	/* Is the candidate connection matching the packet's protocol within the family? */
+	if (conn->proto != proto) {
+		return false; /* wrong protocol */
+	}
+
+	/* Apply protocol-specific matching criteria... */
+	uint8_t conn_family = conn->family;
+
+	if (!((IS_ENABLED(CONFIG_NET_UDP) || IS_ENABLED(CONFIG_NET_TCP)) &&
+	      (conn_family == AF_INET || conn_family == AF_INET6 ||
+	       conn_family == AF_UNSPEC))) {
+		return false;
+	}
+
+	/* Is the candidate connection matching the packet's TCP/UDP
+	 * address and port?
+	 */
+	if (net_sin(&conn->remote_addr)->sin_port &&
+	    net_sin(&conn->remote_addr)->sin_port != src_port) {
+		return false; /* wrong remote port */
+	}
+
+	if (net_sin(&conn->local_addr)->sin_port &&
+	    net_sin(&conn->local_addr)->sin_port != dst_port) {
+		return false; /* wrong local port */
+	}
+
+	if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) &&
+	    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
+		return false; /* wrong remote address */
+	}
+
+	if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) &&
+	    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
+
+		/* Check if we could do a v4-mapping-to-v6 and the IPv6 socket
+		 * has no IPV6_V6ONLY option set and if the local IPV6 address
+		 * is unspecified, then we could accept a connection from IPv4
+		 * address by mapping it to IPv6 address.
+		 */
+		if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
+			if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
+			      !conn->v6only &&
+			      net_ipv6_is_addr_unspecified(
+				      &net_sin6(&conn->local_addr)->sin6_addr))) {
+				return false; /* wrong local address */
+			}
+		} else {
+			return false; /* wrong local address */
+		}
+
+		/* We might have a match for v4-to-v6 mapping,
+		 * continue with rank checking.
+		 */
+	}
+
+	return true;
+}
+
+#if defined(CONFIG_NET_CONN_HASH)
+/* Retries of a lookup without conn_lock before taking it */
+#define CONN_HASH_READ_TRIES 3
+
+static struct net_conn *conn_hash_scan(struct net_pkt *pkt,
+				       union net_ip_header *ip_hdr,
+				       uint8_t proto,
+				       uint16_t src_port, uint16_t dst_port,
+				       net_conn_cb_t *cb, void **user_data)
+{
+	sys_slist_t *lists[] = {
+		&conn_connected[conn_hash(dst_port, src_port)],
+		&conn_listeners[conn_hash(dst_port, 0U)],
+		&conn_wild,
+	};
+	struct net_conn *best_match = NULL;
+	int16_t best_rank = -1;
+	/* Without conn_lock, the lists can be changed under our feet and
+	 * even loop, but connections never leave conns[].
+	 */
+	int budget = CONFIG_NET_MAX_CONN;
+	struct net_conn *conn;
+	sys_snode_t *node;
+
+	ARRAY_FOR_EACH(lists, i) {
+		for (node = sys_slist_peek_head(lists[i]);
+		     node != NULL && budget-- > 0;
+		     node = sys_slist_peek_next_no_check(node)) {
+			conn = CONTAINER_OF(node, struct net_conn, hash_node);
+
+			if (best_rank >= NET_CONN_RANK(conn->flags) ||
+			    !conn_match(conn, pkt, ip_hdr, proto, src_port, dst_port)) {
+				continue;
+			}
+
+			best_rank = NET_CONN_RANK(conn->flags);
+			best_match = conn;
+		}
+	}
+
+	*cb = (best_match != NULL) ? best_match->cb : NULL;
+	*user_data = (best_match != NULL) ? best_match->user_data : NULL;
+
+	return best_match;
+}
+
+/* Find the best match for a unicast packet */
+static struct net_conn *conn_hash_lookup(struct net_pkt *pkt,
+					 union net_ip_header *ip_hdr,
+					 uint8_t proto,
+					 uint16_t src_port, uint16_t dst_port,
+					 net_conn_cb_t *cb, void **user_data)
+{
+	struct net_conn *best_match;
+	atomic_val_t seq;
+
+	for (int i = 0; i < CONN_HASH_READ_TRIES; i++) {
+		seq = atomic_get(&conn_seq);
+		if (seq & 1) {
+			/* Don't spin on a writer we may have preempted */
+			break;
+		}
+
+		best_match = conn_hash_scan(pkt, ip_hdr, proto, src_port, dst_port,
+					    cb, user_data);
+
+		barrier_dmem_fence_full();
+		if (atomic_get(&conn_seq) == seq) {
+			return best_match;
+		}
+	}
+
+	k_mutex_lock(&conn_lock, K_FOREVER);
+	best_match = conn_hash_scan(pkt, ip_hdr, proto, src_port, dst_port,
+				    cb, user_data);
+	k_mutex_unlock(&conn_lock);
+
+	return best_match;
+}
+#else
+static inline struct net_conn *conn_hash_lookup(struct net_pkt *pkt,
+						union net_ip_header *ip_hdr,
+						uint8_t proto,
+						uint16_t src_port, uint16_t dst_port,
+						net_conn_cb_t *cb, void **user_data)
+{
+	return NULL;
+}
+#endif /* CONFIG_NET_CONN_HASH */
+
 enum net_verdict net_conn_input(struct net_pkt *pkt,
 				union net_ip_header *ip_hdr,
 				uint8_t proto,
@@ -936,118 +1240,55 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		is_mcast_pkt = net_ipv6_is_addr_mcast((struct in6_addr *)ip_hdr->ipv6->dst);
 	}
 
+	if (IS_ENABLED(CONFIG_NET_CONN_HASH) && !is_mcast_pkt) {
+		best_match = conn_hash_lookup(pkt, ip_hdr, proto, src_port, dst_port,
+					      &cb, &user_data);
+		goto deliver;
+	}
+
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
 	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
-		/* Is the candidate connection matching the packet's interface? */
-		if (!is_iface_matching(conn, pkt)) {
-			continue; /* wrong interface */
+		if (!conn_match(conn, pkt, ip_hdr, proto, src_port, dst_port)) {
+			continue;
 		}
 
-		/* Is the candidate connection matching the packet's protocol family? */
-		if (conn->family != AF_UNSPEC && conn->family != pkt_family) {
-			if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
-				if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
-				      !conn->v6only && conn->type != SOCK_RAW)) {
-					continue;
-				}
-			} else {
-				continue; /* wrong protocol family */
-			}
+		if (best_rank < NET_CONN_RANK(conn->flags)) {
+			struct net_pkt *mcast_pkt;
 
-			/* We might have a match for v4-to-v6 mapping, check more */
-		}
+			if (!is_mcast_pkt) {
+				best_rank = NET_CONN_RANK(conn->flags);
+				best_match = conn;
 
-		/* Is the candidate connection matching the packet's protocol within the family? */
-		if (conn->proto != proto) {
-			continue; /* wrong protocol */
-		}
-
-		/* Apply protocol-specific matching criteria... */
-		uint8_t conn_family = conn->family;
+				continue; /* found a match - but maybe not yet the best */
+			}
 
-		if ((IS_ENABLED(CONFIG_NET_UDP) || IS_ENABLED(CONFIG_NET_TCP)) &&
-		    (conn_family == AF_INET || conn_family == AF_INET6 ||
-		     conn_family == AF_UNSPEC)) {
-			/* Is the candidate connection matching the packet's TCP/UDP
-			 * address and port?
+			/* If we have a multicast packet, and we found
+			 * a match, then deliver the packet immediately
+			 * to the handler. As there might be several
+			 * sockets interested about these, we need to
+			 * clone the received pkt.
 			 */
-			if (net_sin(&conn->remote_addr)->sin_port &&
-			    net_sin(&conn->remote_addr)->sin_port != src_port) {
-				continue; /* wrong remote port */
-			}
 
-			if (net_sin(&conn->local_addr)->sin_port &&
-			    net_sin(&conn->local_addr)->sin_port != dst_port) {
-				continue; /* wrong local port */
-			}
+			NET_DBG("[%p] mcast match found cb %p ud %p", conn, conn->cb,
+				conn->user_data);
 
-			if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
-				continue; /* wrong remote address */
+			mcast_pkt = net_pkt_clone(
+				pkt, K_MSEC(CONFIG_NET_CONN_PACKET_CLONE_TIMEOUT));
+			if (!mcast_pkt) {
+				k_mutex_unlock(&conn_lock);
+				goto drop;
 			}
 
-			if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
-
-				/* Check if we could do a v4-mapping-to-v6 and the IPv6 socket
-				 * has no IPV6_V6ONLY option set and if the local IPV6 address
-				 * is unspecified, then we could accept a connection from IPv4
-				 * address by mapping it to IPv6 address.
-				 */
-				if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
-					if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
-					      !conn->v6only &&
-					      net_ipv6_is_addr_unspecified(
-						      &net_sin6(&conn->local_addr)->sin6_addr))) {
-						continue; /* wrong local address */
-					}
-				} else {
-					continue; /* wrong local address */
-				}
-
-				/* We might have a match for v4-to-v6 mapping,
-				 * continue with rank checking.
-				 */
+			if (conn->cb(conn, mcast_pkt, ip_hdr, proto_hdr, conn->user_data) ==
+			    NET_DROP) {
+				net_stats_update_per_proto_drop(pkt_iface, proto);
+				net_pkt_unref(mcast_pkt);
+			} else {
+				net_stats_update_per_proto_recv(pkt_iface, proto);
 			}
 
-			if (best_rank < NET_CONN_RANK(conn->flags)) {
-				struct net_pkt *mcast_pkt;
-
-				if (!is_mcast_pkt) {
-					best_rank = NET_CONN_RANK(conn->flags);
-					best_match = conn;
-
-					continue; /* found a match - but maybe not yet the best */
-				}
-
-				/* If we have a multicast packet, and we found
-				 * a match, then deliver the packet immediately
-				 * to the handler. As there might be several
-				 * sockets interested about these, we need to
-				 * clone the received pkt.
-				 */
-
-				NET_DBG("[%p] mcast match found cb %p ud %p", conn, conn->cb,
-					conn->user_data);
-
-				mcast_pkt = net_pkt_clone(
-					pkt, K_MSEC(CONFIG_NET_CONN_PACKET_CLONE_TIMEOUT));
-				if (!mcast_pkt) {
-					k_mutex_unlock(&conn_lock);
-					goto drop;
-				}
-
-				if (conn->cb(conn, mcast_pkt, ip_hdr, proto_hdr, conn->user_data) ==
-				    NET_DROP) {
-					net_stats_update_per_proto_drop(pkt_iface, proto);
-					net_pkt_unref(mcast_pkt);
-				} else {
-					net_stats_update_per_proto_recv(pkt_iface, proto);
-				}
-
-				mcast_pkt_delivered = true;
-			}
+			mcast_pkt_delivered = true;
 		}
 	} /* loop end */
 
@@ -1067,6 +1308,7 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		return NET_OK;
 	}
 
+deliver:
 	if (cb != NULL) {
 		NET_DBG("[%p] match found cb %p ud %p rank 0x%02x", best_match, cb,
 			user_data, NET_CONN_RANK(best_match->flags));
@@ -1120,6 +1362,14 @@ void net_conn_init(void)
 	sys_slist_init(&conn_unused);
 	sys_slist_init(&conn_used);
 
+#if defined(CONFIG_NET_CONN_HASH)
+	ARRAY_FOR_EACH(conn_connected, i) {
+		sys_slist_init(&conn_connected[i]);
+		sys_slist_init(&conn_listeners[i]);
+	}
+	sys_slist_init(&conn_wild);
+#endif
+
 	for (i = 0; i < CONFIG_NET_MAX_CONN; i++) {
 		sys_slist_prepend(&conn_unused, &conns[i].node);
 	}
@@ -141,6 +141,17 @@ bool net_context_is_timestamping_set(struct net_context *context)
 #endif
 }
 
+bool net_context_is_zerocopy_set(struct net_context *context)
+{
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+	return context->options.zerocopy;
+#else
+	ARG_UNUSED(context);
+
+	return false;
+#endif
+}
+
 #if defined(CONFIG_NET_UDP) || defined(CONFIG_NET_TCP)
 static inline bool is_in_tcp_listen_state(struct net_context *context)
 {
@@ -622,6 +633,10 @@ int net_context_get(sa_family_t family, enum net_sock_type type, uint16_t proto,
 			k_sem_init(&contexts[i].recv_data_wait, 1, K_SEM_MAX_LIMIT);
 		}
 
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+		k_poll_signal_init(&contexts[i].zerocopy.signal);
+#endif
+
 		k_mutex_init(&contexts[i].lock);
 
 		contexts[i].flags |= NET_CONTEXT_IN_USE;
@@ -1944,6 +1959,20 @@ static int get_context_timestamping(struct net_context *context,
 #endif
 }
 
+static int get_context_zerocopy(struct net_context *context,
+				void *value, size_t *len)
+{
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+	return get_bool_option(context->options.zerocopy, value, len);
+#else
+	ARG_UNUSED(context);
+	ARG_UNUSED(value);
+	ARG_UNUSED(len);
+
+	return -ENOTSUP;
+#endif
+}
+
 static int get_context_mtu(struct net_context *context,
 			   void *value, size_t *len)
 {
@@ -2078,6 +2107,235 @@ static int get_context_ipv6_mcast_loop(struct net_context *context,
 #endif
 }
 
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+/* Sends completed out of order are tracked in a 32-bit bitmap */
+#define ZEROCOPY_MAX_INFLIGHT 32U
+
+struct zerocopy_info {
+	struct net_context *context;
+	uint32_t id;
+	/* Only the last buffer of a send completes it */
+	bool last;
+};
+
+static void zerocopy_destroy(struct net_buf *buf);
+
+NET_BUF_POOL_FIXED_DEFINE(zerocopy_pool, CONFIG_NET_CONTEXT_ZEROCOPY_BUF_COUNT,
+			  0, sizeof(struct zerocopy_info), zerocopy_destroy);
+
+/* Buffers may be released from any thread, or from drivers' interrupts */
+static struct k_spinlock zerocopy_lock;
+
+/* Dropping the last reference of a context locks it and unregisters its
+ * connection, which cannot be done from an interrupt: the references held
+ * by completed sends are dropped from the system work queue.
+ */
+static void zerocopy_unref_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	for (int i = 0; i < NET_MAX_CONTEXT; i++) {
+		atomic_val_t unrefs = atomic_clear(&contexts[i].zerocopy.unrefs);
+
+		while (unrefs-- > 0) {
+			net_context_unref(&contexts[i]);
+		}
+	}
+}
+
+static K_WORK_DEFINE(zerocopy_unref_work, zerocopy_unref_handler);
+
+static void zerocopy_destroy(struct net_buf *buf)
+{
+	struct zerocopy_info *info = net_buf_user_data(buf);
+	struct net_context *context = info->context;
+	k_spinlock_key_t key;
+
+	if (!info->last) {
+		net_buf_destroy(buf);
+		return;
+	}
+
+	key = k_spin_lock(&zerocopy_lock);
+	context->zerocopy.pending |= BIT(info->id - context->zerocopy.done);
+	while ((context->zerocopy.pending & BIT(0)) != 0U) {
+		context->zerocopy.pending >>= 1;
+		context->zerocopy.done++;
+	}
+	k_spin_unlock(&zerocopy_lock, key);
+
+	net_buf_destroy(buf);
+
+	k_poll_signal_raise(&context->zerocopy.signal, 0);
+
+	(void)atomic_inc(&context->zerocopy.unrefs);
+	(void)k_work_submit(&zerocopy_unref_work);
+}
+
+struct net_buf *net_context_zerocopy_bufs(struct net_context *context,
+					  const void *data, size_t len,
+					  const struct msghdr *msg)
+{
+	struct net_buf *frags = NULL;
+	struct net_buf *tail = NULL;
+	struct zerocopy_info *info;
+	struct net_buf *buf;
+	size_t i = 0;
+
+	if ((context->zerocopy.next - context->zerocopy.done) >=
+	    ZEROCOPY_MAX_INFLIGHT) {
+		return NULL;
+	}
+
+	while (len > 0) {
+		size_t buf_len = len;
+
+		if (msg != NULL) {
+			data = msg->msg_iov[i].iov_base;
+			buf_len = MIN(msg->msg_iov[i].iov_len, len);
+			i++;
+
+			if (buf_len == 0) {
+				continue;
+			}
+		}
+
+		buf = net_buf_alloc_with_data(&zerocopy_pool, (void *)data,
+					      buf_len, K_NO_WAIT);
+		if (buf == NULL) {
+			if (frags != NULL) {
+				net_buf_unref(frags);
+			}
+
+			return NULL;
+		}
+
+		info = net_buf_user_data(buf);
+		info->context = context;
+		info->last = false;
+
+		if (tail == NULL) {
+			frags = buf;
+		} else {
+			net_buf_frag_insert(tail, buf);
+		}
+
+		tail = buf;
+		len -= buf_len;
+	}
+
+	/* Keep the send from completing until it is known to have been made */
+	context->zerocopy.last = net_buf_ref(tail);
+
+	return frags;
+}
+
+/* The send is only numbered once it is known to have been made, which is
+ * why a reference to its last buffer was kept until then.
+ */
+static void zerocopy_end(struct net_context *context, bool sent)
+{
+	struct net_buf *last = context->zerocopy.last;
+	struct zerocopy_info *info;
+
+	if (last == NULL) {
+		return;
+	}
+
+	context->zerocopy.last = NULL;
+
+	if (sent) {
+		info = net_buf_user_data(last);
+		info->id = context->zerocopy.next++;
+		info->last = true;
+		net_context_ref(context);
+	}
+
+	net_buf_unref(last);
+}
+
+/* Lent datagrams are not put in buffers sized after the MTU, which would
+ * otherwise limit them, so check their size here.
+ */
+static bool zerocopy_dgram_fits(struct net_context *context,
+				sa_family_t family, size_t len)
+{
+	size_t mtu = net_if_get_mtu(net_context_get_iface(context));
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && family == AF_INET6) {
+		return IS_ENABLED(CONFIG_NET_IPV6_FRAGMENT) ||
+		       (len + NET_IPV6UDPH_LEN) <= MAX(mtu, NET_IPV6_MTU);
+	}
+
+	return IS_ENABLED(CONFIG_NET_IPV4_FRAGMENT) ||
+	       (len + NET_IPV4UDPH_LEN) <= MAX(mtu, NET_IPV4_MTU);
+}
+
+int net_context_zerocopy_get(struct net_context *context,
+			     uint32_t *lo, uint32_t *hi)
+{
+	k_spinlock_key_t key;
+	int ret = 0;
+
+	key = k_spin_lock(&zerocopy_lock);
+	if (context->zerocopy.reported == context->zerocopy.done) {
+		ret = -EAGAIN;
+	} else {
+		*lo = context->zerocopy.reported;
+		*hi = context->zerocopy.done - 1U;
+		context->zerocopy.reported = context->zerocopy.done;
+	}
+	k_spin_unlock(&zerocopy_lock, key);
+
+	return ret;
+}
+
+bool net_context_zerocopy_pending(struct net_context *context)
+{
+	k_spinlock_key_t key;
+	bool pending;
+
+	key = k_spin_lock(&zerocopy_lock);
+	pending = context->zerocopy.reported != context->zerocopy.done;
+	k_spin_unlock(&zerocopy_lock, key);
+
+	return pending;
+}
+#else
+static inline void zerocopy_end(struct net_context *context, bool sent)
+{
+	ARG_UNUSED(context);
+	ARG_UNUSED(sent);
+}
+
+static inline bool zerocopy_dgram_fits(struct net_context *context,
+				       sa_family_t family, size_t len)
+{
+	ARG_UNUSED(context);
+	ARG_UNUSED(family);
+	ARG_UNUSED(len);
+
+	return true;
+}
+
+int net_context_zerocopy_get(struct net_context *context,
+			     uint32_t *lo, uint32_t *hi)
+{
+	ARG_UNUSED(context);
+	ARG_UNUSED(lo);
+	ARG_UNUSED(hi);
+
+	return -ENOTSUP;
+}
+
+bool net_context_zerocopy_pending(struct net_context *context)
+{
+	ARG_UNUSED(context);
+
+	return false;
+}
+#endif /* CONFIG_NET_CONTEXT_ZEROCOPY */
+
 /* If buf is not NULL, then use it. Otherwise read the data to be written
  * to net_pkt from msghdr.
  */
@@ -2117,7 +2375,8 @@ static int context_setup_udp_packet(struct net_context *context,
 				    size_t len,
 				    const struct msghdr *msg,
 				    const struct sockaddr *dst_addr,
-				    socklen_t addrlen)
+				    socklen_t addrlen,
+				    struct net_buf *frags)
 {
 	int ret = -EINVAL;
 	uint16_t dst_port = 0U;
@@ -2139,12 +2398,12 @@ static int context_setup_udp_packet(struct net_context *context,
 	}
 
 	if (ret < 0) {
-		return ret;
+		goto fail;
 	}
 
 	ret = bind_default(context);
 	if (ret) {
-		return ret;
+		goto fail;
 	}
 
 	ret = net_udp_create(pkt,
@@ -2152,12 +2411,18 @@ static int context_setup_udp_packet(struct net_context *context,
 				     &context->local)->sin_port,
 			     dst_port);
 	if (ret) {
-		return ret;
+		goto fail;
 	}
 
-	ret = context_write_data(pkt, buf, len, msg);
-	if (ret) {
-		return ret;
+	if (frags != NULL) {
+		/* Reference the data lent for a zero-copy send */
+		net_pkt_trim_buffer(pkt);
+		net_pkt_append_buffer(pkt, frags);
+	} else {
+		ret = context_write_data(pkt, buf, len, msg);
+		if (ret) {
+			return ret;
+		}
 	}
 
 #if defined(CONFIG_NET_CONTEXT_TIMESTAMPING)
@@ -2171,6 +2436,13 @@ static int context_setup_udp_packet(struct net_context *context,
 #endif
 
 	return 0;
+
+fail:
+	if (frags != NULL) {
+		net_buf_unref(frags);
+	}
+
+	return ret;
 }
 
 static int context_setup_raw_ip_packet(sa_family_t family,
@@ -2303,7 +2575,8 @@ static int context_sendto(struct net_context *context,
 			  net_context_send_cb_t cb,
 			  k_timeout_t timeout,
 			  void *user_data,
-			  bool sendto)
+			  bool sendto,
+			  bool zerocopy)
 {
 	const struct msghdr *msghdr = NULL;
 	struct net_if *iface = NULL;
@@ -2566,6 +2839,15 @@ static int context_sendto(struct net_context *context,
 		return -ENETDOWN;
 	}
 
+	if (zerocopy && (len == 0 || net_if_is_ip_offloaded(iface))) {
+		zerocopy = false;
+	}
+
+	if (zerocopy && net_context_get_proto(context) == IPPROTO_UDP &&
+	    !zerocopy_dgram_fits(context, family, len)) {
+		return -EMSGSIZE;
+	}
+
 	context->send_cb = cb;
 	context->user_data = user_data;
 
@@ -2575,7 +2857,9 @@ static int context_sendto(struct net_context *context,
 		goto skip_alloc;
 	}
 
-	pkt = context_alloc_pkt(context, family, len, PKT_WAIT_TIME);
+	/* Lent data needs no room in the packet buffers */
+	pkt = context_alloc_pkt(context, family, zerocopy ? 0 : len,
+				PKT_WAIT_TIME);
 	if (!pkt) {
 		NET_ERR("Failed to allocate net_pkt");
 		return -ENOBUFS;
@@ -2583,7 +2867,7 @@ static int context_sendto(struct net_context *context,
 
 	tmp_len = net_pkt_available_payload_buffer(
 				pkt, net_context_get_proto(context));
-	if (tmp_len < len) {
+	if (!zerocopy && tmp_len < len) {
 		if (net_context_get_type(context) == SOCK_DGRAM ||
 		    net_context_get_type(context) == SOCK_RAW) {
 			NET_ERR("Available payload buffer (%zu) is not enough for requested DGRAM (%zu)",
@@ -2645,8 +2929,18 @@ skip_alloc:
 		ret = net_try_send_data(pkt, timeout);
 	} else if (IS_ENABLED(CONFIG_NET_UDP) &&
 	    net_context_get_proto(context) == IPPROTO_UDP) {
+		struct net_buf *frags = NULL;
+
+		if (zerocopy) {
+			frags = net_context_zerocopy_bufs(context, buf, len, msghdr);
+			if (frags == NULL) {
+				ret = -ENOBUFS;
+				goto fail;
+			}
+		}
+
 		ret = context_setup_udp_packet(context, family, pkt, buf, len, msghdr,
-					       dst_addr, addrlen);
+					       dst_addr, addrlen, frags);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -2657,7 +2951,7 @@ skip_alloc:
 	} else if (IS_ENABLED(CONFIG_NET_TCP) &&
 		   net_context_get_proto(context) == IPPROTO_TCP) {
 
-		ret = net_tcp_queue(context, buf, len, msghdr);
+		ret = net_tcp_queue(context, buf, len, msghdr, zerocopy);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -2712,12 +3006,16 @@ skip_alloc:
 		goto fail;
 	}
 
+	zerocopy_end(context, true);
+
 	return len;
 fail:
 	if (pkt != NULL) {
 		net_pkt_unref(pkt);
 	}
 
+	zerocopy_end(context, false);
+
 	return ret;
 }
 
@@ -2839,7 +3137,7 @@ int net_context_send(struct net_context *context,
 	}
 
 	ret = context_sendto(context, buf, len, &context->remote,
-			     addrlen, cb, timeout, user_data, false);
+			     addrlen, cb, timeout, user_data, false, false);
 unlock:
 	k_mutex_unlock(&context->lock);
 
@@ -2858,7 +3156,9 @@ int net_context_sendmsg(struct net_context *context,
 	k_mutex_lock(&context->lock, K_FOREVER);
 
 	ret = context_sendto(context, msghdr, 0, NULL, 0,
-			     cb, timeout, user_data, true);
+			     cb, timeout, user_data, true,
+			     (flags & ZSOCK_MSG_ZEROCOPY) &&
+			     net_context_is_zerocopy_set(context));
 
 	k_mutex_unlock(&context->lock);
 
@@ -2879,7 +3179,7 @@ int net_context_sendto(struct net_context *context,
 	k_mutex_lock(&context->lock, K_FOREVER);
 
 	ret = context_sendto(context, buf, len, dst_addr, addrlen,
-			     cb, timeout, user_data, true);
+			     cb, timeout, user_data, true, false);
 
 	k_mutex_unlock(&context->lock);
 
@@ -3675,6 +3975,25 @@ static int set_context_timestamping(struct net_context *context,
 #endif
 }
 
+static int set_context_zerocopy(struct net_context *context,
+				const void *value, size_t len)
+{
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+	if (net_context_get_proto(context) != IPPROTO_TCP &&
+	    net_context_get_proto(context) != IPPROTO_UDP) {
+		return -EOPNOTSUPP;
+	}
+
+	return set_bool_option(&context->options.zerocopy, value, len);
+#else
+	ARG_UNUSED(context);
+	ARG_UNUSED(value);
+	ARG_UNUSED(len);
+
+	return -ENOTSUP;
+#endif
+}
+
 static int set_context_mcast_ifindex(struct net_context *context,
 				     const void *value, size_t len)
 {
@@ -3867,6 +4186,9 @@ int net_context_set_option(struct net_context *context,
 	case NET_OPT_IPV4_MCAST_LOOP:
 		ret = set_context_ipv4_mcast_loop(context, value, len);
 		break;
+	case NET_OPT_ZEROCOPY:
+		ret = set_context_zerocopy(context, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&context->lock);
@@ -3958,6 +4280,9 @@ int net_context_get_option(struct net_context *context,
 	case NET_OPT_IPV4_MCAST_LOOP:
 		ret = get_context_ipv4_mcast_loop(context, value, len);
 		break;
+	case NET_OPT_ZEROCOPY:
+		ret = get_context_zerocopy(context, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&context->lock);
@@ -426,6 +426,10 @@ int net_try_send_data(struct net_pkt *pkt, k_timeout_t timeout)
 		 * to RX processing.
 		 */
 		NET_DBG("Loopback pkt %p back to us", pkt);
+
+		/* The segments of a GSO packet have no checksum yet */
+		net_pkt_set_gso_verified(pkt, true);
+
 		processing_data(pkt, true);
 		ret = 0;
 		goto err;
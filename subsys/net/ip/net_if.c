@@ -259,7 +259,11 @@ static bool net_if_tx(struct net_if *iface, struct net_pkt *pkt)
 		}
 
 		net_if_tx_lock(iface);
-		status = net_if_l2(iface)->send(iface, pkt);
+		if (net_pkt_gso_size(pkt) > 0U) {
+			status = net_tcp_gso_send(iface, pkt);
+		} else {
+			status = net_if_l2(iface)->send(iface, pkt);
+		}
 		net_if_tx_unlock(iface);
 		if (status < 0) {
 			NET_WARN("iface %d pkt %p send failure status %d",
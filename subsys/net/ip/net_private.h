@@ -97,6 +97,7 @@ extern bool net_context_is_reuseport_set(struct net_context *context);
 extern bool net_context_is_v6only_set(struct net_context *context);
 extern bool net_context_is_recv_pktinfo_set(struct net_context *context);
 extern bool net_context_is_timestamping_set(struct net_context *context);
+extern bool net_context_is_zerocopy_set(struct net_context *context);
 extern void net_pkt_init(void);
 int net_context_get_local_addr(struct net_context *context,
 			       struct sockaddr *addr,
@@ -129,6 +130,11 @@ static inline bool net_context_is_timestamping_set(struct net_context *context)
 	ARG_UNUSED(context);
 	return false;
 }
+static inline bool net_context_is_zerocopy_set(struct net_context *context)
+{
+	ARG_UNUSED(context);
+	return false;
+}
 
 static inline int net_context_get_local_addr(struct net_context *context,
 					     struct sockaddr *addr,
@@ -142,6 +148,38 @@ static inline int net_context_get_local_addr(struct net_context *context,
 }
 #endif
 
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+/**
+ * @brief Get buffers referencing the data of a zero-copy send
+ *
+ * The send is completed once these buffers are released, provided that
+ * it is made.
+ *
+ * @param context Network context
+ * @param data Pointer to the data, if msg is NULL
+ * @param len Number of bytes
+ * @param msg Data for a vector array operation
+ *
+ * @return Buffers if ok, NULL if there are too many sends in progress or
+ * not enough buffers.
+ */
+struct net_buf *net_context_zerocopy_bufs(struct net_context *context,
+					  const void *data, size_t len,
+					  const struct msghdr *msg);
+#else
+static inline struct net_buf *net_context_zerocopy_bufs(struct net_context *context,
+							const void *data, size_t len,
+							const struct msghdr *msg)
+{
+	ARG_UNUSED(context);
+	ARG_UNUSED(data);
+	ARG_UNUSED(len);
+	ARG_UNUSED(msg);
+
+	return NULL;
+}
+#endif /* CONFIG_NET_CONTEXT_ZEROCOPY */
+
 #if defined(CONFIG_DNS_SOCKET_DISPATCHER)
 extern void dns_dispatcher_init(void);
 #else
@@ -273,6 +311,25 @@ int net_ipv6_send_fragmented_pkt(struct net_if *iface, struct net_pkt *pkt,
 				 uint16_t pkt_len, uint16_t mtu);
 #endif
 
+#if defined(CONFIG_NET_TCP_GSO) || defined(CONFIG_NET_TCP_GRO)
+int net_tcp_gso_send(struct net_if *iface, struct net_pkt *pkt);
+#else
+static inline int net_tcp_gso_send(struct net_if *iface, struct net_pkt *pkt)
+{
+	ARG_UNUSED(iface);
+	ARG_UNUSED(pkt);
+
+	return -ENOTSUP;
+}
+#endif
+
+#if defined(CONFIG_NET_TCP_GRO)
+/* Moves the payload of next to pkt if it is the following segment of the
+ * same TCP connection. next is then left to be freed by the caller.
+ */
+bool net_tcp_gro_merge(struct net_pkt *pkt, struct net_pkt *next);
+#endif /* CONFIG_NET_TCP_GRO */
+
 extern const char *net_verdict2str(enum net_verdict verdict);
 extern const char *net_proto2str(int family, int proto);
 extern char *net_byte_to_hex(char *ptr, uint8_t byte, char base, bool pad);
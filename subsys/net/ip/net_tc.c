@@ -307,6 +307,18 @@ static void tc_rx_handler(void *p1, void *p2, void *p3)
 		k_sem_give(fifo_slot);
 #endif
 
+#if defined(CONFIG_NET_TCP_GRO)
+		/* This thread is the only consumer of the queue, so the packet
+		 * at its head can be merged before it is dequeued.
+		 */
+		while (net_tcp_gro_merge(pkt, k_fifo_peek_head(fifo))) {
+			net_pkt_unref(k_fifo_get(fifo, K_NO_WAIT));
+#if NET_TC_RX_EFFECTIVE_COUNT > 1
+			k_sem_give(fifo_slot);
+#endif
+		}
+#endif /* CONFIG_NET_TCP_GRO */
+
 		net_process_rx_packet(pkt);
 	}
 }
@@ -69,6 +69,9 @@ static int tcp_tx_window =
 #define TCP_CONGESTION_INITIAL_WIN 1
 #define TCP_CONGESTION_INITIAL_SSTHRESH 3
 
+/* Largest payload of a GSO packet, the IPv4 total length being 16-bit */
+#define TCP_GSO_MAX_LEN (UINT16_MAX - NET_IPV4TCPH_LEN)
+
 static sys_slist_t tcp_conns = SYS_SLIST_STATIC_INIT(&tcp_conns);
 
 static K_MUTEX_DEFINE(tcp_lock);
@@ -1474,6 +1477,7 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		/* Append the data buffer to the pkt */
 		net_pkt_append_buffer(pkt, data->buffer);
 		data->buffer = NULL;
+		net_pkt_set_gso_size(pkt, net_pkt_gso_size(data));
 	}
 
 	ret = ip_header_add(conn, pkt);
@@ -1541,9 +1545,22 @@ static int tcp_pkt_pull(struct net_pkt *pkt, size_t len)
 		goto out;
 	}
 
+	/* Move the data pointers rather than the remaining data, which may
+	 * have been lent by the application.
+	 */
+	while (len > 0) {
+		struct net_buf *buf = pkt->buffer;
+		size_t pull_len = MIN(len, buf->len);
+
+		net_buf_pull(buf, pull_len);
+		len -= pull_len;
+
+		if (buf->len == 0U) {
+			pkt->buffer = net_buf_frag_del(NULL, buf);
+		}
+	}
+
 	net_pkt_cursor_init(pkt);
-	net_pkt_set_overwrite(pkt, true);
-	net_pkt_pull(pkt, len);
 	net_pkt_trim_buffer(pkt);
  out:
 	return ret;
@@ -1663,9 +1680,18 @@ static int tcp_send_data(struct tcp *conn)
 {
 	int ret = 0;
 	int len;
+	int max_len = conn_mss(conn);
 	struct net_pkt *pkt;
 
-	len = MIN(tcp_unsent_len(conn), conn_mss(conn));
+#if defined(CONFIG_NET_TCP_GSO)
+	/* Retransmissions are still sent one segment at a time */
+	if (conn->data_mode != TCP_DATA_MODE_RESEND) {
+		max_len *= CONFIG_NET_TCP_GSO_MAX_SEGS;
+		max_len = MIN(max_len, (int)ROUND_DOWN(TCP_GSO_MAX_LEN, conn_mss(conn)));
+	}
+#endif
+
+	len = MIN(tcp_unsent_len(conn), max_len);
 	if (len < 0) {
 		ret = len;
 		goto out;
@@ -1690,6 +1716,10 @@ static int tcp_send_data(struct tcp *conn)
 		goto out;
 	}
 
+	if (len > conn_mss(conn)) {
+		net_pkt_set_gso_size(pkt, conn_mss(conn));
+	}
+
 	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + conn->unacked_len);
 	if (ret == 0) {
 		conn->unacked_len += len;
@@ -3576,7 +3606,7 @@ int net_tcp_update_recv_wnd(struct net_context *context, int32_t delta)
 }
 
 int net_tcp_queue(struct net_context *context, const void *data, size_t len,
-		  const struct msghdr *msg)
+		  const struct msghdr *msg, bool zerocopy)
 {
 	struct tcp *conn = context->tcp;
 	size_t queued_len = 0;
@@ -3612,7 +3642,18 @@ int net_tcp_queue(struct net_context *context, const void *data, size_t len,
 	 */
 	len = MIN(conn->send_win - conn->send_data_total, len);
 
-	if (msg) {
+	if (zerocopy) {
+		struct net_buf *frags;
+
+		frags = net_context_zerocopy_bufs(context, data, len, msg);
+		if (frags == NULL) {
+			ret = -ENOBUFS;
+			goto out;
+		}
+
+		net_pkt_append_buffer(conn->send_data, frags);
+		queued_len = len;
+	} else if (msg) {
 		for (int i = 0; i < msg->msg_iovlen; i++) {
 			int iovlen = MIN(msg->msg_iov[i].iov_len, len);
 
@@ -3986,7 +4027,9 @@ int net_tcp_finalize(struct net_pkt *pkt, bool force_chksum)
 
 	tcp_hdr->chksum = 0U;
 
-	if (net_if_need_calc_tx_checksum(net_pkt_iface(pkt), type) || force_chksum) {
+	/* The checksums of a GSO packet are computed for each segment */
+	if ((net_if_need_calc_tx_checksum(net_pkt_iface(pkt), type) &&
+	     net_pkt_gso_size(pkt) == 0U) || force_chksum) {
 		tcp_hdr->chksum = net_calc_chksum_tcp(pkt);
 		net_pkt_set_chksum_done(pkt, true);
 	}
@@ -4001,9 +4044,14 @@ struct net_tcp_hdr *net_tcp_input(struct net_pkt *pkt,
 	enum net_if_checksum_type type = net_pkt_family(pkt) == AF_INET6 ?
 		NET_IF_CHECKSUM_IPV6_TCP : NET_IF_CHECKSUM_IPV4_TCP;
 
+	/* A packet made of several segments sent locally has no checksum, and
+	 * one coalesced from segments has a stale one, their segments being
+	 * verified when they were merged. Both are flagged as verified.
+	 */
 	if (IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) &&
 	    (net_if_need_calc_rx_checksum(net_pkt_iface(pkt), type) ||
 	     net_pkt_is_ip_reassembled(pkt)) &&
+	    (net_pkt_gso_size(pkt) == 0U || !net_pkt_is_gso_verified(pkt)) &&
 	    net_calc_chksum_tcp(pkt) != 0U) {
 		NET_DBG("DROP: checksum mismatch");
 		goto drop;
@@ -0,0 +1,311 @@
+/** @file
+ * @brief TCP generic receive offload
+ *
+ * Coalesces consecutive segments of a TCP connection, queued together in
+ * a RX traffic class, into one packet before it is processed by the stack.
+ */
+
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/ethernet.h>
+#include "net_private.h"
+#include "tcp_internal.h"
+
+struct gro_hdrs {
+	uint8_t *l3;
+	struct net_tcp_hdr *tcp;
+	sa_family_t family;
+	uint16_t l2_len;
+	uint16_t l3_len;
+	uint16_t hdr_len;
+	/* Value of the length field of the IP header */
+	uint16_t ip_len;
+	uint16_t payload_len;
+};
+
+/* All the headers must be in the first buffer of the packet, and the
+ * packet must not contain link layer padding.
+ */
+static bool gro_parse(struct net_pkt *pkt, struct gro_hdrs *hdrs)
+{
+	const struct net_l2 *l2 = net_if_l2(net_pkt_iface(pkt));
+	struct net_buf *buf = pkt->buffer;
+	size_t tcp_len;
+	size_t total;
+
+	if (!buf || buf->len == 0U) {
+		return false;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_L2_ETHERNET) && l2 == &NET_L2_GET_NAME(ETHERNET)) {
+		struct net_eth_hdr *eth_hdr = (struct net_eth_hdr *)buf->data;
+
+		if (buf->len < sizeof(struct net_eth_hdr)) {
+			return false;
+		}
+
+		hdrs->l2_len = sizeof(struct net_eth_hdr);
+
+		switch (ntohs(eth_hdr->type)) {
+		case NET_ETH_PTYPE_IP:
+			hdrs->family = AF_INET;
+			break;
+		case NET_ETH_PTYPE_IPV6:
+			hdrs->family = AF_INET6;
+			break;
+		default:
+			return false;
+		}
+	} else if (IS_ENABLED(CONFIG_NET_L2_DUMMY) && l2 == &NET_L2_GET_NAME(DUMMY)) {
+		hdrs->l2_len = 0U;
+
+		switch (buf->data[0] & 0xf0) {
+		case 0x40:
+			hdrs->family = AF_INET;
+			break;
+		case 0x60:
+			hdrs->family = AF_INET6;
+			break;
+		default:
+			return false;
+		}
+	} else {
+		return false;
+	}
+
+	hdrs->l3 = buf->data + hdrs->l2_len;
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && hdrs->family == AF_INET) {
+		struct net_ipv4_hdr *ipv4_hdr = (struct net_ipv4_hdr *)hdrs->l3;
+
+		if (buf->len < hdrs->l2_len + sizeof(struct net_ipv4_hdr)) {
+			return false;
+		}
+
+		/* No options, no fragments */
+		if (ipv4_hdr->vhl != 0x45 || ipv4_hdr->proto != IPPROTO_TCP ||
+		    (sys_get_be16(ipv4_hdr->offset) &
+		     (NET_IPV4_MORE_FRAG_MASK | NET_IPV4_FRAGH_OFFSET_MASK))) {
+			return false;
+		}
+
+		hdrs->l3_len = sizeof(struct net_ipv4_hdr);
+		hdrs->ip_len = ntohs(ipv4_hdr->len);
+		total = hdrs->ip_len;
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) && hdrs->family == AF_INET6) {
+		struct net_ipv6_hdr *ipv6_hdr = (struct net_ipv6_hdr *)hdrs->l3;
+
+		if (buf->len < hdrs->l2_len + sizeof(struct net_ipv6_hdr)) {
+			return false;
+		}
+
+		/* No extension headers */
+		if (ipv6_hdr->nexthdr != IPPROTO_TCP) {
+			return false;
+		}
+
+		hdrs->l3_len = sizeof(struct net_ipv6_hdr);
+		hdrs->ip_len = ntohs(ipv6_hdr->len);
+		total = hdrs->l3_len + hdrs->ip_len;
+	} else {
+		return false;
+	}
+
+	if (buf->len < hdrs->l2_len + hdrs->l3_len + sizeof(struct net_tcp_hdr) ||
+	    net_pkt_get_len(pkt) != hdrs->l2_len + total) {
+		return false;
+	}
+
+	hdrs->tcp = (struct net_tcp_hdr *)(hdrs->l3 + hdrs->l3_len);
+	tcp_len = (hdrs->tcp->offset >> 4) * 4U;
+
+	if (tcp_len < sizeof(struct net_tcp_hdr) ||
+	    buf->len < hdrs->l2_len + hdrs->l3_len + tcp_len ||
+	    total < hdrs->l3_len + tcp_len) {
+		return false;
+	}
+
+	hdrs->hdr_len = hdrs->l2_len + hdrs->l3_len + tcp_len;
+	hdrs->payload_len = total - hdrs->l3_len - tcp_len;
+
+	return true;
+}
+
+static bool gro_same_flow(struct net_pkt *pkt, const struct gro_hdrs *hdrs,
+			  struct net_pkt *next, const struct gro_hdrs *next_hdrs)
+{
+	const struct net_tcp_hdr *tcp = hdrs->tcp;
+	const struct net_tcp_hdr *next_tcp = next_hdrs->tcp;
+
+	if (hdrs->family != next_hdrs->family ||
+	    hdrs->hdr_len != next_hdrs->hdr_len ||
+	    net_pkt_vlan_tci(pkt) != net_pkt_vlan_tci(next) ||
+	    memcmp(pkt->buffer->data, next->buffer->data, hdrs->l2_len) != 0) {
+		return false;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && hdrs->family == AF_INET) {
+		const struct net_ipv4_hdr *ipv4_hdr = (struct net_ipv4_hdr *)hdrs->l3;
+		const struct net_ipv4_hdr *next_ipv4_hdr = (struct net_ipv4_hdr *)next_hdrs->l3;
+
+		if (ipv4_hdr->tos != next_ipv4_hdr->tos ||
+		    ipv4_hdr->ttl != next_ipv4_hdr->ttl ||
+		    memcmp(ipv4_hdr->src, next_ipv4_hdr->src, 2 * NET_IPV4_ADDR_SIZE) != 0) {
+			return false;
+		}
+	} else {
+		const struct net_ipv6_hdr *ipv6_hdr = (struct net_ipv6_hdr *)hdrs->l3;
+		const struct net_ipv6_hdr *next_ipv6_hdr = (struct net_ipv6_hdr *)next_hdrs->l3;
+
+		/* Version, traffic class and flow label */
+		if (memcmp(ipv6_hdr, next_ipv6_hdr, 4) != 0 ||
+		    ipv6_hdr->hop_limit != next_ipv6_hdr->hop_limit ||
+		    memcmp(ipv6_hdr->src, next_ipv6_hdr->src, 2 * NET_IPV6_ADDR_SIZE) != 0) {
+			return false;
+		}
+	}
+
+	/* Plain data segments, the last one of a packet can carry PSH */
+	if (tcp->flags != ACK || (next_tcp->flags & ~PSH) != ACK) {
+		return false;
+	}
+
+	return tcp->src_port == next_tcp->src_port &&
+	       tcp->dst_port == next_tcp->dst_port &&
+	       memcmp(tcp->ack, next_tcp->ack, sizeof(tcp->ack)) == 0 &&
+	       memcmp(tcp->wnd, next_tcp->wnd, sizeof(tcp->wnd)) == 0 &&
+	       memcmp(tcp->optdata, next_tcp->optdata,
+		      hdrs->hdr_len - hdrs->l2_len - hdrs->l3_len -
+		      sizeof(struct net_tcp_hdr)) == 0 &&
+	       sys_get_be32(next_tcp->seq) == sys_get_be32(tcp->seq) + hdrs->payload_len;
+}
+
+/* The checksums are verified here as the coalesced packet is not, which also
+ * keeps a corrupted segment from being merged.
+ */
+static bool gro_chksum_ok(struct net_pkt *pkt, const struct gro_hdrs *hdrs)
+{
+	struct net_if *iface = net_pkt_iface(pkt);
+	sa_family_t family = net_pkt_family(pkt);
+	uint8_t ip_hdr_len = net_pkt_ip_hdr_len(pkt);
+	bool ok = true;
+
+	net_buf_pull(pkt->buffer, hdrs->l2_len);
+	net_pkt_set_family(pkt, hdrs->family);
+	net_pkt_set_ip_hdr_len(pkt, hdrs->l3_len);
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && hdrs->family == AF_INET) {
+		if (net_if_need_calc_rx_checksum(iface, NET_IF_CHECKSUM_IPV4_HEADER) &&
+		    net_calc_chksum_ipv4(pkt) != 0U) {
+			ok = false;
+		} else if (IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) &&
+			   net_if_need_calc_rx_checksum(iface, NET_IF_CHECKSUM_IPV4_TCP) &&
+			   net_calc_chksum_tcp(pkt) != 0U) {
+			ok = false;
+		}
+	} else if (IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) &&
+		   net_if_need_calc_rx_checksum(iface, NET_IF_CHECKSUM_IPV6_TCP) &&
+		   net_calc_chksum_tcp(pkt) != 0U) {
+		ok = false;
+	}
+
+	net_buf_push(pkt->buffer, hdrs->l2_len);
+	net_pkt_set_family(pkt, family);
+	net_pkt_set_ip_hdr_len(pkt, ip_hdr_len);
+
+	return ok;
+}
+
+static void gro_update_ipv4_chksum(struct net_pkt *pkt, const struct gro_hdrs *hdrs)
+{
+	struct net_ipv4_hdr *ipv4_hdr = (struct net_ipv4_hdr *)hdrs->l3;
+	uint8_t ip_hdr_len = net_pkt_ip_hdr_len(pkt);
+
+	net_buf_pull(pkt->buffer, hdrs->l2_len);
+	net_pkt_set_ip_hdr_len(pkt, hdrs->l3_len);
+
+	ipv4_hdr->chksum = 0U;
+	ipv4_hdr->chksum = net_calc_chksum_ipv4(pkt);
+
+	net_buf_push(pkt->buffer, hdrs->l2_len);
+	net_pkt_set_ip_hdr_len(pkt, ip_hdr_len);
+}
+
+bool net_tcp_gro_merge(struct net_pkt *pkt, struct net_pkt *next)
+{
+	struct gro_hdrs hdrs;
+	struct gro_hdrs next_hdrs;
+	struct net_buf *buf;
+	uint16_t gso_size;
+	uint8_t psh;
+
+	if (!next || net_pkt_iface(pkt) != net_pkt_iface(next) ||
+	    !gro_parse(pkt, &hdrs) || !gro_parse(next, &next_hdrs) ||
+	    !gro_same_flow(pkt, &hdrs, next, &next_hdrs)) {
+		return false;
+	}
+
+	/* All the segments but the last one must be of the same size, so that
+	 * the packet can be split again if it is forwarded.
+	 */
+	gso_size = net_pkt_gso_size(pkt) ? net_pkt_gso_size(pkt) : hdrs.payload_len;
+
+	if (hdrs.payload_len == 0U || next_hdrs.payload_len == 0U ||
+	    next_hdrs.payload_len > gso_size ||
+	    hdrs.payload_len % gso_size != 0U ||
+	    hdrs.payload_len / gso_size >= CONFIG_NET_TCP_GRO_MAX_SEGS ||
+	    hdrs.ip_len + next_hdrs.payload_len > UINT16_MAX) {
+		return false;
+	}
+
+	if ((!net_pkt_is_gso_verified(pkt) && !gro_chksum_ok(pkt, &hdrs)) ||
+	    !gro_chksum_ok(next, &next_hdrs)) {
+		return false;
+	}
+
+	psh = next_hdrs.tcp->flags & PSH;
+
+	/* Only the payload of next is kept */
+	buf = next->buffer;
+	next->buffer = NULL;
+
+	net_buf_pull(buf, next_hdrs.hdr_len);
+	if (buf->len == 0U) {
+		buf = net_buf_frag_del(NULL, buf);
+	}
+
+	net_pkt_append_buffer(pkt, buf);
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && hdrs.family == AF_INET) {
+		struct net_ipv4_hdr *ipv4_hdr = (struct net_ipv4_hdr *)hdrs.l3;
+
+		ipv4_hdr->len = htons(hdrs.ip_len + next_hdrs.payload_len);
+		gro_update_ipv4_chksum(pkt, &hdrs);
+	} else {
+		struct net_ipv6_hdr *ipv6_hdr = (struct net_ipv6_hdr *)hdrs.l3;
+
+		ipv6_hdr->len = htons(hdrs.ip_len + next_hdrs.payload_len);
+	}
+
+	hdrs.tcp->flags |= psh;
+
+	net_pkt_set_gso_size(pkt, gso_size);
+	net_pkt_set_gso_verified(pkt, true);
+
+	NET_DBG("Merged %u bytes of %p to %p", next_hdrs.payload_len, next, pkt);
+
+	return true;
+}
@@ -0,0 +1,196 @@
+/** @file
+ * @brief TCP generic segmentation offload
+ *
+ * Splits a TCP packet made of several MSS sized segments just before it is
+ * passed to L2.
+ */
+
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <errno.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/ethernet.h>
+#include "net_private.h"
+#include "tcp_internal.h"
+#include "ipv4.h"
+#include "ipv6.h"
+
+static bool gso_hw_supported(struct net_if *iface)
+{
+	return IS_ENABLED(CONFIG_NET_L2_ETHERNET) &&
+		net_if_l2(iface) == &NET_L2_GET_NAME(ETHERNET) &&
+		(net_eth_get_hw_capabilities(iface) & ETHERNET_HW_TSO);
+}
+
+static struct net_pkt *gso_segment(struct net_pkt *pkt, size_t l3_len,
+				   size_t hdr_len, size_t offset, size_t len,
+				   bool last)
+{
+	NET_PKT_DATA_ACCESS_CONTIGUOUS_DEFINE(tcp_access, struct net_tcp_hdr);
+	struct net_tcp_hdr *tcp_hdr;
+	struct net_pkt *seg;
+	int ret;
+
+	seg = net_pkt_shallow_clone(pkt, K_MSEC(CONFIG_NET_TCP_PKT_ALLOC_TIMEOUT));
+	if (!seg) {
+		return NULL;
+	}
+
+	/* The segment gets its own buffer, only the attributes are shared */
+	net_pkt_frag_unref(seg->buffer);
+	seg->buffer = NULL;
+
+	if (net_pkt_alloc_buffer_raw(seg, hdr_len + len,
+				     K_MSEC(CONFIG_NET_TCP_PKT_ALLOC_TIMEOUT))) {
+		goto fail;
+	}
+
+	net_pkt_cursor_init(seg);
+	net_pkt_cursor_init(pkt);
+
+	if (net_pkt_copy(seg, pkt, hdr_len) ||
+	    net_pkt_skip(pkt, offset) ||
+	    net_pkt_copy(seg, pkt, len)) {
+		goto fail;
+	}
+
+	net_pkt_set_gso_size(seg, 0U);
+
+	if (!last) {
+		net_pkt_set_context(seg, NULL);
+	}
+
+	net_pkt_cursor_init(seg);
+	net_pkt_set_overwrite(seg, true);
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(seg) == AF_INET) {
+		NET_PKT_DATA_ACCESS_CONTIGUOUS_DEFINE(ipv4_access, struct net_ipv4_hdr);
+		struct net_ipv4_hdr *ipv4_hdr;
+
+		ipv4_hdr = (struct net_ipv4_hdr *)net_pkt_get_data(seg, &ipv4_access);
+		if (!ipv4_hdr) {
+			goto fail;
+		}
+
+		/* Each segment is a datagram of its own */
+		sys_put_be16(sys_get_be16(ipv4_hdr->id) + offset / net_pkt_gso_size(pkt),
+			     ipv4_hdr->id);
+		ipv4_hdr->chksum = 0U;
+	}
+
+	net_pkt_cursor_init(seg);
+
+	if (net_pkt_skip(seg, l3_len)) {
+		goto fail;
+	}
+
+	tcp_hdr = (struct net_tcp_hdr *)net_pkt_get_data(seg, &tcp_access);
+	if (!tcp_hdr) {
+		goto fail;
+	}
+
+	sys_put_be32(sys_get_be32(tcp_hdr->seq) + offset, tcp_hdr->seq);
+
+	if (!last) {
+		tcp_hdr->flags &= ~(PSH | FIN);
+	}
+
+	net_pkt_cursor_init(seg);
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(seg) == AF_INET) {
+		ret = net_ipv4_finalize(seg, IPPROTO_TCP);
+	} else {
+		ret = net_ipv6_finalize(seg, IPPROTO_TCP);
+	}
+
+	if (ret < 0) {
+		goto fail;
+	}
+
+	net_pkt_cursor_init(seg);
+	net_pkt_set_overwrite(seg, false);
+
+	return seg;
+
+fail:
+	net_pkt_unref(seg);
+
+	return NULL;
+}
+
+int net_tcp_gso_send(struct net_if *iface, struct net_pkt *pkt)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct net_tcp_hdr);
+	const struct net_l2 *l2 = net_if_l2(iface);
+	uint16_t mss = net_pkt_gso_size(pkt);
+	struct net_tcp_hdr *tcp_hdr;
+	size_t l3_len;
+	size_t hdr_len;
+	size_t total;
+	size_t offset;
+	int sent = 0;
+	int ret;
+
+	if (gso_hw_supported(iface)) {
+		return l2->send(iface, pkt);
+	}
+
+	l3_len = net_pkt_ip_hdr_len(pkt);
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
+		l3_len += net_pkt_ipv4_opts_len(pkt);
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(pkt) == AF_INET6) {
+		l3_len += net_pkt_ipv6_ext_len(pkt);
+	} else {
+		return -EINVAL;
+	}
+
+	net_pkt_set_overwrite(pkt, true);
+	net_pkt_cursor_init(pkt);
+
+	if (net_pkt_skip(pkt, l3_len)) {
+		return -EINVAL;
+	}
+
+	tcp_hdr = (struct net_tcp_hdr *)net_pkt_get_data(pkt, &tcp_access);
+	if (!tcp_hdr) {
+		return -ENOBUFS;
+	}
+
+	hdr_len = l3_len + (tcp_hdr->offset >> 4) * 4U;
+	total = net_pkt_get_len(pkt) - hdr_len;
+
+	for (offset = 0; offset < total; offset += mss) {
+		size_t len = MIN(mss, total - offset);
+		bool last = offset + len >= total;
+		struct net_pkt *seg;
+
+		seg = gso_segment(pkt, l3_len, hdr_len, offset, len, last);
+		if (!seg) {
+			NET_DBG("Cannot allocate segment at %zu of %p", offset, pkt);
+			return -ENOBUFS;
+		}
+
+		ret = l2->send(iface, seg);
+		if (ret < 0) {
+			net_pkt_unref(seg);
+			return ret;
+		}
+
+		sent += ret;
+	}
+
+	net_pkt_unref(pkt);
+
+	return sent;
+}
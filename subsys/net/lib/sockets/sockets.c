@@ -13,7 +13,9 @@ LOG_MODULE_REGISTER(net_sock, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <zephyr/kernel.h>
 #include <zephyr/tracing/tracing.h>
 #include <zephyr/net/socket.h>
+#include <zephyr/net_buf.h>
 #include <zephyr/internal/syscall_handler.h>
+#include <zephyr/sys/timeutil.h>
 
 #include "sockets_internal.h"
 
@@ -362,6 +364,11 @@ ssize_t z_vrfy_zsock_sendto(int sock, const void *buf, size_t len, int flags,
 					addrlen));
 	}
 
+	/* The stack must not keep referencing user memory once the call
+	 * returns, so data sent from user mode is always copied.
+	 */
+	flags &= ~ZSOCK_MSG_ZEROCOPY;
+
 	return z_impl_zsock_sendto(sock, (const void *)buf, len, flags,
 			dest_addr ? (struct sockaddr *)&dest_addr_copy : NULL,
 			addrlen);
@@ -386,90 +393,120 @@ ssize_t z_impl_zsock_sendmsg(int sock, const struct msghdr *msg, int flags)
 }
 
 #ifdef CONFIG_USERSPACE
-static inline ssize_t z_vrfy_zsock_sendmsg(int sock,
-					   const struct msghdr *msg,
-					   int flags)
+/* Frees the kernel copies of a message header copied from user mode,
+ * iovlen being the number of data buffers copied.
+ */
+static void msghdr_copy_free(struct msghdr *copy, size_t iovlen)
 {
-	struct msghdr msg_copy;
-	size_t i;
-	int ret;
+	k_free(copy->msg_name);
+	k_free(copy->msg_control);
 
-	K_OOPS(k_usermode_from_copy(&msg_copy, (void *)msg, sizeof(msg_copy)));
+	if (copy->msg_iov != NULL) {
+		for (size_t i = 0; i < iovlen; i++) {
+			k_free(copy->msg_iov[i].iov_base);
+		}
+
+		k_free(copy->msg_iov);
+	}
+}
 
-	msg_copy.msg_name = NULL;
-	msg_copy.msg_control = NULL;
+/* Replaces the pointers of a message header copied from user mode with
+ * pointers to kernel copies of what they point to. Frees everything and
+ * sets errno on failure.
+ */
+static int msghdr_copy_from_user(struct msghdr *copy)
+{
+	const struct iovec *iov = copy->msg_iov;
+	const void *name = copy->msg_name;
+	const void *control = copy->msg_control;
+	size_t iovlen = copy->msg_iovlen;
+	size_t i = 0;
+
+	copy->msg_name = NULL;
+	copy->msg_control = NULL;
+
+	if (iov == NULL) {
+		errno = ENOMEM;
+		return -1;
+	}
 
-	msg_copy.msg_iov = k_usermode_alloc_from_copy(msg->msg_iov,
-				       msg->msg_iovlen * sizeof(struct iovec));
-	if (!msg_copy.msg_iov) {
+	copy->msg_iov = k_usermode_alloc_from_copy(iov, iovlen * sizeof(struct iovec));
+	if (copy->msg_iov == NULL) {
 		errno = ENOMEM;
-		goto fail;
+		return -1;
 	}
 
-	for (i = 0; i < msg->msg_iovlen; i++) {
-		msg_copy.msg_iov[i].iov_base =
-			k_usermode_alloc_from_copy(msg->msg_iov[i].iov_base,
-					       msg->msg_iov[i].iov_len);
-		if (!msg_copy.msg_iov[i].iov_base) {
+	for (i = 0; i < iovlen; i++) {
+		/* TODO: In practice we do not need to copy the actual data
+		 * in msghdr when receiving data but currently there is no
+		 * ready made function to do just that (unless we want to call
+		 * relevant malloc function here ourselves). So just use
+		 * the copying variant for now.
+		 */
+		copy->msg_iov[i].iov_base =
+			k_usermode_alloc_from_copy(copy->msg_iov[i].iov_base,
+						   copy->msg_iov[i].iov_len);
+		if (copy->msg_iov[i].iov_base == NULL) {
 			errno = ENOMEM;
 			goto fail;
 		}
-
-		msg_copy.msg_iov[i].iov_len = msg->msg_iov[i].iov_len;
 	}
 
-	if (msg->msg_namelen > 0) {
-		msg_copy.msg_name = k_usermode_alloc_from_copy(msg->msg_name,
-							   msg->msg_namelen);
-		if (!msg_copy.msg_name) {
+	if (copy->msg_namelen > 0) {
+		if (name == NULL) {
+			errno = EINVAL;
+			goto fail;
+		}
+
+		copy->msg_name = k_usermode_alloc_from_copy(name, copy->msg_namelen);
+		if (copy->msg_name == NULL) {
 			errno = ENOMEM;
 			goto fail;
 		}
 	}
 
-	if (msg->msg_controllen > 0) {
-		msg_copy.msg_control = k_usermode_alloc_from_copy(msg->msg_control,
-							  msg->msg_controllen);
-		if (!msg_copy.msg_control) {
+	if (copy->msg_controllen > 0) {
+		if (control == NULL) {
+			errno = EINVAL;
+			goto fail;
+		}
+
+		copy->msg_control = k_usermode_alloc_from_copy(control,
+							       copy->msg_controllen);
+		if (copy->msg_control == NULL) {
 			errno = ENOMEM;
 			goto fail;
 		}
 	}
 
-	ret = z_impl_zsock_sendmsg(sock, (const struct msghdr *)&msg_copy,
-				   flags);
+	return 0;
 
-	k_free(msg_copy.msg_name);
-	k_free(msg_copy.msg_control);
-
-	for (i = 0; i < msg_copy.msg_iovlen; i++) {
-		k_free(msg_copy.msg_iov[i].iov_base);
-	}
+fail:
+	msghdr_copy_free(copy, i);
 
-	k_free(msg_copy.msg_iov);
+	return -1;
+}
 
-	return ret;
+static inline ssize_t z_vrfy_zsock_sendmsg(int sock,
+					   const struct msghdr *msg,
+					   int flags)
+{
+	struct msghdr msg_copy;
+	int ret;
 
-fail:
-	if (msg_copy.msg_name) {
-		k_free(msg_copy.msg_name);
-	}
+	K_OOPS(k_usermode_from_copy(&msg_copy, (void *)msg, sizeof(msg_copy)));
 
-	if (msg_copy.msg_control) {
-		k_free(msg_copy.msg_control);
+	if (msghdr_copy_from_user(&msg_copy) < 0) {
+		return -1;
 	}
 
-	if (msg_copy.msg_iov) {
-		for (i = 0; i < msg_copy.msg_iovlen; i++) {
-			if (msg_copy.msg_iov[i].iov_base) {
-				k_free(msg_copy.msg_iov[i].iov_base);
-			}
-		}
+	/* The data copies are freed once the call returns */
+	ret = z_impl_zsock_sendmsg(sock, (const struct msghdr *)&msg_copy,
+				   flags & ~ZSOCK_MSG_ZEROCOPY);
 
-		k_free(msg_copy.msg_iov);
-	}
+	msghdr_copy_free(&msg_copy, msg_copy.msg_iovlen);
 
-	return -1;
+	return ret;
 }
 #include <zephyr/syscalls/zsock_sendmsg_mrsh.c>
 #endif /* CONFIG_USERSPACE */
@@ -541,11 +578,61 @@ ssize_t z_impl_zsock_recvmsg(int sock, struct msghdr *msg, int flags)
 }
 
 #ifdef CONFIG_USERSPACE
+/* Copies what was received into the kernel copy of a message header back
+ * to user mode, iovlen being the number of data buffers.
+ */
+static void msghdr_copy_to_user(struct msghdr *msg, struct msghdr *copy,
+				size_t iovlen)
+{
+	size_t i;
+
+	if (msg->msg_namelen > 0 && msg->msg_name != NULL) {
+		K_OOPS(k_usermode_to_copy(msg->msg_name,
+					  copy->msg_name,
+					  copy->msg_namelen));
+	}
+
+	if (msg->msg_controllen > 0 &&
+	    msg->msg_control != NULL) {
+		K_OOPS(k_usermode_to_copy(msg->msg_control,
+					  copy->msg_control,
+					  copy->msg_controllen));
+
+		msg->msg_controllen = copy->msg_controllen;
+	} else {
+		msg->msg_controllen = 0U;
+	}
+
+	k_usermode_to_copy(&msg->msg_iovlen,
+			   &copy->msg_iovlen,
+			   sizeof(msg->msg_iovlen));
+
+	/* The new iovlen cannot be bigger than the original one */
+	NET_ASSERT(copy->msg_iovlen <= iovlen);
+
+	for (i = 0; i < iovlen; i++) {
+		if (i < copy->msg_iovlen) {
+			K_OOPS(k_usermode_to_copy(msg->msg_iov[i].iov_base,
+						  copy->msg_iov[i].iov_base,
+						  copy->msg_iov[i].iov_len));
+			K_OOPS(k_usermode_to_copy(&msg->msg_iov[i].iov_len,
+						  &copy->msg_iov[i].iov_len,
+						  sizeof(msg->msg_iov[i].iov_len)));
+		} else {
+			/* Clear out those vectors that we could not populate */
+			msg->msg_iov[i].iov_len = 0;
+		}
+	}
+
+	k_usermode_to_copy(&msg->msg_flags,
+			   &copy->msg_flags,
+			   sizeof(msg->msg_flags));
+}
+
 ssize_t z_vrfy_zsock_recvmsg(int sock, struct msghdr *msg, int flags)
 {
 	struct msghdr msg_copy;
 	size_t iovlen;
-	size_t i;
 	int ret;
 
 	if (msg == NULL) {
@@ -553,163 +640,289 @@ ssize_t z_vrfy_zsock_recvmsg(int sock, struct msghdr *msg, int flags)
 		return -1;
 	}
 
-	if (msg->msg_iov == NULL) {
-		errno = ENOMEM;
+	K_OOPS(k_usermode_from_copy(&msg_copy, (void *)msg, sizeof(msg_copy)));
+
+	iovlen = msg_copy.msg_iovlen;
+	if (msghdr_copy_from_user(&msg_copy) < 0) {
 		return -1;
 	}
 
-	K_OOPS(k_usermode_from_copy(&msg_copy, (void *)msg, sizeof(msg_copy)));
+	ret = z_impl_zsock_recvmsg(sock, &msg_copy, flags);
+
+	/* Do not copy anything back if there was an error or nothing was
+	 * received, error queue messages being only ancillary data.
+	 */
+	if (ret > 0 || (ret == 0 && (flags & ZSOCK_MSG_ERRQUEUE))) {
+		msghdr_copy_to_user(msg, &msg_copy, iovlen);
+	}
 
-	k_usermode_from_copy(&iovlen, &msg->msg_iovlen, sizeof(iovlen));
+	/* Note that we need to free according to original iovlen */
+	msghdr_copy_free(&msg_copy, iovlen);
 
-	msg_copy.msg_name = NULL;
-	msg_copy.msg_control = NULL;
+	return ret;
+}
+#include <zephyr/syscalls/zsock_recvmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
 
-	msg_copy.msg_iov = k_usermode_alloc_from_copy(msg->msg_iov,
-				       msg->msg_iovlen * sizeof(struct iovec));
-	if (!msg_copy.msg_iov) {
-		errno = ENOMEM;
-		goto fail;
+static int sock_sendmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			 int flags)
+{
+	const struct socket_op_vtable *vtable;
+	struct k_mutex *lock;
+	unsigned int sent;
+	ssize_t ret = 0;
+	void *obj;
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
 	}
 
-	/* Clear the pointers in the copy so that if the allocation in the
-	 * next loop fails, we do not try to free non allocated memory
-	 * in fail branch.
-	 */
-	memset(msg_copy.msg_iov, 0, msg->msg_iovlen * sizeof(struct iovec));
+	if (vtable->sendmsg == NULL) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
 
-	for (i = 0; i < iovlen; i++) {
-		/* TODO: In practice we do not need to copy the actual data
-		 * in msghdr when receiving data but currently there is no
-		 * ready made function to do just that (unless we want to call
-		 * relevant malloc function here ourselves). So just use
-		 * the copying variant for now.
-		 */
-		msg_copy.msg_iov[i].iov_base =
-			k_usermode_alloc_from_copy(msg->msg_iov[i].iov_base,
-						   msg->msg_iov[i].iov_len);
-		if (!msg_copy.msg_iov[i].iov_base) {
-			errno = ENOMEM;
-			goto fail;
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	for (sent = 0U; sent < vlen; sent++) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(socket, sendmsg, sock,
+						&msgvec[sent].msg_hdr, flags);
+
+		ret = vtable->sendmsg(obj, &msgvec[sent].msg_hdr, flags);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(socket, sendmsg, sock,
+					       ret < 0 ? -errno : ret);
+
+		if (ret < 0) {
+			break;
 		}
 
-		msg_copy.msg_iov[i].iov_len = msg->msg_iov[i].iov_len;
+		sock_obj_core_update_send_stats(sock, ret);
+		msgvec[sent].msg_len = ret;
 	}
 
-	if (msg->msg_namelen > 0) {
-		if (msg->msg_name == NULL) {
-			errno = EINVAL;
-			goto fail;
-		}
+	k_mutex_unlock(lock);
 
-		msg_copy.msg_name = k_usermode_alloc_from_copy(msg->msg_name,
-							   msg->msg_namelen);
-		if (msg_copy.msg_name == NULL) {
-			errno = ENOMEM;
-			goto fail;
-		}
+	/* Errors are only reported if nothing was sent */
+	return (sent > 0U) ? (int)sent : (int)ret;
+}
+
+int z_impl_zsock_sendmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags)
+{
+	return sock_sendmmsg(sock, msgvec, vlen, flags);
+}
+
+static int sock_recvmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			 int flags, k_timepoint_t end)
+{
+	const struct socket_op_vtable *vtable;
+	struct k_mutex *lock;
+	unsigned int received;
+	ssize_t ret = 0;
+	void *obj;
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
 	}
 
-	if (msg->msg_controllen > 0) {
-		if (msg->msg_control == NULL) {
-			errno = EINVAL;
-			goto fail;
+	if (vtable->recvmsg == NULL) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	for (received = 0U; received < vlen; received++) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(socket, recvmsg, sock,
+						&msgvec[received].msg_hdr, flags);
+
+		ret = vtable->recvmsg(obj, &msgvec[received].msg_hdr,
+				      flags & ~ZSOCK_MSG_WAITFORONE);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(socket, recvmsg, sock,
+					       &msgvec[received].msg_hdr,
+					       ret < 0 ? -errno : ret);
+
+		if (ret < 0) {
+			break;
 		}
 
-		msg_copy.msg_control =
-			k_usermode_alloc_from_copy(msg->msg_control,
-						   msg->msg_controllen);
-		if (msg_copy.msg_control == NULL) {
-			errno = ENOMEM;
-			goto fail;
+		sock_obj_core_update_recv_stats(sock, ret);
+		msgvec[received].msg_len = ret;
+
+		if (flags & ZSOCK_MSG_WAITFORONE) {
+			flags |= ZSOCK_MSG_DONTWAIT;
+		}
+
+		if (sys_timepoint_expired(end)) {
+			received++;
+			break;
 		}
 	}
 
-	ret = z_impl_zsock_recvmsg(sock, &msg_copy, flags);
+	k_mutex_unlock(lock);
 
-	/* Do not copy anything back if there was an error or nothing was
-	 * received.
-	 */
-	if (ret > 0) {
-		if (msg->msg_namelen > 0 && msg->msg_name != NULL) {
-			K_OOPS(k_usermode_to_copy(msg->msg_name,
-						  msg_copy.msg_name,
-						  msg_copy.msg_namelen));
-		}
+	/* Errors are only reported if nothing was received */
+	return (received > 0U) ? (int)received : (int)ret;
+}
 
-		if (msg->msg_controllen > 0 &&
-		    msg->msg_control != NULL) {
-			K_OOPS(k_usermode_to_copy(msg->msg_control,
-						  msg_copy.msg_control,
-						  msg_copy.msg_controllen));
+static k_timepoint_t recvmmsg_end(const struct timespec *timeout)
+{
+	return sys_timepoint_calc((timeout != NULL) ? timespec_to_timeout(timeout) :
+						      K_FOREVER);
+}
 
-			msg->msg_controllen = msg_copy.msg_controllen;
-		} else {
-			msg->msg_controllen = 0U;
+int z_impl_zsock_recvmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags, struct timespec *timeout)
+{
+	if ((timeout != NULL) && !timespec_is_valid(timeout)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	return sock_recvmmsg(sock, msgvec, vlen, flags, recvmmsg_end(timeout));
+}
+
+#ifdef CONFIG_USERSPACE
+/* Messages copied from user mode at once */
+#define MMSG_USER_BATCH 4
+
+int z_vrfy_zsock_sendmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags)
+{
+	struct mmsghdr copy[MMSG_USER_BATCH];
+	unsigned int sent = 0U;
+	unsigned int count;
+	unsigned int i;
+	int ret = 0;
+
+	while (sent < vlen) {
+		count = MIN(vlen - sent, MMSG_USER_BATCH);
+		K_OOPS(k_usermode_from_copy(copy, &msgvec[sent],
+					    count * sizeof(copy[0])));
+
+		for (i = 0U; i < count; i++) {
+			if (msghdr_copy_from_user(&copy[i].msg_hdr) < 0) {
+				break;
+			}
 		}
 
-		k_usermode_to_copy(&msg->msg_iovlen,
-				   &msg_copy.msg_iovlen,
-				   sizeof(msg->msg_iovlen));
-
-		/* The new iovlen cannot be bigger than the original one */
-		NET_ASSERT(msg_copy.msg_iovlen <= iovlen);
-
-		for (i = 0; i < iovlen; i++) {
-			if (i < msg_copy.msg_iovlen) {
-				K_OOPS(k_usermode_to_copy(msg->msg_iov[i].iov_base,
-							  msg_copy.msg_iov[i].iov_base,
-							  msg_copy.msg_iov[i].iov_len));
-				K_OOPS(k_usermode_to_copy(&msg->msg_iov[i].iov_len,
-							  &msg_copy.msg_iov[i].iov_len,
-							  sizeof(msg->msg_iov[i].iov_len)));
-			} else {
-				/* Clear out those vectors that we could not populate */
-				msg->msg_iov[i].iov_len = 0;
+		ret = (i > 0U) ? sock_sendmmsg(sock, copy, i, flags & ~ZSOCK_MSG_ZEROCOPY) : -1;
+
+		for (unsigned int j = 0U; j < i; j++) {
+			if ((ret > 0) && (j < (unsigned int)ret)) {
+				K_OOPS(k_usermode_to_copy(&msgvec[sent + j].msg_len,
+							  &copy[j].msg_len,
+							  sizeof(copy[j].msg_len)));
 			}
+			msghdr_copy_free(&copy[j].msg_hdr, copy[j].msg_hdr.msg_iovlen);
 		}
 
-		k_usermode_to_copy(&msg->msg_flags,
-				   &msg_copy.msg_flags,
-				   sizeof(msg->msg_flags));
+		if (ret <= 0) {
+			break;
+		}
+
+		sent += ret;
+		if ((unsigned int)ret < count) {
+			break;
+		}
 	}
 
-	k_free(msg_copy.msg_name);
-	k_free(msg_copy.msg_control);
+	return (sent > 0U) ? (int)sent : ret;
+}
+#include <zephyr/syscalls/zsock_sendmmsg_mrsh.c>
 
-	/* Note that we need to free according to original iovlen */
-	for (i = 0; i < iovlen; i++) {
-		k_free(msg_copy.msg_iov[i].iov_base);
+int z_vrfy_zsock_recvmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags, struct timespec *timeout)
+{
+	struct mmsghdr copy[MMSG_USER_BATCH];
+	size_t iovlen[MMSG_USER_BATCH];
+	unsigned int received = 0U;
+	struct timespec timeout_copy;
+	k_timepoint_t end;
+	unsigned int count;
+	unsigned int i;
+	int ret = 0;
+
+	if (timeout != NULL) {
+		K_OOPS(k_usermode_from_copy(&timeout_copy, timeout,
+					    sizeof(timeout_copy)));
+		if (!timespec_is_valid(&timeout_copy)) {
+			errno = EINVAL;
+			return -1;
+		}
 	}
+	end = recvmmsg_end((timeout != NULL) ? &timeout_copy : NULL);
 
-	k_free(msg_copy.msg_iov);
+	while (received < vlen) {
+		count = MIN(vlen - received, MMSG_USER_BATCH);
+		K_OOPS(k_usermode_from_copy(copy, &msgvec[received],
+					    count * sizeof(copy[0])));
 
-	return ret;
-
-fail:
-	if (msg_copy.msg_name) {
-		k_free(msg_copy.msg_name);
-	}
+		for (i = 0U; i < count; i++) {
+			iovlen[i] = copy[i].msg_hdr.msg_iovlen;
+			if (msghdr_copy_from_user(&copy[i].msg_hdr) < 0) {
+				break;
+			}
+		}
 
-	if (msg_copy.msg_control) {
-		k_free(msg_copy.msg_control);
-	}
+		ret = (i > 0U) ? sock_recvmmsg(sock, copy, i, flags, end) : -1;
 
-	if (msg_copy.msg_iov) {
-		for (i = 0; i < msg_copy.msg_iovlen; i++) {
-			if (msg_copy.msg_iov[i].iov_base) {
-				k_free(msg_copy.msg_iov[i].iov_base);
+		for (unsigned int j = 0U; j < i; j++) {
+			if ((ret > 0) && (j < (unsigned int)ret)) {
+				msghdr_copy_to_user(&msgvec[received + j].msg_hdr,
+						    &copy[j].msg_hdr, iovlen[j]);
+				K_OOPS(k_usermode_to_copy(&msgvec[received + j].msg_len,
+							  &copy[j].msg_len,
+							  sizeof(copy[j].msg_len)));
 			}
+			msghdr_copy_free(&copy[j].msg_hdr, iovlen[j]);
 		}
 
-		k_free(msg_copy.msg_iov);
+		if (ret <= 0) {
+			break;
+		}
+
+		received += ret;
+		if (((unsigned int)ret < count) || sys_timepoint_expired(end)) {
+			break;
+		}
+
+		/* Only the first message may be waited for */
+		if (flags & ZSOCK_MSG_WAITFORONE) {
+			flags |= ZSOCK_MSG_DONTWAIT;
+		}
 	}
 
-	return -1;
+	return (received > 0U) ? (int)received : ret;
 }
-#include <zephyr/syscalls/zsock_recvmsg_mrsh.c>
+#include <zephyr/syscalls/zsock_recvmmsg_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+ssize_t zsock_recvbuf(int sock, struct net_buf **buf, int flags,
+		      struct sockaddr *src_addr, socklen_t *addrlen)
+{
+	int bytes_received;
+
+	bytes_received = VTABLE_CALL(recvbuf, sock, buf, flags, src_addr, addrlen);
+
+	sock_obj_core_update_recv_stats(sock, bytes_received);
+
+	return bytes_received;
+}
+
+void zsock_recvbuf_release(struct net_buf *buf)
+{
+	if (buf != NULL) {
+		net_buf_unref(buf);
+	}
+}
+
 /* As this is limited function, we don't follow POSIX signature, with
  * "..." instead of last arg.
  */
@@ -626,6 +626,17 @@ ssize_t zsock_sendto_ctx(struct net_context *ctx, const void *buf, size_t len,
 	k_timeout_t timeout = K_FOREVER;
 	uint32_t retry_timeout = WAIT_BUFS_INITIAL_MS;
 	k_timepoint_t buf_timeout, end;
+	/* Only net_context_sendmsg() takes the zero-copy flag */
+	struct iovec iov = {
+		.iov_base = (void *)buf,
+		.iov_len = len,
+	};
+	struct msghdr msg = {
+		.msg_name = (void *)dest_addr,
+		.msg_namelen = addrlen,
+		.msg_iov = &iov,
+		.msg_iovlen = 1,
+	};
 	int status;
 
 	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
@@ -648,7 +659,10 @@ ssize_t zsock_sendto_ctx(struct net_context *ctx, const void *buf, size_t len,
 	}
 
 	while (1) {
-		if (dest_addr) {
+		if (flags & ZSOCK_MSG_ZEROCOPY) {
+			status = net_context_sendmsg(ctx, &msg, flags, NULL,
+						     timeout, ctx->user_data);
+		} else if (dest_addr) {
 			status = net_context_sendto(ctx, buf, len, dest_addr,
 						    addrlen, NULL, timeout,
 						    ctx->user_data);
@@ -1496,6 +1510,47 @@ ssize_t zsock_recvfrom_ctx(struct net_context *ctx, void *buf, size_t max_len,
 	return -1;
 }
 
+/* Report the zero-copy sends completed since the last call */
+static ssize_t zsock_recv_errqueue(struct net_context *ctx, struct msghdr *msg)
+{
+	struct sock_extended_err ee = {
+		.ee_origin = SO_EE_ORIGIN_ZEROCOPY,
+	};
+	struct cmsghdr *cmsg;
+
+	if (net_context_zerocopy_get(ctx, &ee.ee_info, &ee.ee_data) < 0) {
+		errno = EAGAIN;
+		return -1;
+	}
+
+	msg->msg_flags |= ZSOCK_MSG_ERRQUEUE;
+
+	if (msg->msg_control == NULL ||
+	    msg->msg_controllen < CMSG_SPACE(sizeof(ee))) {
+		msg->msg_flags |= ZSOCK_MSG_CTRUNC;
+		msg->msg_controllen = 0U;
+
+		return 0;
+	}
+
+	cmsg = CMSG_FIRSTHDR(msg);
+	cmsg->cmsg_len = CMSG_LEN(sizeof(ee));
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) &&
+	    net_context_get_family(ctx) == AF_INET6) {
+		cmsg->cmsg_level = IPPROTO_IPV6;
+		cmsg->cmsg_type = IPV6_RECVERR;
+	} else {
+		cmsg->cmsg_level = IPPROTO_IP;
+		cmsg->cmsg_type = IP_RECVERR;
+	}
+
+	memcpy(CMSG_DATA(cmsg), &ee, sizeof(ee));
+	msg->msg_controllen = CMSG_SPACE(sizeof(ee));
+
+	return 0;
+}
+
 ssize_t zsock_recvmsg_ctx(struct net_context *ctx, struct msghdr *msg,
 			  int flags)
 {
@@ -1507,6 +1562,10 @@ ssize_t zsock_recvmsg_ctx(struct net_context *ctx, struct msghdr *msg,
 		return -1;
 	}
 
+	if (flags & ZSOCK_MSG_ERRQUEUE) {
+		return zsock_recv_errqueue(ctx, msg);
+	}
+
 	if (msg->msg_iov == NULL) {
 		errno = ENOMEM;
 		return -1;
@@ -1530,11 +1589,153 @@ ssize_t zsock_recvmsg_ctx(struct net_context *ctx, struct msghdr *msg,
 	return -1;
 }
 
+/* Takes the buffers holding the data left to read from a packet, which
+ * follow the headers skipped with the cursor, and frees the packet.
+ */
+static struct net_buf *pkt_take_data(struct net_pkt *pkt)
+{
+	struct net_buf *frags = pkt->buffer;
+
+	while (frags != NULL && frags != pkt->cursor.buf) {
+		frags = net_buf_frag_del(NULL, frags);
+	}
+
+	if (frags != NULL) {
+		net_buf_pull(frags, pkt->cursor.pos - frags->data);
+	}
+
+	while (frags != NULL && frags->len == 0U) {
+		frags = net_buf_frag_del(NULL, frags);
+	}
+
+	pkt->buffer = NULL;
+	net_pkt_cursor_init(pkt);
+	net_pkt_unref(pkt);
+
+	return frags;
+}
+
+static ssize_t zsock_recvbuf_ctx(struct net_context *ctx, struct net_buf **buf,
+				 int flags, struct sockaddr *src_addr,
+				 socklen_t *addrlen)
+{
+	enum net_sock_type sock_type = net_context_get_type(ctx);
+	k_timeout_t timeout = K_FOREVER;
+	struct net_pkt *pkt;
+	size_t recv_len;
+	int ret;
+
+	if (buf == NULL || (flags & ZSOCK_MSG_PEEK)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	*buf = NULL;
+
+	if (sock_type == SOCK_STREAM) {
+		if (net_context_get_state(ctx) != NET_CONTEXT_CONNECTED) {
+			errno = ENOTCONN;
+			return -1;
+		}
+
+		if (sock_is_error(ctx)) {
+			errno = POINTER_TO_INT(ctx->user_data);
+			return -1;
+		}
+
+		if (sock_is_eof(ctx)) {
+			return 0;
+		}
+	}
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+	} else {
+		net_context_get_option(ctx, NET_OPT_RCVTIMEO, &timeout, NULL);
+
+		ret = zsock_wait_data(ctx, &timeout);
+		if (ret < 0) {
+			errno = -ret;
+			return -1;
+		}
+	}
+
+	pkt = k_fifo_get(&ctx->recv_q, K_NO_WAIT);
+	if (pkt == NULL) {
+		if (sock_type == SOCK_STREAM && sock_is_eof(ctx)) {
+			return 0;
+		}
+
+		errno = EAGAIN;
+		return -1;
+	}
+
+	if (sock_type != SOCK_STREAM && src_addr != NULL && addrlen != NULL) {
+		if (IS_ENABLED(CONFIG_NET_OFFLOAD) &&
+		    net_if_is_ip_offloaded(net_context_get_iface(ctx))) {
+			ret = sock_get_offload_pkt_src_addr(pkt, ctx, src_addr,
+							    *addrlen);
+		} else {
+			ret = sock_get_pkt_src_addr(ctx, pkt, src_addr, *addrlen);
+		}
+
+		if (ret < 0) {
+			net_pkt_unref(pkt);
+			errno = -ret;
+			return -1;
+		}
+
+		*addrlen = src_addr->sa_family == AF_INET6 ?
+			   sizeof(struct sockaddr_in6) : sizeof(struct sockaddr_in);
+	}
+
+	if (sock_type == SOCK_STREAM && net_pkt_eof(pkt)) {
+		sock_set_eof(ctx);
+	}
+
+	if (IS_ENABLED(CONFIG_NET_PKT_RXTIME_STATS) ||
+	    IS_ENABLED(CONFIG_TRACING_NET_CORE)) {
+		net_socket_update_tc_rx_time(pkt, k_cycle_get_32());
+	}
+
+	recv_len = net_pkt_remaining_data(pkt);
+	*buf = pkt_take_data(pkt);
+
+	if (sock_type == SOCK_STREAM) {
+		net_context_update_recv_wnd(ctx, recv_len);
+	}
+
+	return recv_len;
+}
+
 static int zsock_poll_prepare_ctx(struct net_context *ctx,
 				  struct zsock_pollfd *pfd,
 				  struct k_poll_event **pev,
 				  struct k_poll_event *pev_end)
 {
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+	/* Zero-copy send completions are reported with POLLERR. The event
+	 * comes first so that the others may be skipped.
+	 */
+	if (net_context_is_zerocopy_set(ctx)) {
+		if (*pev == pev_end) {
+			return -ENOMEM;
+		}
+
+		/* Reset before checking, not to miss a completion in between */
+		k_poll_signal_reset(&ctx->zerocopy.signal);
+		if (net_context_zerocopy_pending(ctx)) {
+			k_poll_signal_raise(&ctx->zerocopy.signal, 0);
+		}
+
+		(*pev)->obj = &ctx->zerocopy.signal;
+		(*pev)->type = K_POLL_TYPE_SIGNAL;
+		(*pev)->mode = K_POLL_MODE_NOTIFY_ONLY;
+		(*pev)->state = K_POLL_STATE_NOT_READY;
+		(*pev)++;
+	}
+#endif
+
 	if (pfd->events & ZSOCK_POLLIN) {
 		if (*pev == pev_end) {
 			return -ENOMEM;
@@ -1587,6 +1788,12 @@ static int zsock_poll_update_ctx(struct net_context *ctx,
 {
 	ARG_UNUSED(ctx);
 
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+	if (net_context_is_zerocopy_set(ctx)) {
+		(*pev)++;
+	}
+#endif
+
 	if (pfd->events & ZSOCK_POLLIN) {
 		if (((*pev)->state != K_POLL_STATE_NOT_READY &&
 		     (*pev)->state != K_POLL_STATE_CANCELLED) ||
@@ -1610,7 +1817,7 @@ static int zsock_poll_update_ctx(struct net_context *ctx,
 		}
 	}
 
-	if (sock_is_error(ctx)) {
+	if (sock_is_error(ctx) || net_context_zerocopy_pending(ctx)) {
 		pfd->revents |= ZSOCK_POLLERR;
 	}
 
@@ -1886,6 +2093,21 @@ int zsock_getsockopt_ctx(struct net_context *ctx, int level, int optname,
 				return 0;
 			}
 
+			break;
+
+		case SO_ZEROCOPY:
+			if (IS_ENABLED(CONFIG_NET_CONTEXT_ZEROCOPY)) {
+				ret = net_context_get_option(ctx,
+							     NET_OPT_ZEROCOPY,
+							     optval, optlen);
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
 			break;
 		}
 
@@ -2514,6 +2736,21 @@ int zsock_setsockopt_ctx(struct net_context *ctx, int level, int optname,
 				return 0;
 			}
 
+			break;
+
+		case SO_ZEROCOPY:
+			if (IS_ENABLED(CONFIG_NET_CONTEXT_ZEROCOPY)) {
+				ret = net_context_set_option(ctx,
+							     NET_OPT_ZEROCOPY,
+							     optval, optlen);
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
 			break;
 		}
 
@@ -3057,6 +3294,12 @@ static ssize_t sock_recvfrom_vmeth(void *obj, void *buf, size_t max_len,
 				  src_addr, addrlen);
 }
 
+static ssize_t sock_recvbuf_vmeth(void *obj, struct net_buf **buf, int flags,
+				  struct sockaddr *src_addr, socklen_t *addrlen)
+{
+	return zsock_recvbuf_ctx(obj, buf, flags, src_addr, addrlen);
+}
+
 static int sock_getsockopt_vmeth(void *obj, int level, int optname,
 				 void *optval, socklen_t *optlen)
 {
@@ -3105,6 +3348,7 @@ const struct socket_op_vtable sock_fd_op_vtable = {
 	.setsockopt = sock_setsockopt_vmeth,
 	.getpeername = sock_getpeername_vmeth,
 	.getsockname = sock_getsockname_vmeth,
+	.recvbuf = sock_recvbuf_vmeth,
 };
 
 static bool inet_is_supported(int family, int type, int proto)
@@ -11,6 +11,7 @@ LOG_MODULE_REGISTER(net_sock_svc, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <zephyr/init.h>
 #include <zephyr/net/socket_service.h>
 #include <zephyr/zvfs/eventfd.h>
+#include <zephyr/zvfs/epoll.h>
 
 static int init_socket_service(void);
 
@@ -28,9 +29,22 @@ static K_CONDVAR_DEFINE(wait_start);
 STRUCT_SECTION_START_EXTERN(net_socket_service_desc);
 STRUCT_SECTION_END_EXTERN(net_socket_service_desc);
 
+#ifdef CONFIG_NET_SOCKETS_SERVICE_EPOLL
+#define SERVICE_MAX_FDS CONFIG_ZVFS_EPOLL_MAX_FDS
+#define SERVICE_MAX_FDS_OPTION "CONFIG_ZVFS_EPOLL_MAX_FDS"
+#define SERVICE_EPOLL_EVENTS 8
+#else
+#define SERVICE_MAX_FDS CONFIG_ZVFS_POLL_MAX
+#define SERVICE_MAX_FDS_OPTION "CONFIG_ZVFS_POLL_MAX"
+#endif /* CONFIG_NET_SOCKETS_SERVICE_EPOLL */
+
 static struct service_context {
-	struct zsock_pollfd events[CONFIG_ZVFS_POLL_MAX];
+	struct zsock_pollfd events[SERVICE_MAX_FDS];
 	int count;
+#ifdef CONFIG_NET_SOCKETS_SERVICE_EPOLL
+	int epfd;
+	struct zvfs_epoll_event ready[SERVICE_EPOLL_EVENTS];
+#endif /* CONFIG_NET_SOCKETS_SERVICE_EPOLL */
 } ctx;
 
 #define get_idx(svc) (*(svc->idx))
@@ -165,6 +179,42 @@ static int trigger_work(struct zsock_pollfd *pev)
 	return call_work(pev, event);
 }
 
+#ifdef CONFIG_NET_SOCKETS_SERVICE_EPOLL
+static void service_epoll_del(int first, int last)
+{
+	for (int i = first; i < last; i++) {
+		if (ctx.events[i].fd < 0) {
+			continue;
+		}
+
+		/* The socket may have been closed and dropped already */
+		(void)zvfs_epoll_ctl(ctx.epfd, ZVFS_EPOLL_CTL_DEL, ctx.events[i].fd, NULL);
+	}
+}
+
+/* The epoll data of an entry is its index in ctx.events */
+static int service_epoll_add(int first, int last)
+{
+	struct zvfs_epoll_event ev;
+
+	for (int i = first; i < last; i++) {
+		if (ctx.events[i].fd < 0) {
+			continue;
+		}
+
+		ev.events = ctx.events[i].events;
+		ev.data.u32 = i;
+
+		if (zvfs_epoll_ctl(ctx.epfd, ZVFS_EPOLL_CTL_ADD, ctx.events[i].fd, &ev) < 0) {
+			NET_ERR("Cannot monitor socket %d (%d)", ctx.events[i].fd, -errno);
+			return -errno;
+		}
+	}
+
+	return 0;
+}
+#endif /* CONFIG_NET_SOCKETS_SERVICE_EPOLL */
+
 static void socket_service_thread(void)
 {
 	int ret, i, fd, count = 0;
@@ -191,7 +241,7 @@ static void socket_service_thread(void)
 			"%zd poll entries configured.",
 			count + 1, ARRAY_SIZE(ctx.events));
 		NET_ERR("Please increase value of %s to at least %d",
-			"CONFIG_ZVFS_POLL_MAX", count + 1);
+			SERVICE_MAX_FDS_OPTION, count + 1);
 		goto fail;
 	}
 
@@ -207,17 +257,44 @@ static void socket_service_thread(void)
 		goto out;
 	}
 
+#ifdef CONFIG_NET_SOCKETS_SERVICE_EPOLL
+	ctx.epfd = zvfs_epoll_create1(0);
+	if (ctx.epfd < 0) {
+		ret = -errno;
+		NET_ERR("zvfs_epoll_create1 failed (%d)", ret);
+		goto out;
+	}
+
+	for (i = 1; i < (count + 1); i++) {
+		ctx.events[i].fd = -1;
+	}
+#endif /* CONFIG_NET_SOCKETS_SERVICE_EPOLL */
+
 	thread_status = SOCKET_SERVICE_THREAD_RUNNING;
 	k_condvar_broadcast(&wait_start);
 
 	ctx.events[0].fd = fd;
 	ctx.events[0].events = ZSOCK_POLLIN;
 
+#ifdef CONFIG_NET_SOCKETS_SERVICE_EPOLL
+	ret = service_epoll_add(0, 1);
+	if (ret < 0) {
+		goto out;
+	}
+#endif /* CONFIG_NET_SOCKETS_SERVICE_EPOLL */
+
 restart:
 	i = 1;
 
 	k_mutex_lock(&lock, K_FOREVER);
 
+#ifdef CONFIG_NET_SOCKETS_SERVICE_EPOLL
+	/* Sockets may have been closed and their numbers reused, so start
+	 * over from an empty interest list.
+	 */
+	service_epoll_del(1, count + 1);
+#endif /* CONFIG_NET_SOCKETS_SERVICE_EPOLL */
+
 	/* Copy individual events to the big array */
 	STRUCT_SECTION_FOREACH(net_socket_service_desc, svc) {
 		for (int j = 0; j < svc->pev_len; j++) {
@@ -225,8 +302,52 @@ restart:
 		}
 	}
 
+#ifdef CONFIG_NET_SOCKETS_SERVICE_EPOLL
+	ret = service_epoll_add(1, count + 1);
+#endif /* CONFIG_NET_SOCKETS_SERVICE_EPOLL */
+
 	k_mutex_unlock(&lock);
 
+#ifdef CONFIG_NET_SOCKETS_SERVICE_EPOLL
+	if (ret < 0) {
+		goto out;
+	}
+
+	while (true) {
+		bool reload = false;
+
+		ret = zvfs_epoll_wait(ctx.epfd, ctx.ready, ARRAY_SIZE(ctx.ready), K_FOREVER);
+		if (ret < 0) {
+			ret = -errno;
+			NET_ERR("epoll wait failed (%d)", ret);
+			goto out;
+		}
+
+		/* Process work here, only entries with activity are returned */
+		for (int j = 0, n = ret; j < n; j++) {
+			i = ctx.ready[j].data.u32;
+			ctx.events[i].revents = ctx.ready[j].events;
+
+			if (i == 0) {
+				reload = true;
+				continue;
+			}
+
+			ret = trigger_work(&ctx.events[i]);
+			if (ret < 0) {
+				NET_DBG("Triggering work failed (%d)", ret);
+				goto restart;
+			}
+		}
+
+		if (reload) {
+			zvfs_eventfd_read(ctx.events[0].fd, &value);
+			ctx.events[0].revents = 0;
+			NET_DBG("Received restart event.");
+			goto restart;
+		}
+	}
+#else
 	while (true) {
 		ret = zsock_poll(ctx.events, count + 1, -1);
 		if (ret < 0) {
@@ -263,6 +384,7 @@ restart:
 			goto restart;
 		}
 	}
+#endif /* CONFIG_NET_SOCKETS_SERVICE_EPOLL */
 
 out:
 	NET_DBG("Socket service thread stopped");
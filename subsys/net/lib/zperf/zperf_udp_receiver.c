@@ -36,6 +36,7 @@ static struct sockaddr_in *in4_addr_my;
 #define SOCK_ID_MAX 2
 
 #define UDP_RECEIVER_BUF_SIZE 1500
+#define UDP_RECEIVER_BATCH CONFIG_NET_ZPERF_UDP_RECV_BATCH
 #define POLL_TIMEOUT_MS 100
 
 static zperf_callback udp_session_cb;
@@ -312,14 +313,51 @@ static void udp_receiver_cleanup(void)
 	zperf_session_reset(SESSION_UDP);
 }
 
+/* Returns the number of bytes or datagrams received, or -1 */
+static int udp_recv(int sock)
+{
+	static uint8_t buf[UDP_RECEIVER_BATCH][UDP_RECEIVER_BUF_SIZE];
+#if UDP_RECEIVER_BATCH > 1
+	static struct sockaddr addr[UDP_RECEIVER_BATCH];
+	static struct iovec iov[UDP_RECEIVER_BATCH];
+	static struct mmsghdr msg[UDP_RECEIVER_BATCH];
+	int ret;
+
+	for (int i = 0; i < UDP_RECEIVER_BATCH; i++) {
+		iov[i].iov_base = buf[i];
+		iov[i].iov_len = sizeof(buf[i]);
+		msg[i].msg_hdr = (struct msghdr) {
+			.msg_name = &addr[i],
+			.msg_namelen = sizeof(addr[i]),
+			.msg_iov = &iov[i],
+			.msg_iovlen = 1,
+		};
+	}
+
+	ret = zsock_recvmmsg(sock, msg, UDP_RECEIVER_BATCH, ZSOCK_MSG_DONTWAIT, NULL);
+	for (int i = 0; i < ret; i++) {
+		udp_received(sock, &addr[i], buf[i], msg[i].msg_len);
+	}
+#else
+	struct sockaddr addr;
+	socklen_t addrlen = sizeof(addr);
+	int ret;
+
+	ret = zsock_recvfrom(sock, buf[0], sizeof(buf[0]), ZSOCK_MSG_DONTWAIT,
+			     &addr, &addrlen);
+	if (ret >= 0) {
+		udp_received(sock, &addr, buf[0], ret);
+	}
+#endif
+
+	return ret;
+}
+
 static int udp_recv_data(struct net_socket_service_event *pev)
 {
-	static uint8_t buf[UDP_RECEIVER_BUF_SIZE];
 	int ret = 1;
 	int family, sock_error;
-	struct sockaddr addr;
 	socklen_t optlen = sizeof(int);
-	socklen_t addrlen = sizeof(addr);
 
 	if (!udp_server_running) {
 		return -ENOENT;
@@ -342,8 +380,7 @@ static int udp_recv_data(struct net_socket_service_event *pev)
 	}
 
 	while (ret > 0) {
-		ret = zsock_recvfrom(pev->event.fd, buf, sizeof(buf), ZSOCK_MSG_DONTWAIT,
-				     &addr, &addrlen);
+		ret = udp_recv(pev->event.fd);
 		if ((ret < 0) && (errno == EAGAIN)) {
 			ret = 0;
 			break;
@@ -357,8 +394,6 @@ static int udp_recv_data(struct net_socket_service_event *pev)
 				family == AF_INET ? 4 : 6, -ret);
 			goto error;
 		}
-
-		udp_received(pev->event.fd, &addr, buf, ret);
 	}
 	return ret;
 
@@ -10,17 +10,143 @@
 
 #include <zephyr/sys/sys_heap.h>
 
-extern struct sys_heap _system_heap;
+extern struct k_heap _system_heap;
+
+#ifdef CONFIG_SYS_HEAP_ANALYSIS
+static void print_histogram(const struct shell *sh, const char *name,
+			    const uint32_t hist[][CONFIG_SYS_HEAP_ANALYSIS_LATENCY_BINS])
+{
+	shell_print(sh, "%s latencies (count per size class and log2 cycles):", name);
+	for (int cls = 0; cls < CONFIG_SYS_HEAP_ANALYSIS_SIZE_CLASSES; cls++) {
+		bool empty = true;
+
+		for (int bin = 0; bin < CONFIG_SYS_HEAP_ANALYSIS_LATENCY_BINS; bin++) {
+			empty = empty && (hist[cls][bin] == 0U);
+		}
+		if (empty) {
+			continue;
+		}
+
+		if (cls < (CONFIG_SYS_HEAP_ANALYSIS_SIZE_CLASSES - 1)) {
+			shell_fprintf(sh, SHELL_NORMAL, "  <= %-8lu:", 8UL << cls);
+		} else {
+			shell_fprintf(sh, SHELL_NORMAL, "  >  %-8lu:", 8UL << (cls - 1));
+		}
+		for (int bin = 0; bin < CONFIG_SYS_HEAP_ANALYSIS_LATENCY_BINS; bin++) {
+			if (hist[cls][bin] != 0U) {
+				shell_fprintf(sh, SHELL_NORMAL, " [%d]=%u", bin, hist[cls][bin]);
+			}
+		}
+		shell_fprintf(sh, SHELL_NORMAL, "\n");
+	}
+}
+
+static void print_analysis(const struct shell *sh)
+{
+	static struct sys_heap_bucket_info buckets[SYS_HEAP_ANALYSIS_BUCKETS(K_HEAP_MEM_POOL_SIZE)];
+	struct sys_heap_analysis analysis;
+	size_t free_bytes = 0;
+	size_t largest = 0;
+	k_spinlock_key_t key;
+	int nb_buckets;
+
+	key = k_spin_lock(&_system_heap.lock);
+	(void)sys_heap_analysis_get(&_system_heap.heap, &analysis);
+	nb_buckets = sys_heap_fragmentation_get(&_system_heap.heap, buckets,
+						ARRAY_SIZE(buckets));
+	k_spin_unlock(&_system_heap.lock, key);
+
+	print_histogram(sh, "Allocation", analysis.alloc_latency);
+	print_histogram(sh, "Free", analysis.free_latency);
+
+	shell_fprintf(sh, SHELL_NORMAL, "Chunks tried in smallest bucket:");
+	for (int i = 0; i < SYS_HEAP_ANALYSIS_WALK_BINS; i++) {
+		shell_fprintf(sh, SHELL_NORMAL, " [%d]=%u", i, analysis.alloc_walk[i]);
+	}
+	shell_fprintf(sh, SHELL_NORMAL, "\n");
+	shell_print(sh, "Served from a larger bucket: %u", analysis.alloc_fallbacks);
+	shell_print(sh, "Failed allocations: %u", analysis.alloc_failures);
+	if (analysis.alloc_failures != 0U) {
+		shell_print(sh, "  last: %zu bytes requested, %zu bytes largest free block",
+			    analysis.last_failure_bytes, analysis.last_failure_largest_free);
+	}
+
+	shell_print(sh, "\n  bucket   free blocks    free bytes   largest free");
+	for (int i = 0; i < MIN(nb_buckets, (int)ARRAY_SIZE(buckets)); i++) {
+		if (buckets[i].free_blocks == 0U) {
+			continue;
+		}
+		shell_print(sh, "%8d %13u %13zu %14zu", i, buckets[i].free_blocks,
+			    buckets[i].free_bytes, buckets[i].largest_free_bytes);
+		free_bytes += buckets[i].free_bytes;
+		largest = MAX(largest, buckets[i].largest_free_bytes);
+	}
+
+	/* Share of the free memory not usable by a single allocation */
+	shell_print(sh, "Fragmentation: %zu%% (%zu of %zu free bytes in largest block)",
+		    (free_bytes == 0) ? 0 : (100 - (100 * largest) / free_bytes),
+		    largest, free_bytes);
+}
+
+static int cmd_kernel_heap_dump(const struct shell *sh, size_t argc, char **argv)
+{
+	static uint8_t buf[SYS_HEAP_ANALYSIS_DUMP_SIZE(K_HEAP_MEM_POOL_SIZE)];
+	k_spinlock_key_t key;
+	int len;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	key = k_spin_lock(&_system_heap.lock);
+	len = sys_heap_analysis_dump(&_system_heap.heap, buf, sizeof(buf));
+	k_spin_unlock(&_system_heap.lock, key);
+
+	if (len < 0) {
+		shell_error(sh, "Failed to dump kernel system heap analysis (err %d)", len);
+		return -ENOEXEC;
+	}
+
+	shell_hexdump(sh, buf, len);
+
+	return 0;
+}
+
+static int cmd_kernel_heap_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	k_spinlock_key_t key;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	key = k_spin_lock(&_system_heap.lock);
+	(void)sys_heap_analysis_reset(&_system_heap.heap);
+	k_spin_unlock(&_system_heap.lock, key);
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel_heap,
+	SHELL_CMD(dump, NULL, "Binary dump of the system heap analysis.",
+		  cmd_kernel_heap_dump),
+	SHELL_CMD(reset, NULL, "Reset the system heap latency histograms.",
+		  cmd_kernel_heap_reset),
+	SHELL_SUBCMD_SET_END
+);
+#define KERNEL_HEAP_SUBCMDS &sub_kernel_heap
+#else
+#define KERNEL_HEAP_SUBCMDS NULL
+#endif /* CONFIG_SYS_HEAP_ANALYSIS */
 
 static int cmd_kernel_heap(const struct shell *sh, size_t argc, char **argv)
 {
 	ARG_UNUSED(argc);
 	ARG_UNUSED(argv);
 
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	int err;
 	struct sys_memory_stats stats;
 
-	err = sys_heap_runtime_stats_get(&_system_heap, &stats);
+	err = sys_heap_runtime_stats_get(&_system_heap.heap, &stats);
 	if (err) {
 		shell_error(sh, "Failed to read kernel system heap statistics (err %d)", err);
 		return -ENOEXEC;
@@ -29,10 +155,15 @@ static int cmd_kernel_heap(const struct shell *sh, size_t argc, char **argv)
 	shell_print(sh, "free:           %zu", stats.free_bytes);
 	shell_print(sh, "allocated:      %zu", stats.allocated_bytes);
 	shell_print(sh, "max. allocated: %zu", stats.max_allocated_bytes);
+#endif /* CONFIG_SYS_HEAP_RUNTIME_STATS */
+
+#ifdef CONFIG_SYS_HEAP_ANALYSIS
+	print_analysis(sh);
+#endif /* CONFIG_SYS_HEAP_ANALYSIS */
 
 	return 0;
 }
 
-KERNEL_CMD_ADD(heap, NULL, "System heap usage statistics.", cmd_kernel_heap);
+KERNEL_CMD_ADD(heap, KERNEL_HEAP_SUBCMDS, "System heap usage statistics.", cmd_kernel_heap);
 
 #endif /* K_HEAP_MEM_POOL_SIZE > 0 */
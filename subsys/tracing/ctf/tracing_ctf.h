@@ -142,6 +142,8 @@ extern "C" {
 
 #define sys_port_trace_k_sem_give_enter(sem) sys_trace_k_sem_give_enter(sem)
 #define sys_port_trace_k_sem_give_exit(sem) sys_trace_k_sem_give_exit(sem)
+#define sys_port_trace_k_sem_give_n_enter(sem, count) sys_trace_k_sem_give_enter(sem)
+#define sys_port_trace_k_sem_give_n_exit(sem, count) sys_trace_k_sem_give_exit(sem)
 #define sys_port_trace_k_sem_take_enter(sem, timeout)                          \
 	sys_trace_k_sem_take_enter(sem, timeout)
 #define sys_port_trace_k_sem_take_blocking(sem, timeout)                       \
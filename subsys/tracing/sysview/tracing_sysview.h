@@ -297,6 +297,11 @@ void sys_trace_thread_info(struct k_thread *thread);
 
 #define sys_port_trace_k_sem_give_exit(sem) SEGGER_SYSVIEW_RecordEndCall(TID_SEMA_GIVE)
 
+#define sys_port_trace_k_sem_give_n_enter(sem, count)                                              \
+	SEGGER_SYSVIEW_RecordU32x2(TID_SEMA_GIVE, (uint32_t)(uintptr_t)sem, (uint32_t)count)
+
+#define sys_port_trace_k_sem_give_n_exit(sem, count) SEGGER_SYSVIEW_RecordEndCall(TID_SEMA_GIVE)
+
 #define sys_port_trace_k_sem_take_enter(sem, timeout)                                              \
 	SEGGER_SYSVIEW_RecordU32x2(TID_SEMA_TAKE, (uint32_t)(uintptr_t)sem, (uint32_t)timeout.ticks)
 
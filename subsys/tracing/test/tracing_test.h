@@ -126,6 +126,8 @@
 #define sys_port_trace_k_sem_init(sem, ret) sys_trace_k_sem_init(sem, ret)
 #define sys_port_trace_k_sem_give_enter(sem) sys_trace_k_sem_give_enter(sem)
 #define sys_port_trace_k_sem_give_exit(sem)
+#define sys_port_trace_k_sem_give_n_enter(sem, count) sys_trace_k_sem_give_enter(sem)
+#define sys_port_trace_k_sem_give_n_exit(sem, count)
 #define sys_port_trace_k_sem_take_enter(sem, timeout) sys_trace_k_sem_take_enter(sem, timeout)
 #define sys_port_trace_k_sem_take_blocking(sem, timeout) sys_trace_k_sem_take_blocking(sem, timeout)
 #define sys_port_trace_k_sem_take_exit(sem, timeout, ret)                                          \
@@ -206,6 +206,8 @@ void sys_trace_gpio_fire_callback_user(const struct device *port, struct gpio_ca
 #define sys_port_trace_k_sem_init(sem, ret)
 #define sys_port_trace_k_sem_give_enter(sem)
 #define sys_port_trace_k_sem_give_exit(sem)
+#define sys_port_trace_k_sem_give_n_enter(sem, count)
+#define sys_port_trace_k_sem_give_n_exit(sem, count)
 #define sys_port_trace_k_sem_take_enter(sem, timeout)
 #define sys_port_trace_k_sem_take_blocking(sem, timeout)
 #define sys_port_trace_k_sem_take_exit(sem, timeout, ret)
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Map a 2MB-aligned region of RAM, which may use a large page, and check
+ * that the pages inside it keep the right physical addresses when part of
+ * it has its permissions changed or is unmapped.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/mm.h>
+#include <zephyr/kernel/internal/mm.h>
+#include <zephyr/ztest.h>
+#include <x86_mmu.h>
+#include <kernel_arch_interface.h>
+
+#ifdef CONFIG_X86_64
+#define PD_LEVEL	2
+#else
+#define PD_LEVEL	1
+#endif
+#define PT_LEVEL	(PD_LEVEL + 1)
+
+#define LARGE_PAGE	MB(2)
+#define PAGE		CONFIG_MMU_PAGE_SIZE
+
+/* Holds a large page worth of RAM aligned on a large page */
+static uint8_t __aligned(PAGE) region[2 * LARGE_PAGE];
+
+static uintptr_t phys;
+static uint8_t *virt;
+
+static pentry_t get_entry(void *addr, int *level)
+{
+	pentry_t entry;
+
+	z_x86_pentry_get(level, &entry, z_x86_page_tables_get(), addr);
+
+	return entry;
+}
+
+static void check_phys(size_t start, size_t end)
+{
+	uintptr_t page_phys;
+
+	for (size_t off = start; off < end; off += PAGE) {
+		zassert_ok(arch_page_phys_get(virt + off, &page_phys),
+			   "page at offset 0x%zx not mapped", off);
+		zassert_equal(page_phys, phys + off,
+			      "page at offset 0x%zx maps 0x%lx, not 0x%lx", off,
+			      page_phys, phys + off);
+	}
+}
+
+static void before(void *arg)
+{
+	ARG_UNUSED(arg);
+
+	phys = ROUND_UP(k_mem_phys_addr(region), LARGE_PAGE);
+	k_mem_map_phys_bare(&virt, phys, LARGE_PAGE, K_MEM_PERM_RW | K_MEM_CACHE_WB);
+	zassert_not_null(virt, "mapping failed");
+}
+
+/**
+ * Test that the pages inside a mapping aligned on a large page are
+ * found at the right physical address
+ */
+ZTEST(x86_large_pages, test_large_map)
+{
+	uint8_t *alias = region + (phys - k_mem_phys_addr(region));
+	pentry_t entry;
+	int level;
+
+	entry = get_entry(virt, &level);
+	if (IS_ENABLED(CONFIG_X86_MMU_LARGE_PAGES)) {
+		zassert_equal(POINTER_TO_UINT(virt) % LARGE_PAGE, 0,
+			      "mapping not aligned on a large page");
+		zassert_equal(level, PD_LEVEL, "no large page");
+		zassert_true((entry & MMU_PS) != 0, "no large page");
+	} else {
+		zassert_equal(level, PT_LEVEL, "large page found");
+	}
+
+	check_phys(0, LARGE_PAGE);
+
+	for (size_t off = 0; off < LARGE_PAGE; off += PAGE) {
+		virt[off] = (uint8_t)(off / PAGE);
+		zassert_equal(alias[off], (uint8_t)(off / PAGE),
+			      "write at offset 0x%zx not seen in RAM", off);
+	}
+
+	k_mem_unmap_phys_bare(virt, LARGE_PAGE);
+}
+
+/**
+ * Test changing the permissions of one page inside a large page
+ */
+ZTEST(x86_large_pages, test_large_split_perms)
+{
+	uint8_t *page = virt + (5 * PAGE);
+	pentry_t entry;
+	int level;
+
+	zassert_ok(k_mem_update_flags(page, PAGE, K_MEM_CACHE_WB));
+
+	entry = get_entry(page, &level);
+	zassert_equal(level, PT_LEVEL, "large page not split");
+	zassert_true((entry & MMU_P) != 0, "page unmapped");
+	zassert_true((entry & MMU_RW) == 0, "page still writable");
+
+	entry = get_entry(page - PAGE, &level);
+	zassert_equal(level, PT_LEVEL, "large page not split");
+	zassert_true((entry & MMU_RW) != 0, "previous page not writable");
+
+	entry = get_entry(page + PAGE, &level);
+	zassert_true((entry & MMU_RW) != 0, "next page not writable");
+
+	check_phys(0, LARGE_PAGE);
+
+	zassert_ok(k_mem_update_flags(page, PAGE, K_MEM_PERM_RW | K_MEM_CACHE_WB));
+	check_phys(0, LARGE_PAGE);
+
+	k_mem_unmap_phys_bare(virt, LARGE_PAGE);
+}
+
+/**
+ * Test unmapping part of a large page
+ */
+ZTEST(x86_large_pages, test_large_split_unmap)
+{
+	uintptr_t page_phys;
+
+	k_mem_unmap_phys_bare(virt + (LARGE_PAGE / 2), LARGE_PAGE / 2);
+
+	check_phys(0, LARGE_PAGE / 2);
+
+	for (size_t off = LARGE_PAGE / 2; off < LARGE_PAGE; off += PAGE) {
+		zassert_equal(arch_page_phys_get(virt + off, &page_phys), -EFAULT,
+			      "page at offset 0x%zx still mapped", off);
+	}
+
+	k_mem_unmap_phys_bare(virt, LARGE_PAGE / 2);
+}
+
+ZTEST_SUITE(x86_large_pages, NULL, NULL, before, NULL, NULL);
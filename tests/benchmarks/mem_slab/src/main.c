@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measures memory slab alloc/free pairs done concurrently on the same slab
+ * by 1 to 4 threads, one per CPU.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+
+#define MAX_THREADS 4
+#define STACK_SIZE  (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define BLOCK_SIZE  64
+#define NUM_BLOCKS  64
+
+K_MEM_SLAB_DEFINE_STATIC(slab, BLOCK_SIZE, NUM_BLOCKS, sizeof(void *));
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, MAX_THREADS, STACK_SIZE);
+static struct k_thread threads[MAX_THREADS];
+
+static atomic_t failures;
+
+static void thread_entry(void *p1, void *p2, void *p3)
+{
+	void *block;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		if (k_mem_slab_alloc(&slab, &block, K_NO_WAIT) != 0) {
+			(void)atomic_inc(&failures);
+			continue;
+		}
+
+		/* Dirty the block, as its user would */
+		*(volatile uint32_t *)block = i;
+
+		k_mem_slab_free(&slab, block);
+	}
+}
+
+static uint64_t run(unsigned int num_threads)
+{
+	timing_t start;
+	timing_t finish;
+
+	for (unsigned int t = 0; t < num_threads; t++) {
+		k_thread_create(&threads[t], stacks[t], STACK_SIZE, thread_entry,
+				NULL, NULL, NULL, K_PRIO_PREEMPT(10), 0, K_FOREVER);
+#ifdef CONFIG_SCHED_CPU_MASK
+		(void)k_thread_cpu_pin(&threads[t], t);
+#endif
+	}
+
+	start = timing_counter_get();
+
+	for (unsigned int t = 0; t < num_threads; t++) {
+		k_thread_start(&threads[t]);
+	}
+
+	for (unsigned int t = 0; t < num_threads; t++) {
+		k_thread_join(&threads[t], K_FOREVER);
+	}
+
+	finish = timing_counter_get();
+
+	return timing_cycles_get(&start, &finish);
+}
+
+static void report(unsigned int num_threads, uint64_t cycles)
+{
+	uint64_t average = cycles / CONFIG_BENCHMARK_NUM_ITERATIONS;
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: mem_slab.alloc_free.%u - Alloc/free pair (%u threads) : "
+	       "%7llu cycles , %7u ns :\n", num_threads, num_threads, average,
+	       (uint32_t)timing_cycles_to_ns(average));
+#else
+	printk("%-32s (%u threads) : %7llu cycles , %7u ns\n", "Alloc/free pair",
+	       num_threads, average, (uint32_t)timing_cycles_to_ns(average));
+#endif
+}
+
+int main(void)
+{
+	unsigned int max_threads = MIN(MAX_THREADS, arch_num_cpus());
+
+	timing_init();
+
+	printk("Time Measurements for memory slabs, %u CPUs\n", arch_num_cpus());
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	timing_start();
+
+	for (unsigned int n = 1; n <= max_threads; n++) {
+		report(n, run(n));
+	}
+
+	timing_stop();
+
+	if (atomic_get(&failures) != 0) {
+		printk("%ld allocations failed\n", (long)atomic_get(&failures));
+	}
+
+	TC_END_REPORT(atomic_get(&failures) == 0 ? TC_PASS : TC_FAIL);
+
+	return 0;
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Compares mapping and accessing a region of RAM mapped from a physical
+ * address aligned on a large page, which may be mapped with large pages,
+ * and from an unaligned one, which is mapped with small pages.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/internal/mm.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+
+#define REGION_SIZE MB(4)
+#define LARGE_ALIGN MB(2)
+
+/* Room for the region from an aligned address, and one page further */
+static uint8_t region[REGION_SIZE + LARGE_ALIGN + CONFIG_MMU_PAGE_SIZE];
+
+static volatile uint32_t checksum;
+
+static void touch_pages(uint8_t *base, uint32_t round)
+{
+	uint32_t sum = 0;
+
+	/* Move within pages between rounds so that caches don't help */
+	for (size_t off = (round * 64U) % CONFIG_MMU_PAGE_SIZE; off < REGION_SIZE;
+	     off += CONFIG_MMU_PAGE_SIZE) {
+		sum += base[off];
+	}
+
+	checksum += sum;
+}
+
+static void report(const char *tag, const char *str, uint64_t cycles)
+{
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %s - %s : %7llu cycles , %7u ns :\n", tag, str, cycles,
+	       (uint32_t)timing_cycles_to_ns(cycles));
+#else
+	ARG_UNUSED(tag);
+
+	printk("%-50s : %7llu cycles , %7u ns\n", str, cycles,
+	       (uint32_t)timing_cycles_to_ns(cycles));
+#endif
+}
+
+static void run(const char *name, uintptr_t phys)
+{
+	const size_t accesses = CONFIG_BENCHMARK_NUM_ITERATIONS *
+				(REGION_SIZE / CONFIG_MMU_PAGE_SIZE);
+	char tag[48];
+	char str[64];
+	uint8_t *virt;
+	timing_t start;
+	timing_t finish;
+	uint64_t cycles;
+
+	start = timing_counter_get();
+	k_mem_map_phys_bare(&virt, phys, REGION_SIZE, K_MEM_PERM_RW | K_MEM_CACHE_WB);
+	finish = timing_counter_get();
+	snprintk(tag, sizeof(tag), "mmu.map.%s", name);
+	snprintk(str, sizeof(str), "Map 4 MB from %s address", name);
+	report(tag, str, timing_cycles_get(&start, &finish));
+
+	/* Fault in anything lazily set up before measuring */
+	touch_pages(virt, 0);
+
+	start = timing_counter_get();
+	for (uint32_t round = 0; round < CONFIG_BENCHMARK_NUM_ITERATIONS; round++) {
+		touch_pages(virt, round);
+	}
+	finish = timing_counter_get();
+	cycles = timing_cycles_get(&start, &finish);
+	snprintk(tag, sizeof(tag), "mmu.access.%s", name);
+	snprintk(str, sizeof(str), "Access a page mapped from %s address", name);
+	report(tag, str, cycles / accesses);
+
+	start = timing_counter_get();
+	k_mem_unmap_phys_bare(virt, REGION_SIZE);
+	finish = timing_counter_get();
+	snprintk(tag, sizeof(tag), "mmu.unmap.%s", name);
+	snprintk(str, sizeof(str), "Unmap 4 MB from %s address", name);
+	report(tag, str, timing_cycles_get(&start, &finish));
+}
+
+int main(void)
+{
+	uintptr_t phys = ROUND_UP(k_mem_phys_addr(region), LARGE_ALIGN);
+
+	timing_init();
+
+	printk("Time Measurements for MMU large page vs small page mappings\n");
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	timing_start();
+
+	run("aligned", phys);
+	run("unaligned", phys + CONFIG_MMU_PAGE_SIZE);
+
+	timing_stop();
+
+	TC_END_REPORT(0);
+
+	return 0;
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Compares sending and receiving messages through a message queue with the
+ * copying API and with the in-place reserve/commit and claim/release API.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+
+#define MAX_MSG_SIZE 1024
+#define MAX_MSGS     4
+
+static const size_t msg_sizes[] = {16, 64, 256, 1024};
+
+static char __aligned(4) msgq_buffer[MAX_MSGS * MAX_MSG_SIZE];
+static struct k_msgq msgq;
+
+static uint32_t __aligned(4) local_msg[MAX_MSG_SIZE / sizeof(uint32_t)];
+
+static volatile uint32_t checksum;
+
+static void build(uint32_t *msg, size_t size, uint32_t seq)
+{
+	for (size_t i = 0; i < size / sizeof(uint32_t); i++) {
+		msg[i] = seq + i;
+	}
+}
+
+static void process(const uint32_t *msg, size_t size)
+{
+	uint32_t sum = 0;
+
+	for (size_t i = 0; i < size / sizeof(uint32_t); i++) {
+		sum += msg[i];
+	}
+
+	checksum += sum;
+}
+
+static void run_copy(size_t size, uint64_t *put_cycles, uint64_t *get_cycles)
+{
+	timing_t start;
+	timing_t mid;
+	timing_t finish;
+
+	for (uint32_t n = 0; n < CONFIG_BENCHMARK_NUM_ITERATIONS; n++) {
+		start = timing_counter_get();
+		build(local_msg, size, n);
+		(void)k_msgq_put(&msgq, local_msg, K_NO_WAIT);
+		mid = timing_counter_get();
+		(void)k_msgq_get(&msgq, local_msg, K_NO_WAIT);
+		process(local_msg, size);
+		finish = timing_counter_get();
+
+		*put_cycles += timing_cycles_get(&start, &mid);
+		*get_cycles += timing_cycles_get(&mid, &finish);
+	}
+}
+
+static void run_in_place(size_t size, uint64_t *put_cycles, uint64_t *get_cycles)
+{
+	timing_t start;
+	timing_t mid;
+	timing_t finish;
+	void *msg;
+
+	for (uint32_t n = 0; n < CONFIG_BENCHMARK_NUM_ITERATIONS; n++) {
+		start = timing_counter_get();
+		(void)k_msgq_put_reserve(&msgq, &msg, K_NO_WAIT);
+		build(msg, size, n);
+		(void)k_msgq_put_commit(&msgq, msg);
+		mid = timing_counter_get();
+		(void)k_msgq_get_claim(&msgq, &msg, K_NO_WAIT);
+		process(msg, size);
+		(void)k_msgq_get_release(&msgq, msg);
+		finish = timing_counter_get();
+
+		*put_cycles += timing_cycles_get(&start, &mid);
+		*get_cycles += timing_cycles_get(&mid, &finish);
+	}
+}
+
+static void report(const char *tag, const char *str, size_t size, uint64_t cycles)
+{
+	uint64_t average = cycles / CONFIG_BENCHMARK_NUM_ITERATIONS;
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %s.%04zu - %s (%zu bytes) : %7llu cycles , %7u ns :\n", tag, size, str,
+	       size, average, (uint32_t)timing_cycles_to_ns(average));
+#else
+	ARG_UNUSED(tag);
+
+	printk("%-40s (%4zu bytes) : %7llu cycles , %7u ns\n", str, size, average,
+	       (uint32_t)timing_cycles_to_ns(average));
+#endif
+}
+
+int main(void)
+{
+	uint64_t put_cycles;
+	uint64_t get_cycles;
+
+	timing_init();
+
+	printk("Time Measurements for message queue copy vs in place access\n");
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	timing_start();
+
+	for (unsigned int i = 0; i < ARRAY_SIZE(msg_sizes); i++) {
+		size_t size = msg_sizes[i];
+
+		k_msgq_init(&msgq, msgq_buffer, size, MAX_MSGS);
+
+		put_cycles = 0;
+		get_cycles = 0;
+		run_copy(size, &put_cycles, &get_cycles);
+		report("msgq.put.copy", "Build and put a message", size, put_cycles);
+		report("msgq.get.copy", "Get and read a message", size, get_cycles);
+
+		put_cycles = 0;
+		get_cycles = 0;
+		run_in_place(size, &put_cycles, &get_cycles);
+		report("msgq.put.in_place", "Reserve, build and commit a message", size,
+		       put_cycles);
+		report("msgq.get.in_place", "Claim, read and release a message", size,
+		       get_cycles);
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(0);
+
+	return 0;
+}
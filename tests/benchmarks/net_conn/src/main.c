@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measures the lookup of the connection a received UDP packet belongs to,
+ * depending on the number of registered connections.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/dummy.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+
+#include "connection.h"
+
+#define LOCAL_PORT_BASE 1024
+#define REMOTE_PORT     5353
+
+static const int conn_counts[] = { 1, 16, 64, CONFIG_NET_MAX_CONN };
+
+static struct net_conn_handle *handles[CONFIG_NET_MAX_CONN];
+static int registered;
+
+static uint8_t mac_addr[sizeof(struct net_eth_addr)] = {
+	/* 00-00-5E-00-53-xx Documentation RFC 7042 */
+	0x00, 0x00, 0x5E, 0x00, 0x53, 0x01
+};
+
+static volatile uint32_t received;
+
+static void bench_iface_init(struct net_if *iface)
+{
+	net_if_set_link_addr(iface, mac_addr, sizeof(mac_addr), NET_LINK_ETHERNET);
+}
+
+static int bench_send(const struct device *dev, struct net_pkt *pkt)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static struct dummy_api bench_if_api = {
+	.iface_api.init = bench_iface_init,
+	.send = bench_send,
+};
+
+NET_DEVICE_INIT(net_conn_bench, "net_conn_bench", NULL, NULL, NULL, NULL,
+		CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &bench_if_api,
+		DUMMY_L2, NET_L2_GET_CTX_TYPE(DUMMY_L2), 127);
+
+/* Leaves the packet alone so that it can be passed again */
+static enum net_verdict bench_recv(struct net_conn *conn, struct net_pkt *pkt,
+				   union net_ip_header *ip_hdr,
+				   union net_proto_header *proto_hdr,
+				   void *user_data)
+{
+	ARG_UNUSED(conn);
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(ip_hdr);
+	ARG_UNUSED(proto_hdr);
+	ARG_UNUSED(user_data);
+
+	received++;
+
+	return NET_OK;
+}
+
+static void report(const char *tag, const char *str, uint64_t cycles)
+{
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %s - %s : %7llu cycles , %7u ns :\n", tag, str, cycles,
+	       (uint32_t)timing_cycles_to_ns(cycles));
+#else
+	ARG_UNUSED(tag);
+
+	printk("%-50s : %7llu cycles , %7u ns\n", str, cycles,
+	       (uint32_t)timing_cycles_to_ns(cycles));
+#endif
+}
+
+static int register_conns(int count)
+{
+	int ret;
+
+	while (registered < count) {
+		ret = net_conn_register(IPPROTO_UDP, SOCK_DGRAM, AF_INET, NULL, NULL,
+					0, LOCAL_PORT_BASE + registered, NULL,
+					bench_recv, NULL, &handles[registered]);
+		if (ret < 0) {
+			printk("Cannot register connection %d (%d)\n", registered, ret);
+			return ret;
+		}
+		registered++;
+	}
+
+	return 0;
+}
+
+static int run(struct net_pkt *pkt, int count)
+{
+	struct net_ipv4_hdr ipv4_hdr = {
+		.vhl = 0x45,
+		.ttl = 64,
+		.proto = IPPROTO_UDP,
+		.src = { 192, 0, 2, 2 },
+		.dst = { 192, 0, 2, 1 },
+	};
+	struct net_udp_hdr udp_hdr = {
+		.src_port = htons(REMOTE_PORT),
+		.dst_port = htons(LOCAL_PORT_BASE),
+	};
+	union net_ip_header ip_hdr = { .ipv4 = &ipv4_hdr };
+	union net_proto_header proto_hdr = { .udp = &udp_hdr };
+	timing_t start;
+	timing_t finish;
+	char tag[48];
+	char str[64];
+	int ret;
+
+	ret = register_conns(count);
+	if (ret < 0) {
+		return ret;
+	}
+
+	received = 0U;
+
+	start = timing_counter_get();
+	for (uint32_t i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		(void)net_conn_input(pkt, &ip_hdr, IPPROTO_UDP, &proto_hdr);
+	}
+	finish = timing_counter_get();
+
+	if (received != CONFIG_BENCHMARK_NUM_ITERATIONS) {
+		printk("Only %u of %u packets received\n", received,
+		       CONFIG_BENCHMARK_NUM_ITERATIONS);
+		return -EIO;
+	}
+
+	snprintk(tag, sizeof(tag), "net_conn.input.conns_%d", count);
+	snprintk(str, sizeof(str), "Look up a UDP packet, %d connections", count);
+	report(tag, str, timing_cycles_get(&start, &finish) /
+			 CONFIG_BENCHMARK_NUM_ITERATIONS);
+
+	return 0;
+}
+
+int main(void)
+{
+	struct net_if *iface = net_if_get_default();
+	struct net_pkt *pkt;
+	int ret = 0;
+
+	pkt = net_pkt_alloc_on_iface(iface, K_FOREVER);
+	net_pkt_set_family(pkt, AF_INET);
+
+	timing_init();
+
+	printk("Time Measurements for network connection lookup with %s\n",
+	       IS_ENABLED(CONFIG_NET_CONN_HASH) ? "hash tables" : "a list");
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	timing_start();
+
+	ARRAY_FOR_EACH(conn_counts, i) {
+		ret = run(pkt, conn_counts[i]);
+		if (ret < 0) {
+			break;
+		}
+	}
+
+	timing_stop();
+
+	for (int i = 0; i < registered; i++) {
+		(void)net_conn_unregister(handles[i]);
+	}
+	net_pkt_unref(pkt);
+
+	TC_END_REPORT(ret < 0 ? TC_FAIL : TC_PASS);
+
+	return 0;
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measures the throughput of ring queues, FIFOs and message queues with one
+ * consumer thread and 1 to 4 producer threads.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+
+#define MAX_PRODUCERS 4
+#define STACK_SIZE    (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_BENCHMARK_QUEUE_SIZE));
+
+enum queue_type {
+	QUEUE_RINGQ,
+	QUEUE_FIFO,
+	QUEUE_MSGQ,
+};
+
+struct item {
+	void *fifo_reserved;
+	uint32_t producer;
+};
+
+static struct item items[MAX_PRODUCERS][CONFIG_BENCHMARK_NUM_ITEMS];
+
+K_RINGQ_DEFINE(ringq, CONFIG_BENCHMARK_QUEUE_SIZE);
+K_FIFO_DEFINE(fifo);
+K_MSGQ_DEFINE(msgq, sizeof(struct item *), CONFIG_BENCHMARK_QUEUE_SIZE, sizeof(void *));
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, MAX_PRODUCERS, STACK_SIZE);
+static struct k_thread producers[MAX_PRODUCERS];
+
+static void producer_entry(void *p1, void *p2, void *p3)
+{
+	enum queue_type type = POINTER_TO_UINT(p1);
+	struct item *mine = p2;
+
+	ARG_UNUSED(p3);
+
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_ITEMS; i++) {
+		struct item *item = &mine[i];
+
+		switch (type) {
+		case QUEUE_RINGQ:
+			while (k_ringq_put(&ringq, item) != 0) {
+				k_yield();
+			}
+			break;
+		case QUEUE_FIFO:
+			k_fifo_put(&fifo, item);
+			break;
+		case QUEUE_MSGQ:
+			(void)k_msgq_put(&msgq, &item, K_FOREVER);
+			break;
+		}
+	}
+}
+
+static struct item *consume(enum queue_type type)
+{
+	struct item *item = NULL;
+
+	switch (type) {
+	case QUEUE_RINGQ:
+		item = k_ringq_get(&ringq, K_FOREVER);
+		break;
+	case QUEUE_FIFO:
+		item = k_fifo_get(&fifo, K_FOREVER);
+		break;
+	case QUEUE_MSGQ:
+		(void)k_msgq_get(&msgq, &item, K_FOREVER);
+		break;
+	}
+
+	return item;
+}
+
+static uint64_t run(enum queue_type type, unsigned int num_producers)
+{
+	unsigned int total = num_producers * CONFIG_BENCHMARK_NUM_ITEMS;
+	unsigned int received[MAX_PRODUCERS] = {0};
+	struct item *item;
+	timing_t start;
+	timing_t finish;
+
+	/* Producers run at a lower priority than the consumer (this thread)
+	 * and only get to run on this CPU once it blocks on an empty queue.
+	 */
+	start = timing_counter_get();
+
+	for (unsigned int p = 0; p < num_producers; p++) {
+		k_thread_create(&producers[p], stacks[p], STACK_SIZE, producer_entry,
+				UINT_TO_POINTER(type), items[p], NULL,
+				K_PRIO_PREEMPT(10), 0, K_NO_WAIT);
+	}
+
+	for (unsigned int n = 0; n < total; n++) {
+		item = consume(type);
+		received[item->producer]++;
+	}
+
+	finish = timing_counter_get();
+
+	for (unsigned int p = 0; p < num_producers; p++) {
+		k_thread_join(&producers[p], K_FOREVER);
+		if (received[p] != CONFIG_BENCHMARK_NUM_ITEMS) {
+			printk("producer %u: %u items received\n", p, received[p]);
+		}
+	}
+
+	return timing_cycles_get(&start, &finish);
+}
+
+static void report(const char *tag, const char *str, unsigned int num_producers,
+		   uint64_t cycles)
+{
+	uint64_t average = cycles / (num_producers * CONFIG_BENCHMARK_NUM_ITEMS);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %s.%u - %s (%u producers) : %7llu cycles , %7u ns :\n", tag,
+	       num_producers, str, num_producers, average,
+	       (uint32_t)timing_cycles_to_ns(average));
+#else
+	ARG_UNUSED(tag);
+
+	printk("%-32s (%u producers) : %7llu cycles , %7u ns\n", str, num_producers,
+	       average, (uint32_t)timing_cycles_to_ns(average));
+#endif
+}
+
+int main(void)
+{
+	timing_init();
+
+	for (unsigned int p = 0; p < MAX_PRODUCERS; p++) {
+		for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_ITEMS; i++) {
+			items[p][i].producer = p;
+		}
+	}
+
+	printk("Time Measurements for ring queues, %u CPUs\n", arch_num_cpus());
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	timing_start();
+
+	for (unsigned int n = 1; n <= MAX_PRODUCERS; n++) {
+		report("ringq.put_get", "Ring queue, per item", n, run(QUEUE_RINGQ, n));
+		report("fifo.put_get", "FIFO, per item", n, run(QUEUE_FIFO, n));
+		report("msgq.put_get", "Message queue, per item", n, run(QUEUE_MSGQ, n));
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(0);
+
+	return 0;
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measures how scheduler throughput scales with the number of CPUs, using
+ * one to CONFIG_MP_MAX_NUM_CPUS pairs of threads ping-ponging on semaphores.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+
+#define MAX_PAIRS  CONFIG_MP_MAX_NUM_CPUS
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+struct pair {
+	struct k_sem ping;
+	struct k_sem pong;
+};
+
+static struct pair pairs[MAX_PAIRS];
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, 2 * MAX_PAIRS, STACK_SIZE);
+static struct k_thread threads[2 * MAX_PAIRS];
+
+static void ping_entry(void *p1, void *p2, void *p3)
+{
+	struct pair *pair = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_ROUND_TRIPS; i++) {
+		k_sem_give(&pair->ping);
+		k_sem_take(&pair->pong, K_FOREVER);
+	}
+}
+
+static void pong_entry(void *p1, void *p2, void *p3)
+{
+	struct pair *pair = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_ROUND_TRIPS; i++) {
+		k_sem_take(&pair->ping, K_FOREVER);
+		k_sem_give(&pair->pong);
+	}
+}
+
+static uint64_t run(unsigned int num_pairs)
+{
+	timing_t start;
+	timing_t finish;
+
+	for (unsigned int p = 0; p < num_pairs; p++) {
+		k_sem_init(&pairs[p].ping, 0, 1);
+		k_sem_init(&pairs[p].pong, 0, 1);
+
+		k_thread_create(&threads[2 * p], stacks[2 * p], STACK_SIZE, ping_entry,
+				&pairs[p], NULL, NULL, K_PRIO_PREEMPT(10), 0, K_FOREVER);
+		k_thread_create(&threads[2 * p + 1], stacks[2 * p + 1], STACK_SIZE,
+				pong_entry, &pairs[p], NULL, NULL, K_PRIO_PREEMPT(10), 0,
+				K_FOREVER);
+	}
+
+	/* The pairs run at a lower priority than this thread, so none of them
+	 * starts before all are made ready.
+	 */
+	start = timing_counter_get();
+
+	for (unsigned int t = 0; t < 2 * num_pairs; t++) {
+		k_thread_start(&threads[t]);
+	}
+
+	for (unsigned int t = 0; t < 2 * num_pairs; t++) {
+		k_thread_join(&threads[t], K_FOREVER);
+	}
+
+	finish = timing_counter_get();
+
+	return timing_cycles_get(&start, &finish);
+}
+
+static void report(unsigned int num_pairs, uint64_t cycles)
+{
+	uint64_t average = cycles / (num_pairs * CONFIG_BENCHMARK_NUM_ROUND_TRIPS);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: sched.pingpong.%u - Semaphore round trip (%u pairs) : %7llu cycles , "
+	       "%7u ns :\n", num_pairs, num_pairs, average,
+	       (uint32_t)timing_cycles_to_ns(average));
+#else
+	printk("%-32s (%u pairs) : %7llu cycles , %7u ns\n", "Semaphore round trip",
+	       num_pairs, average, (uint32_t)timing_cycles_to_ns(average));
+#endif
+}
+
+int main(void)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	timing_init();
+
+	printk("Time Measurements for SMP scheduler scaling, %u CPUs%s\n", num_cpus,
+	       IS_ENABLED(CONFIG_SCHED_PER_CPU_RUNQ) ? ", per-CPU run queues" : "");
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	timing_start();
+
+	for (unsigned int n = 1; n <= num_cpus; n++) {
+		report(n, run(n));
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(0);
+
+	return 0;
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measures sys_heap allocations and frees under the randomized workloads
+ * of sys_heap_stress(), to compare the free chunk search engines.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/sys_heap.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+
+#define HEAP_SIZE    (16 * 1024)
+#define SCRATCH_SIZE (HEAP_SIZE / 4)
+
+static uint8_t heap_mem[HEAP_SIZE] __aligned(8);
+static uint8_t scratch_mem[SCRATCH_SIZE] __aligned(8);
+
+static struct sys_heap heap;
+
+struct op_stats {
+	uint64_t total;
+	uint64_t worst;
+	uint32_t count;
+};
+
+static struct op_stats alloc_stats;
+static struct op_stats free_stats;
+
+static void op_record(struct op_stats *stats, timing_t *start, timing_t *finish)
+{
+	uint64_t cycles = timing_cycles_get(start, finish);
+
+	stats->total += cycles;
+	stats->worst = MAX(stats->worst, cycles);
+	stats->count++;
+}
+
+static void *timed_alloc(void *arg, size_t bytes)
+{
+	timing_t start;
+	timing_t finish;
+	void *ret;
+
+	start = timing_counter_get();
+	ret = sys_heap_alloc(arg, bytes);
+	finish = timing_counter_get();
+	op_record(&alloc_stats, &start, &finish);
+
+	return ret;
+}
+
+static void timed_free(void *arg, void *p)
+{
+	timing_t start;
+	timing_t finish;
+
+	start = timing_counter_get();
+	sys_heap_free(arg, p);
+	finish = timing_counter_get();
+	op_record(&free_stats, &start, &finish);
+}
+
+static void report(const char *tag, const char *str, uint64_t cycles)
+{
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %s - %s : %7llu cycles , %7u ns :\n", tag, str, cycles,
+	       (uint32_t)timing_cycles_to_ns(cycles));
+#else
+	ARG_UNUSED(tag);
+
+	printk("%-50s : %7llu cycles , %7u ns\n", str, cycles,
+	       (uint32_t)timing_cycles_to_ns(cycles));
+#endif
+}
+
+static void report_op(const char *op, int fill, const struct op_stats *stats)
+{
+	char tag[48];
+	char str[64];
+
+	snprintk(tag, sizeof(tag), "sys_heap.%s.average.fill_%d", op, fill);
+	snprintk(str, sizeof(str), "Average %s, heap %d%% full", op, fill);
+	report(tag, str, stats->total / MAX(stats->count, 1U));
+
+	snprintk(tag, sizeof(tag), "sys_heap.%s.worst.fill_%d", op, fill);
+	snprintk(str, sizeof(str), "Worst %s, heap %d%% full", op, fill);
+	report(tag, str, stats->worst);
+}
+
+static void run(int fill)
+{
+	struct z_heap_stress_result result;
+
+	alloc_stats = (struct op_stats) {0};
+	free_stats = (struct op_stats) {0};
+
+	sys_heap_init(&heap, heap_mem, sizeof(heap_mem));
+	sys_heap_stress(timed_alloc, timed_free, &heap, sizeof(heap_mem),
+			CONFIG_BENCHMARK_NUM_ITERATIONS, scratch_mem,
+			sizeof(scratch_mem), fill, &result);
+
+	report_op("alloc", fill, &alloc_stats);
+	report_op("free", fill, &free_stats);
+
+	printk("Heap %d%% full: %u of %u allocations succeeded, %u%% used on average\n",
+	       fill, result.successful_allocs, result.total_allocs,
+	       (uint32_t)(result.accumulated_in_use_bytes * 100U /
+			  (CONFIG_BENCHMARK_NUM_ITERATIONS * (uint64_t)sizeof(heap_mem))));
+}
+
+int main(void)
+{
+	timing_init();
+
+	printk("Time Measurements for sys_heap with %s\n",
+	       IS_ENABLED(CONFIG_SYS_HEAP_TLSF) ? "TLSF" : "power-of-two buckets");
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	timing_start();
+
+	run(50);
+	run(90);
+
+	timing_stop();
+
+	TC_END_REPORT(0);
+
+	return 0;
+}
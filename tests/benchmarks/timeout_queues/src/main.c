@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measures the cost of arming, aborting and expiring kernel timeouts as a
+ * function of the number of timeouts pending in the timeout queue.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <zephyr/drivers/timer/system_timer.h>
+#include <timeout_q.h>
+
+static const unsigned int num_timeouts[] = {10, 1000, 10000};
+
+static struct _timeout timeouts[CONFIG_BENCHMARK_MAX_TIMEOUTS];
+
+static unsigned int num_expired;
+
+static void timeout_handler(struct _timeout *t)
+{
+	ARG_UNUSED(t);
+
+	num_expired++;
+}
+
+/* Deterministic pseudo-random spread of expiry times, computed rather than
+ * stored so that RAM is only spent on the timeouts themselves.
+ */
+static k_ticks_t expiry_get(unsigned int idx, unsigned int count)
+{
+	uint32_t state = 2463534242U ^ (idx * 2654435761U);
+
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+
+	return 1 + (state % (16U * count));
+}
+
+static unsigned int iterations_get(unsigned int count)
+{
+	return MAX(1U, CONFIG_BENCHMARK_NUM_ITERATIONS * 1000U / count);
+}
+
+static uint64_t add_timeouts(unsigned int count)
+{
+	timing_t start;
+	timing_t finish;
+	uint64_t cycles = 0;
+
+	for (unsigned int i = 0; i < count; i++) {
+		z_init_timeout(&timeouts[i]);
+
+		start = timing_counter_get();
+		z_add_timeout(&timeouts[i], timeout_handler, K_TICKS(expiry_get(i, count)));
+		finish = timing_counter_get();
+		cycles += timing_cycles_get(&start, &finish);
+	}
+
+	return cycles;
+}
+
+static uint64_t abort_timeouts(unsigned int count)
+{
+	timing_t start;
+	timing_t finish;
+	uint64_t cycles = 0;
+
+	/* Stride through the array so aborts do not follow insertion order,
+	 * all the tested counts are coprime with 7.
+	 */
+	for (unsigned int i = 0; i < count; i++) {
+		unsigned int idx = (i * 7U) % count;
+
+		start = timing_counter_get();
+		z_abort_timeout(&timeouts[idx]);
+		finish = timing_counter_get();
+		cycles += timing_cycles_get(&start, &finish);
+	}
+
+	return cycles;
+}
+
+static uint64_t announce_timeouts(unsigned int count)
+{
+	timing_t start;
+	timing_t finish;
+	uint64_t cycles = 0;
+
+	num_expired = 0;
+	while (num_expired < count) {
+		start = timing_counter_get();
+		sys_clock_announce(CONFIG_BENCHMARK_ANNOUNCE_STEP);
+		finish = timing_counter_get();
+		cycles += timing_cycles_get(&start, &finish);
+	}
+
+	return cycles;
+}
+
+static void report(const char *tag, const char *str, unsigned int count, uint64_t cycles)
+{
+	uint64_t average = cycles / ((uint64_t)count * iterations_get(count));
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %s.%05u - %s (%u timeouts) : %7llu cycles , %7u ns :\n", tag, count, str,
+	       count, average, (uint32_t)timing_cycles_to_ns(average));
+#else
+	ARG_UNUSED(tag);
+
+	printk("%-40s (%5u timeouts) : %7llu cycles , %7u ns\n", str, count, average,
+	       (uint32_t)timing_cycles_to_ns(average));
+#endif
+}
+
+int main(void)
+{
+	uint64_t add_cycles;
+	uint64_t abort_cycles;
+	uint64_t announce_cycles;
+	unsigned int key;
+
+	timing_init();
+
+	printk("Time Measurements for %s timeout queue\n",
+	       IS_ENABLED(CONFIG_TIMEOUT_QUEUE_WHEEL) ? "wheel" :
+	       IS_ENABLED(CONFIG_TIMEOUT_QUEUE_PER_CPU) ? "per-CPU" : "dlist");
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	timing_start();
+
+	for (unsigned int n = 0; n < ARRAY_SIZE(num_timeouts); n++) {
+		unsigned int count = num_timeouts[n];
+
+		if (count > CONFIG_BENCHMARK_MAX_TIMEOUTS) {
+			continue;
+		}
+
+		add_cycles = 0;
+		abort_cycles = 0;
+		announce_cycles = 0;
+
+		/* Keep the real timer interrupt from announcing concurrently */
+		key = irq_lock();
+
+		for (unsigned int i = 0; i < iterations_get(count); i++) {
+			add_cycles += add_timeouts(count);
+			abort_cycles += abort_timeouts(count);
+
+			add_timeouts(count);
+			announce_cycles += announce_timeouts(count);
+		}
+
+		irq_unlock(key);
+
+		report("timeout.add", "Arm a timeout", count, add_cycles);
+		report("timeout.abort", "Abort an armed timeout", count, abort_cycles);
+		report("timeout.announce", "Announce, per expired timeout", count,
+		       announce_cycles);
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(0);
+
+	return 0;
+}
@@ -12,7 +12,7 @@
 K_THREAD_STACK_DEFINE(tstack, STACK_SIZE);
 struct k_thread tdata;
 
-K_HEAP_DEFINE(k_heap_test, HEAP_SIZE);
+K_HEAP_DEFINE_CACHED(k_heap_test, HEAP_SIZE);
 
 #define ALLOC_SIZE_1 1024
 #define ALLOC_SIZE_2 1536
@@ -431,3 +431,44 @@ ZTEST(k_heap_api, test_k_heap_realloc_fail)
 
 	k_heap_free(&k_heap_test, p);
 }
+
+#ifdef CONFIG_HEAP_PERCPU_CACHE
+/**
+ * @brief Test the per-CPU caches of small blocks
+ *
+ * @ingroup k_heap_api_tests
+ *
+ * @details The test fills the heap with small blocks and frees them, which
+ * leaves some of them in the current CPU's cache. It checks that the last
+ * freed block is handed out again for a request of the same size class, and
+ * that a large allocation gets the cached blocks back from the caches.
+ *
+ * @see k_heap_alloc(), k_heap_free()
+ */
+ZTEST(k_heap_api, test_k_heap_percpu_cache)
+{
+	static void *blocks[HEAP_SIZE / 32];
+	int n;
+	char *p;
+
+	for (n = 0; n < ARRAY_SIZE(blocks); n++) {
+		blocks[n] = k_heap_alloc(&k_heap_test, 32, K_NO_WAIT);
+		if (blocks[n] == NULL) {
+			break;
+		}
+	}
+	zassert_true(n > 0, "k_heap_alloc operation failed");
+
+	while (n-- > 0) {
+		k_heap_free(&k_heap_test, blocks[n]);
+	}
+
+	p = (char *)k_heap_alloc(&k_heap_test, 24, K_NO_WAIT);
+	zassert_equal(p, blocks[0], "block not taken from the cache");
+	k_heap_free(&k_heap_test, p);
+
+	p = (char *)k_heap_alloc(&k_heap_test, ALLOC_SIZE_2, K_NO_WAIT);
+	zassert_not_null(p, "cached blocks not given back to the heap");
+	k_heap_free(&k_heap_test, p);
+}
+#endif /* CONFIG_HEAP_PERCPU_CACHE */
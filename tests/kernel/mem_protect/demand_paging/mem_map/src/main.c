@@ -113,6 +113,18 @@ static void print_paging_stats(struct k_mem_paging_stats_t *stats, const char *s
 	       stats->eviction.clean);
 	printk("    - Dirty pages evicted: %lu\n",
 	       stats->eviction.dirty);
+
+#ifdef CONFIG_DEMAND_PAGING_REFAULT_TRACKING
+	printk("* Working set (%s):\n", scope);
+	printk("    - Refaults: %lu\n", stats->workingset.refaults);
+	for (int i = 0; i < K_MEM_PAGING_REFAULT_DISTANCE_BINS; i++) {
+		printk("    - Refault distance bin %d: %lu\n", i,
+		       stats->workingset.distance[i]);
+	}
+#ifdef CONFIG_EVICTION_WORKING_SET
+	printk("    - Size: %lu\n", stats->workingset.size);
+#endif
+#endif /* CONFIG_DEMAND_PAGING_REFAULT_TRACKING */
 }
 
 static void touch_anon_pages(bool zig, bool zag)
@@ -451,6 +463,119 @@ ZTEST_USER(demand_paging_stat, test_user_get_hist)
 	printk("\n");
 }
 
+#ifdef CONFIG_EVICTION_CLOCK_PRO
+/* Pages at the start of the arena used as the working set */
+#define WS_PAGES	2U
+
+static void read_page(char *base, size_t page)
+{
+	(void)*(volatile char *)&base[page * CONFIG_MMU_PAGE_SIZE];
+}
+
+/* Read the pages of the arena after the working set once, reading the
+ * working set after each of them if ws is set. Return the number of page
+ * faults taken on the working set.
+ */
+static unsigned long stream_arena(bool ws)
+{
+	size_t pages = arena_size / CONFIG_MMU_PAGE_SIZE;
+	unsigned long ws_faults = 0UL;
+	unsigned long faults;
+
+	for (size_t p = WS_PAGES; p < pages; p++) {
+		read_page(arena, p);
+		if (!ws) {
+			continue;
+		}
+
+		faults = k_mem_num_pagefaults_get();
+		for (size_t w = 0; w < WS_PAGES; w++) {
+			read_page(arena, w);
+		}
+		ws_faults += k_mem_num_pagefaults_get() - faults;
+	}
+
+	return ws_faults;
+}
+
+/* These run after the demand_paging_api suite mapped the arena again */
+ZTEST(demand_paging_clock_pro, test_refault_detection)
+{
+	struct k_mem_paging_stats_t before, after;
+	size_t pages = arena_size / CONFIG_MMU_PAGE_SIZE;
+	unsigned long faults, refaults, far = 0UL;
+
+	/* The arena does not fit in memory, so a pass over it evicts pages
+	 * that the next pass faults in again, which are refaults.
+	 */
+	(void)stream_arena(false);
+
+	k_mem_paging_stats_get(&before);
+	faults = k_mem_num_pagefaults_get();
+	(void)stream_arena(false);
+	faults = k_mem_num_pagefaults_get() - faults;
+	k_mem_paging_stats_get(&after);
+	print_paging_stats(&after, "kernel");
+
+	refaults = after.workingset.refaults - before.workingset.refaults;
+	zassert_not_equal(faults, 0UL, "no page faults streaming the arena");
+	zassert_not_equal(refaults, 0UL, "no refault detected");
+	zassert_true(refaults <= faults, "%lu refaults for %lu page faults",
+		     refaults, faults);
+
+	/* Every page was evicted during the last two passes, so fewer
+	 * evictions than twice the arena happened before it refaulted.
+	 */
+	for (int i = LOG2(2U * pages) + 1; i < K_MEM_PAGING_REFAULT_DISTANCE_BINS; i++) {
+		far += after.workingset.distance[i] - before.workingset.distance[i];
+	}
+	zassert_equal(far, 0UL, "%lu refaults farther than possible", far);
+}
+
+ZTEST(demand_paging_clock_pro, test_working_set)
+{
+	struct k_mem_paging_stats_t before, after;
+	size_t scan_size = (EXTRA_PAGES - HALF_PAGES) * CONFIG_MMU_PAGE_SIZE;
+	unsigned long faults;
+	char *scan;
+
+	/* Pages accessed in every revolution of the clock become hot */
+	for (int i = 0; i < 3; i++) {
+		(void)stream_arena(true);
+	}
+
+	/**TESTPOINT: the working set is kept while other pages stream by */
+	zassert_equal(stream_arena(true), 0UL, "working set evicted while in use");
+
+	k_mem_paging_stats_get(&before);
+	zassert_true(before.workingset.size >= WS_PAGES,
+		     "working set of %lu pages, expected at least %u",
+		     before.workingset.size, WS_PAGES);
+
+	/* Fresh pages, only used once */
+	scan = k_mem_map(scan_size, K_MEM_PERM_RW);
+	zassert_not_null(scan, "k_mem_map failed");
+	for (size_t p = 0; p < (scan_size / CONFIG_MMU_PAGE_SIZE); p++) {
+		read_page(scan, p);
+	}
+
+	k_mem_paging_stats_get(&after);
+
+	faults = k_mem_num_pagefaults_get();
+	for (size_t w = 0; w < WS_PAGES; w++) {
+		read_page(arena, w);
+	}
+	faults = k_mem_num_pagefaults_get() - faults;
+
+	k_mem_unmap(scan, scan_size);
+
+	/**TESTPOINT: a scan neither joins nor pushes out the working set */
+	zassert_true(after.workingset.size <= before.workingset.size,
+		     "pages used once joined the working set");
+	zassert_equal(faults, 0UL, "scan evicted the working set");
+}
+#endif /* CONFIG_EVICTION_CLOCK_PRO */
+
 void *demand_paging_api_setup(void)
 {
 	arena = k_mem_map(arena_size, K_MEM_PERM_RW);
@@ -468,4 +593,8 @@ ZTEST_SUITE(demand_paging, NULL, NULL, NULL, NULL, NULL);
 ZTEST_SUITE(demand_paging_api, NULL, demand_paging_api_setup,
 		NULL, NULL, NULL);
 
+#ifdef CONFIG_EVICTION_CLOCK_PRO
+ZTEST_SUITE(demand_paging_clock_pro, NULL, NULL, NULL, NULL, NULL);
+#endif /* CONFIG_EVICTION_CLOCK_PRO */
+
 ZTEST_SUITE(demand_paging_stat, NULL, NULL, NULL, NULL, NULL);
@@ -420,6 +420,60 @@ ZTEST(futex, test_multiple_futex_wait_wake)
 	}
 }
 
+/**
+ * @brief Test k_futex_requeue() waking one thread and moving the others
+ */
+ZTEST(futex, test_futex_requeue)
+{
+	int ret;
+
+	timeout = K_TICKS_FOREVER;
+	index[0] = 0;
+	atomic_set(&multiple_futex[0].val, TOTAL_THREADS_WAITING);
+	atomic_set(&multiple_futex[1].val, 0);
+
+	for (int i = 0; i < TOTAL_THREADS_WAITING; i++) {
+		k_thread_create(&multiple_tid[i], multiple_stack[i],
+				STACK_SIZE, futex_multiple_wait_wake_task,
+				&timeout, &index[0], NULL, PRIO_WAIT,
+				K_USER | K_INHERIT_PERMS, K_NO_WAIT);
+	}
+
+	/* giving time for the other threads to execute */
+	k_yield();
+
+	ret = k_futex_requeue(&multiple_futex[0], 0, &multiple_futex[1], 1, UINT_MAX);
+	zassert_equal(ret, -EAGAIN, "requeued when values did not match");
+	ret = k_futex_requeue(&multiple_futex[0], TOTAL_THREADS_WAITING,
+			      &multiple_futex[0], 1, UINT_MAX);
+	zassert_equal(ret, -EINVAL, "requeued onto the same futex");
+
+	ret = k_futex_requeue(&multiple_futex[0], TOTAL_THREADS_WAITING,
+			      &multiple_futex[1], 1, UINT_MAX);
+	zassert_equal(ret, TOTAL_THREADS_WAITING, "not all threads woken or moved");
+
+	/* giving time for the other threads to execute */
+	k_yield();
+
+	zassert_equal(atomic_get(&multiple_futex[0].val), TOTAL_THREADS_WAITING - 1,
+		      "requeue didn't wake exactly one thread");
+
+	ret = k_futex_wake(&multiple_futex[0], true);
+	zassert_equal(ret, 0, "threads left pending on the original futex");
+	ret = k_futex_wake(&multiple_futex[1], true);
+	zassert_equal(ret, TOTAL_THREADS_WAITING - 1, "threads not moved to the target futex");
+
+	/* giving time for the other threads to execute */
+	k_yield();
+
+	zassert_equal(atomic_get(&multiple_futex[0].val), 0,
+		      "requeued threads not woken");
+
+	for (int i = 0; i < TOTAL_THREADS_WAITING; i++) {
+		k_thread_abort(&multiple_tid[i]);
+	}
+}
+
 ZTEST_USER(futex, test_user_futex_bad)
 {
 	int ret;
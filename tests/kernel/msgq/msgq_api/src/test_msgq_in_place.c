@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_msgq.h"
+
+#define IN_PLACE_LEN 4
+
+K_MSGQ_DEFINE(ipmsgq, MSG_SIZE, IN_PLACE_LEN, 4);
+static K_THREAD_STACK_ARRAY_DEFINE(ipstacks, 2, STACK_SIZE);
+static struct k_thread ipthreads[2];
+
+struct in_place_op {
+	int ret;
+	uint32_t value;
+	bool done;
+};
+
+static struct in_place_op ops[2];
+
+static void claim_entry(void *p1, void *p2, void *p3)
+{
+	struct in_place_op *op = p1;
+	uint32_t *msg;
+
+	op->ret = k_msgq_get_claim(&ipmsgq, (void **)&msg, K_FOREVER);
+	op->value = *msg;
+	op->done = true;
+
+	zassert_equal(k_msgq_get_release(&ipmsgq, msg), 0);
+}
+
+static void get_entry(void *p1, void *p2, void *p3)
+{
+	struct in_place_op *op = p1;
+
+	op->ret = k_msgq_get(&ipmsgq, &op->value, K_FOREVER);
+	op->done = true;
+}
+
+static void put_entry(void *p1, void *p2, void *p3)
+{
+	struct in_place_op *op = p1;
+
+	op->ret = k_msgq_put(&ipmsgq, &op->value, K_FOREVER);
+	op->done = true;
+}
+
+/* Helper threads have a higher priority, the test thread being cooperative
+ * it yields to let them run until they pend or exit.
+ */
+static void spawn(int i, k_thread_entry_t entry, uint32_t value)
+{
+	ops[i] = (struct in_place_op){ .ret = -1, .value = value };
+	k_thread_create(&ipthreads[i], ipstacks[i], STACK_SIZE, entry, &ops[i], NULL, NULL,
+			k_thread_priority_get(k_current_get()) - 1, 0, K_NO_WAIT);
+	k_yield();
+}
+
+static void put_value(uint32_t value)
+{
+	zassert_equal(k_msgq_put(&ipmsgq, &value, K_NO_WAIT), 0);
+}
+
+static void *reserve_value(uint32_t value)
+{
+	uint32_t *msg;
+
+	zassert_equal(k_msgq_put_reserve(&ipmsgq, (void **)&msg, K_NO_WAIT), 0);
+	*msg = value;
+
+	return msg;
+}
+
+static void check_get(uint32_t value)
+{
+	uint32_t rx;
+
+	zassert_equal(k_msgq_get(&ipmsgq, &rx, K_NO_WAIT), 0);
+	zassert_equal(rx, value);
+}
+
+/**
+ * @addtogroup kernel_message_queue_tests
+ * @{
+ */
+
+/**
+ * @brief Threads waiting to claim a message get one claim each, in turn
+ * @see k_msgq_get_claim(), k_msgq_get_release()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_claim_waiters)
+{
+	k_msgq_purge(&ipmsgq);
+
+	spawn(0, claim_entry, 0);
+	spawn(1, claim_entry, 0);
+
+	/* the first put is claimed on behalf of the first waiter, which
+	 * releases it right away
+	 */
+	put_value(MSG0);
+	k_yield();
+	zassert_true(ops[0].done);
+	zassert_equal(ops[0].ret, 0);
+	zassert_equal(ops[0].value, MSG0);
+
+	put_value(MSG1);
+	k_yield();
+	zassert_true(ops[1].done);
+	zassert_equal(ops[1].ret, 0);
+	zassert_equal(ops[1].value, MSG1);
+
+	zassert_equal(k_msgq_num_used_get(&ipmsgq), 0);
+
+	k_thread_join(&ipthreads[0], K_FOREVER);
+	k_thread_join(&ipthreads[1], K_FOREVER);
+}
+
+/**
+ * @brief A second claim waits for the first one to be released
+ * @see k_msgq_get_claim(), k_msgq_get_release()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_claim_while_claimed)
+{
+	uint32_t *msg;
+
+	k_msgq_purge(&ipmsgq);
+	put_value(MSG0);
+	put_value(MSG1);
+
+	zassert_equal(k_msgq_get_claim(&ipmsgq, (void **)&msg, K_NO_WAIT), 0);
+	zassert_equal(*msg, MSG0);
+
+	spawn(0, claim_entry, 0);
+	zassert_false(ops[0].done);
+
+	/**TESTPOINT: only the claimed slot can be released */
+	zassert_equal(k_msgq_get_release(&ipmsgq, msg + 1), -EINVAL);
+	zassert_equal(k_msgq_get_release(&ipmsgq, msg), 0);
+	k_yield();
+	zassert_true(ops[0].done);
+	zassert_equal(ops[0].value, MSG1);
+	zassert_equal(k_msgq_get_release(&ipmsgq, msg), -EINVAL);
+
+	k_thread_join(&ipthreads[0], K_FOREVER);
+}
+
+/**
+ * @brief Put and get wait while a slot is held instead of failing
+ * @see k_msgq_put_reserve(), k_msgq_get_claim(), k_msgq_put(), k_msgq_get()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_put_get_while_held)
+{
+	uint32_t *msg;
+	uint32_t rx = MSG1;
+
+	k_msgq_purge(&ipmsgq);
+
+	msg = reserve_value(MSG0);
+	zassert_equal(k_msgq_put(&ipmsgq, &rx, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_put(&ipmsgq, &rx, K_MSEC(1)), -EAGAIN);
+
+	/**TESTPOINT: the put completes once the reservation is committed,
+	 * after the reserved message
+	 */
+	spawn(0, put_entry, MSG1);
+	zassert_false(ops[0].done);
+	zassert_equal(k_msgq_put_commit(&ipmsgq, msg), 0);
+	k_yield();
+	zassert_true(ops[0].done);
+	zassert_equal(ops[0].ret, 0);
+	k_thread_join(&ipthreads[0], K_FOREVER);
+
+	zassert_equal(k_msgq_get_claim(&ipmsgq, (void **)&msg, K_NO_WAIT), 0);
+	zassert_equal(*msg, MSG0);
+	zassert_equal(k_msgq_get(&ipmsgq, &rx, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_get(&ipmsgq, &rx, K_MSEC(1)), -EAGAIN);
+
+	/**TESTPOINT: the get completes once the claim is released */
+	spawn(0, get_entry, 0);
+	zassert_false(ops[0].done);
+	zassert_equal(k_msgq_get_release(&ipmsgq, msg), 0);
+	k_yield();
+	zassert_true(ops[0].done);
+	zassert_equal(ops[0].ret, 0);
+	zassert_equal(ops[0].value, MSG1);
+	k_thread_join(&ipthreads[0], K_FOREVER);
+}
+
+/**
+ * @brief Free count and poll state account for held slots
+ * @see k_msgq_num_free_get(), k_poll()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_held_slot_state)
+{
+	uint32_t *msg;
+	void *slot;
+
+	k_msgq_purge(&ipmsgq);
+
+	slot = reserve_value(MSG0);
+	zassert_equal(k_msgq_num_free_get(&ipmsgq), IN_PLACE_LEN - 1);
+	zassert_equal(k_msgq_num_used_get(&ipmsgq), 0);
+	zassert_equal(k_msgq_put_commit(&ipmsgq, slot), 0);
+	zassert_equal(k_msgq_num_free_get(&ipmsgq), IN_PLACE_LEN - 1);
+	zassert_equal(k_msgq_num_used_get(&ipmsgq), 1);
+
+#ifdef CONFIG_POLL
+	struct k_poll_event event = K_POLL_EVENT_INITIALIZER(K_POLL_TYPE_MSGQ_DATA_AVAILABLE,
+							     K_POLL_MODE_NOTIFY_ONLY, &ipmsgq);
+
+	zassert_equal(k_msgq_get_claim(&ipmsgq, (void **)&msg, K_NO_WAIT), 0);
+
+	/**TESTPOINT: a claimed message is not data available to pollers */
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), -EAGAIN);
+
+	put_value(MSG1);
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), -EAGAIN);
+
+	zassert_equal(k_msgq_get_release(&ipmsgq, msg), 0);
+	event.state = K_POLL_STATE_NOT_READY;
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), 0);
+	zassert_equal(event.state, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+	check_get(MSG1);
+#else
+	ARG_UNUSED(msg);
+	check_get(MSG0);
+#endif
+}
+
+/**
+ * @brief Purging keeps the claimed message and the reserved slot
+ * @see k_msgq_purge()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_purge_held)
+{
+	uint32_t *claimed;
+	void *slot;
+	uint32_t rx;
+
+	k_msgq_purge(&ipmsgq);
+	put_value(MSG0);
+	put_value(MSG1);
+	put_value(MSG1);
+	zassert_equal(k_msgq_get_claim(&ipmsgq, (void **)&claimed, K_NO_WAIT), 0);
+	slot = reserve_value(MSG1 + 1);
+
+	k_msgq_purge(&ipmsgq);
+
+	/**TESTPOINT: the purged messages keep their slots until the claimed
+	 * message is released
+	 */
+	zassert_equal(k_msgq_num_used_get(&ipmsgq), 1);
+	zassert_equal(k_msgq_num_free_get(&ipmsgq), 0);
+	zassert_equal(*claimed, MSG0);
+
+	zassert_equal(k_msgq_put_commit(&ipmsgq, slot), 0);
+	zassert_equal(k_msgq_num_used_get(&ipmsgq), 2);
+	zassert_equal(k_msgq_peek_at(&ipmsgq, &rx, 1), 0);
+	zassert_equal(rx, MSG1 + 1);
+
+	zassert_equal(k_msgq_get_release(&ipmsgq, claimed), 0);
+	zassert_equal(k_msgq_num_free_get(&ipmsgq), IN_PLACE_LEN - 1);
+
+	/**TESTPOINT: the message committed after the purge comes next */
+	check_get(MSG1 + 1);
+	zassert_equal(k_msgq_get(&ipmsgq, &rx, K_NO_WAIT), -ENOMSG);
+}
+
+/**
+ * @}
+ */
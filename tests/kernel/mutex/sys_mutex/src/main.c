@@ -68,6 +68,10 @@ static SYS_MUTEX_DEFINE(no_access_mutex);
 static ZTEST_BMEM SYS_MUTEX_DEFINE(not_my_mutex);
 static ZTEST_BMEM SYS_MUTEX_DEFINE(bad_count_mutex);
 
+/* More mutexes than a thread remembers on the sys_mutex fast path */
+#define NUM_RECURSIVE_MUTEXES 8
+static ZTEST_BMEM struct sys_mutex recursive_mutex[NUM_RECURSIVE_MUTEXES];
+
 #ifdef CONFIG_USERSPACE
 #define ZTEST_USER_OR_NOT ZTEST_USER
 #else
@@ -479,6 +483,40 @@ ZTEST_USER_OR_NOT(mutex_complex, test_user_access)
 #endif /* CONFIG_USERSPACE */
 }
 
+/**
+ * @brief Test holding many mutexes recursively
+ *
+ * Lock each mutex twice, interleaving the mutexes so that a thread cannot
+ * keep track of them all at once, then check each stays locked until it
+ * is unlocked as many times as it was locked.
+ */
+ZTEST_USER_OR_NOT(mutex_complex, test_recursive_many)
+{
+	int rv;
+
+	for (int n = 0; n < 2; n++) {
+		for (int i = 0; i < NUM_RECURSIVE_MUTEXES; i++) {
+			rv = sys_mutex_lock(&recursive_mutex[i], K_NO_WAIT);
+			zassert_equal(rv, 0, "failed to lock mutex %d: %d", i, rv);
+		}
+	}
+
+	for (int i = 0; i < NUM_RECURSIVE_MUTEXES; i++) {
+		rv = sys_mutex_unlock(&recursive_mutex[i]);
+		zassert_equal(rv, 0, "failed to unlock mutex %d: %d", i, rv);
+	}
+
+	for (int i = 0; i < NUM_RECURSIVE_MUTEXES; i++) {
+		rv = sys_mutex_unlock(&recursive_mutex[i]);
+		zassert_equal(rv, 0, "mutex %d released too early: %d", i, rv);
+	}
+
+	for (int i = 0; i < NUM_RECURSIVE_MUTEXES; i++) {
+		rv = sys_mutex_unlock(&recursive_mutex[i]);
+		zassert_equal(rv, -EINVAL, "mutex %d still locked: %d", i, rv);
+	}
+}
+
 /*test case main entry*/
 static void *sys_mutex_tests_setup(void)
 {
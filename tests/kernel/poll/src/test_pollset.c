@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+
+#define PSET_SIGNAL_RESULT 0x5e7
+
+static struct k_pollset pset;
+static struct k_sem pset_sem;
+static struct k_poll_signal pset_signal;
+static struct k_poll_event pset_events[2];
+static struct k_timer pset_timer;
+
+static void pset_setup(void)
+{
+	k_pollset_init(&pset);
+	k_sem_init(&pset_sem, 0, 2);
+	k_poll_signal_init(&pset_signal);
+
+	k_poll_event_init(&pset_events[0], K_POLL_TYPE_SEM_AVAILABLE,
+			  K_POLL_MODE_NOTIFY_ONLY, &pset_sem);
+	k_poll_event_init(&pset_events[1], K_POLL_TYPE_SIGNAL,
+			  K_POLL_MODE_NOTIFY_ONLY, &pset_signal);
+
+	k_pollset_add(&pset, &pset_events[0]);
+	k_pollset_add(&pset, &pset_events[1]);
+}
+
+static void pset_teardown(void)
+{
+	zassert_equal(k_pollset_del(&pset, &pset_events[0]), 0);
+	zassert_equal(k_pollset_del(&pset, &pset_events[1]), 0);
+}
+
+static void pset_raise(struct k_timer *timer)
+{
+	ARG_UNUSED(timer);
+
+	k_poll_signal_raise(&pset_signal, PSET_SIGNAL_RESULT);
+}
+
+/**
+ * @brief Test that a poll set reports ready events and keeps them
+ * registered
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_pollset_init(), k_pollset_add(), k_pollset_wait()
+ */
+ZTEST(poll_api_1cpu, test_pollset_level_triggered)
+{
+	struct k_poll_event *ready[2];
+
+	pset_setup();
+
+	zassert_equal(k_pollset_wait(&pset, ready, 2, K_NO_WAIT), -EAGAIN);
+
+	k_sem_give(&pset_sem);
+	zassert_equal(k_pollset_wait(&pset, ready, 2, K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &pset_events[0]);
+	zassert_equal(ready[0]->state, K_POLL_STATE_SEM_AVAILABLE);
+
+	/* Still available, so reported again */
+	zassert_equal(k_pollset_wait(&pset, ready, 2, K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &pset_events[0]);
+
+	zassert_equal(k_sem_take(&pset_sem, K_NO_WAIT), 0);
+	zassert_equal(k_pollset_wait(&pset, ready, 2, K_NO_WAIT), -EAGAIN);
+
+	/* Registration survived the waits */
+	k_sem_give(&pset_sem);
+	zassert_equal(k_pollset_wait(&pset, ready, 2, K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &pset_events[0]);
+	zassert_equal(k_sem_take(&pset_sem, K_NO_WAIT), 0);
+
+	pset_teardown();
+}
+
+/**
+ * @brief Test that events are handed out in the order they became ready
+ * when there is room for fewer than are ready
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_pollset_wait()
+ */
+ZTEST(poll_api_1cpu, test_pollset_max_events)
+{
+	struct k_poll_event *ready[1];
+
+	pset_setup();
+
+	k_sem_give(&pset_sem);
+	k_poll_signal_raise(&pset_signal, PSET_SIGNAL_RESULT);
+
+	zassert_equal(k_pollset_wait(&pset, ready, 1, K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &pset_events[0]);
+
+	/* The semaphore is re-armed behind the signal */
+	zassert_equal(k_pollset_wait(&pset, ready, 1, K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &pset_events[1]);
+
+	zassert_equal(k_pollset_wait(&pset, ready, 1, K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &pset_events[0]);
+
+	zassert_equal(k_sem_take(&pset_sem, K_NO_WAIT), 0);
+	k_poll_signal_reset(&pset_signal);
+
+	pset_teardown();
+}
+
+/**
+ * @brief Test waiting on a poll set until an event is signaled or the
+ * timeout expires
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_pollset_wait()
+ */
+ZTEST(poll_api_1cpu, test_pollset_wait)
+{
+	struct k_poll_event *ready[2];
+	unsigned int signaled;
+	int result;
+
+	pset_setup();
+
+	k_timer_init(&pset_timer, pset_raise, NULL);
+	k_timer_start(&pset_timer, K_MSEC(50), K_NO_WAIT);
+
+	zassert_equal(k_pollset_wait(&pset, ready, 2, K_SECONDS(1)), 1);
+	zassert_equal_ptr(ready[0], &pset_events[1]);
+	zassert_equal(ready[0]->state, K_POLL_STATE_SIGNALED);
+
+	k_poll_signal_check(&pset_signal, &signaled, &result);
+	zassert_equal(signaled, 1);
+	zassert_equal(result, PSET_SIGNAL_RESULT);
+	k_poll_signal_reset(&pset_signal);
+
+	zassert_equal(k_pollset_wait(&pset, ready, 2, K_MSEC(50)), -EAGAIN);
+
+	pset_teardown();
+}
+
+/**
+ * @brief Test removing events from a poll set
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_pollset_del()
+ */
+ZTEST(poll_api_1cpu, test_pollset_del)
+{
+	struct k_poll_event *ready[2];
+
+	pset_setup();
+
+	/* Registered with its object */
+	zassert_equal(k_pollset_del(&pset, &pset_events[1]), 0);
+	k_poll_signal_raise(&pset_signal, PSET_SIGNAL_RESULT);
+	zassert_equal(k_pollset_wait(&pset, ready, 2, K_NO_WAIT), -EAGAIN);
+	k_poll_signal_reset(&pset_signal);
+
+	/* Returned by the last wait */
+	k_sem_give(&pset_sem);
+	zassert_equal(k_pollset_wait(&pset, ready, 2, K_NO_WAIT), 1);
+	zassert_equal(k_pollset_del(&pset, &pset_events[0]), 0);
+	zassert_equal(k_pollset_wait(&pset, ready, 2, K_NO_WAIT), -EAGAIN);
+
+	zassert_equal(k_pollset_del(&pset, &pset_events[0]), -ENOENT);
+	zassert_equal(k_pollset_del(&pset, &pset_events[1]), -ENOENT);
+
+	zassert_equal(k_sem_take(&pset_sem, K_NO_WAIT), 0);
+}
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+/* Helper threads preempt the test thread as soon as they are ready */
+#define PRIO_HELPER (CONFIG_ZTEST_THREAD_PRIORITY - 3)
+
+#define NUM_SLOTS 4
+#define TIMEOUT_MS 50
+
+K_RINGQ_DEFINE(ringq, NUM_SLOTS);
+
+static K_THREAD_STACK_DEFINE(helper_stack, STACK_SIZE);
+static struct k_thread helper_thread;
+
+static void *helper_data;
+static int helper_ret;
+
+static uint32_t items[2 * NUM_SLOTS + 1];
+
+static void getter_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	helper_data = k_ringq_get(&ringq, SYS_TIMEOUT_MS(POINTER_TO_INT(p1)));
+}
+
+static void putter_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	helper_ret = k_ringq_put(&ringq, p1);
+}
+
+static void poller_entry(void *p1, void *p2, void *p3)
+{
+	struct k_poll_event event = K_POLL_EVENT_INITIALIZER(K_POLL_TYPE_RINGQ_DATA_AVAILABLE,
+							     K_POLL_MODE_NOTIFY_ONLY, &ringq);
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	helper_ret = k_poll(&event, 1, K_FOREVER);
+	if ((helper_ret == 0) && (event.state != K_POLL_STATE_RINGQ_DATA_AVAILABLE)) {
+		helper_ret = -EINVAL;
+	}
+}
+
+static void start_helper(k_thread_entry_t entry, void *p1, k_timeout_t delay)
+{
+	helper_data = NULL;
+	helper_ret = 1;
+	k_thread_create(&helper_thread, helper_stack, STACK_SIZE, entry, p1, NULL, NULL,
+			PRIO_HELPER, 0, delay);
+}
+
+static void drain(void)
+{
+	while (k_ringq_get(&ringq, K_NO_WAIT) != NULL) {
+	}
+}
+
+/**
+ * @brief Test that items come out in the order they were put, across laps
+ */
+ZTEST(ringq_api, test_put_get_order)
+{
+	for (int lap = 0; lap < 3; lap++) {
+		for (int i = 0; i < NUM_SLOTS; i++) {
+			zassert_equal(k_ringq_put(&ringq, &items[i]), 0);
+			zassert_equal(k_ringq_num_used_get(&ringq), i + 1);
+		}
+
+		for (int i = 0; i < NUM_SLOTS; i++) {
+			zassert_equal_ptr(k_ringq_get(&ringq, K_NO_WAIT), &items[i],
+					  "item %d out of order in lap %d", i, lap);
+		}
+
+		zassert_true(k_ringq_is_empty(&ringq));
+		zassert_is_null(k_ringq_get(&ringq, K_NO_WAIT));
+	}
+}
+
+/**
+ * @brief Test that putting to a full ring queue fails, and succeeds again
+ * once an item was taken
+ */
+ZTEST(ringq_api, test_full)
+{
+	for (int i = 0; i < NUM_SLOTS; i++) {
+		zassert_equal(k_ringq_put(&ringq, &items[i]), 0);
+	}
+
+	zassert_equal(k_ringq_put(&ringq, &items[NUM_SLOTS]), -ENOMEM);
+	zassert_equal(k_ringq_num_used_get(&ringq), NUM_SLOTS);
+
+	zassert_equal_ptr(k_ringq_get(&ringq, K_NO_WAIT), &items[0]);
+	zassert_equal(k_ringq_put(&ringq, &items[NUM_SLOTS]), 0);
+
+	for (int i = 1; i <= NUM_SLOTS; i++) {
+		zassert_equal_ptr(k_ringq_get(&ringq, K_NO_WAIT), &items[i]);
+	}
+	zassert_true(k_ringq_is_empty(&ringq));
+}
+
+/**
+ * @brief Test a ring queue initialized at runtime
+ */
+ZTEST(ringq_api, test_init)
+{
+	static struct k_ringq_slot slots[2 * NUM_SLOTS];
+	static struct k_ringq rq;
+
+	k_ringq_init(&rq, slots, ARRAY_SIZE(slots));
+	zassert_true(k_ringq_is_empty(&rq));
+
+	for (int i = 0; i < ARRAY_SIZE(slots); i++) {
+		zassert_equal(k_ringq_put(&rq, &items[i]), 0);
+	}
+	zassert_equal(k_ringq_put(&rq, &items[0]), -ENOMEM);
+
+	for (int i = 0; i < ARRAY_SIZE(slots); i++) {
+		zassert_equal_ptr(k_ringq_get(&rq, K_NO_WAIT), &items[i]);
+	}
+}
+
+/**
+ * @brief Test that an item put is handed over to a thread waiting for it
+ */
+ZTEST(ringq_api, test_get_handoff)
+{
+	start_helper(getter_entry, INT_TO_POINTER(SYS_FOREVER_MS), K_NO_WAIT);
+	zassert_is_null(helper_data, "getter did not wait for an item");
+
+	zassert_equal(k_ringq_put(&ringq, &items[0]), 0);
+	k_thread_join(&helper_thread, K_FOREVER);
+
+	zassert_equal_ptr(helper_data, &items[0], "item not handed over");
+	zassert_true(k_ringq_is_empty(&ringq), "item left in the queue");
+}
+
+/**
+ * @brief Test that a getter blocked on an empty queue is woken by a putter
+ * running later
+ */
+ZTEST(ringq_api, test_get_wait)
+{
+	start_helper(putter_entry, &items[1], K_MSEC(TIMEOUT_MS));
+
+	zassert_equal_ptr(k_ringq_get(&ringq, K_FOREVER), &items[1]);
+	k_thread_join(&helper_thread, K_FOREVER);
+	zassert_equal(helper_ret, 0);
+}
+
+/**
+ * @brief Test that getting from an empty queue times out
+ */
+ZTEST(ringq_api, test_get_timeout)
+{
+	int64_t start = k_uptime_get();
+
+	zassert_is_null(k_ringq_get(&ringq, K_MSEC(TIMEOUT_MS)));
+	zassert_true(k_uptime_get() - start >= TIMEOUT_MS, "returned too early");
+
+	/* A timed out waiter does not take the next item */
+	start_helper(getter_entry, INT_TO_POINTER(TIMEOUT_MS), K_NO_WAIT);
+	k_thread_join(&helper_thread, K_FOREVER);
+	zassert_is_null(helper_data, "getter did not time out");
+
+	zassert_equal(k_ringq_put(&ringq, &items[2]), 0);
+	zassert_equal_ptr(k_ringq_get(&ringq, K_NO_WAIT), &items[2]);
+}
+
+/**
+ * @brief Test that a ring queue is ready for polling only when it holds items
+ */
+ZTEST(ringq_api, test_poll)
+{
+	struct k_poll_event event = K_POLL_EVENT_INITIALIZER(K_POLL_TYPE_RINGQ_DATA_AVAILABLE,
+							     K_POLL_MODE_NOTIFY_ONLY, &ringq);
+
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), -EAGAIN);
+
+	zassert_equal(k_ringq_put(&ringq, &items[0]), 0);
+	event.state = K_POLL_STATE_NOT_READY;
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), 0);
+	zassert_equal(event.state, K_POLL_STATE_RINGQ_DATA_AVAILABLE);
+
+	/* Polling does not consume the item */
+	zassert_equal_ptr(k_ringq_get(&ringq, K_NO_WAIT), &items[0]);
+
+	event.state = K_POLL_STATE_NOT_READY;
+	zassert_equal(k_poll(&event, 1, K_MSEC(TIMEOUT_MS)), -EAGAIN);
+
+	/* A blocked poller is signaled by a put */
+	start_helper(poller_entry, NULL, K_NO_WAIT);
+	zassert_equal(helper_ret, 1, "poller did not wait for an item");
+
+	zassert_equal(k_ringq_put(&ringq, &items[1]), 0);
+	k_thread_join(&helper_thread, K_FOREVER);
+	zassert_equal(helper_ret, 0, "poller not signaled");
+
+	zassert_equal_ptr(k_ringq_get(&ringq, K_NO_WAIT), &items[1]);
+}
+
+static void ringq_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	drain();
+}
+
+ZTEST_SUITE(ringq_api, NULL, NULL, ringq_before, NULL, NULL);
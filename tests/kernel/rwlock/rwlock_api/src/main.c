@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+/* Helper threads preempt the test thread as soon as they are ready */
+#define PRIO_HELPER (CONFIG_ZTEST_THREAD_PRIORITY - 3)
+
+#define WAIT_FOREVER (-1)
+
+K_RWLOCK_DEFINE(rwlock);
+
+static K_THREAD_STACK_DEFINE(reader_stack, STACK_SIZE);
+static K_THREAD_STACK_DEFINE(writer_stack, STACK_SIZE);
+static struct k_thread reader_thread;
+static struct k_thread writer_thread;
+
+static int reader_ret;
+static int writer_ret;
+
+static k_timeout_t to_timeout(int ms)
+{
+	return (ms == WAIT_FOREVER) ? K_FOREVER : K_MSEC(ms);
+}
+
+static void reader_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	reader_ret = k_rwlock_read_lock(&rwlock, to_timeout(POINTER_TO_INT(p1)));
+	if (reader_ret == 0) {
+		zassert_equal(k_rwlock_read_unlock(&rwlock), 0);
+	}
+}
+
+static void writer_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	writer_ret = k_rwlock_write_lock(&rwlock, to_timeout(POINTER_TO_INT(p1)));
+	if (writer_ret == 0) {
+		zassert_equal(k_rwlock_write_unlock(&rwlock), 0);
+	}
+}
+
+static void unlocker_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	writer_ret = k_rwlock_write_unlock(&rwlock);
+}
+
+static void start_reader(int ms)
+{
+	reader_ret = 1;
+	k_thread_create(&reader_thread, reader_stack, STACK_SIZE, reader_entry,
+			INT_TO_POINTER(ms), NULL, NULL, PRIO_HELPER, 0, K_NO_WAIT);
+}
+
+static void start_writer(k_thread_entry_t entry, int ms)
+{
+	writer_ret = 1;
+	k_thread_create(&writer_thread, writer_stack, STACK_SIZE, entry,
+			INT_TO_POINTER(ms), NULL, NULL, PRIO_HELPER, 0, K_NO_WAIT);
+}
+
+/**
+ * @brief Test that readers share the lock
+ */
+ZTEST(rwlock_api, test_concurrent_readers)
+{
+	zassert_equal(k_rwlock_read_lock(&rwlock, K_NO_WAIT), 0);
+
+	start_reader(0);
+	k_thread_join(&reader_thread, K_FOREVER);
+	zassert_equal(reader_ret, 0, "reader kept out by another reader");
+
+	zassert_equal(k_rwlock_read_unlock(&rwlock), 0);
+	zassert_equal(k_rwlock_read_unlock(&rwlock), -EPERM,
+		      "unlocked a lock not held for reading");
+}
+
+/**
+ * @brief Test that a writer holds the lock exclusively
+ */
+ZTEST(rwlock_api, test_writer_excludes)
+{
+	zassert_equal(k_rwlock_write_lock(&rwlock, K_NO_WAIT), 0);
+
+	zassert_equal(k_rwlock_read_lock(&rwlock, K_NO_WAIT), -EDEADLK);
+	zassert_equal(k_rwlock_write_lock(&rwlock, K_NO_WAIT), -EDEADLK);
+
+	start_reader(0);
+	k_thread_join(&reader_thread, K_FOREVER);
+	zassert_equal(reader_ret, -EBUSY, "reader got in with a writer");
+
+	start_writer(writer_entry, 0);
+	k_thread_join(&writer_thread, K_FOREVER);
+	zassert_equal(writer_ret, -EBUSY, "writer got in with a writer");
+
+	start_writer(unlocker_entry, 0);
+	k_thread_join(&writer_thread, K_FOREVER);
+	zassert_equal(writer_ret, -EPERM, "unlocked by a thread not holding it");
+
+	zassert_equal(k_rwlock_write_unlock(&rwlock), 0);
+	zassert_equal(k_rwlock_write_unlock(&rwlock), -EINVAL,
+		      "unlocked a lock not held for writing");
+}
+
+/**
+ * @brief Test that a waiting writer keeps new readers out and gets the lock
+ * from the last reader
+ */
+ZTEST(rwlock_api, test_writer_preference)
+{
+	zassert_equal(k_rwlock_read_lock(&rwlock, K_NO_WAIT), 0);
+
+	start_writer(writer_entry, WAIT_FOREVER);
+	zassert_equal(writer_ret, 1, "writer did not wait for the reader");
+
+	start_reader(0);
+	k_thread_join(&reader_thread, K_FOREVER);
+	zassert_equal(reader_ret, -EBUSY, "reader got in ahead of a waiting writer");
+
+	zassert_equal(k_rwlock_read_unlock(&rwlock), 0);
+	k_thread_join(&writer_thread, K_FOREVER);
+	zassert_equal(writer_ret, 0, "writer not handed the lock");
+
+	zassert_equal(k_rwlock_read_lock(&rwlock, K_NO_WAIT), 0);
+	zassert_equal(k_rwlock_read_unlock(&rwlock), 0);
+}
+
+/**
+ * @brief Test that readers get in once the writer they waited behind gives up
+ */
+ZTEST(rwlock_api, test_writer_timeout)
+{
+	zassert_equal(k_rwlock_read_lock(&rwlock, K_NO_WAIT), 0);
+
+	start_writer(writer_entry, 50);
+	start_reader(WAIT_FOREVER);
+	zassert_equal(reader_ret, 1, "reader did not wait behind the writer");
+
+	k_thread_join(&writer_thread, K_FOREVER);
+	zassert_equal(writer_ret, -EAGAIN, "writer did not time out");
+
+	k_thread_join(&reader_thread, K_FOREVER);
+	zassert_equal(reader_ret, 0, "reader not let in");
+
+	zassert_equal(k_rwlock_read_unlock(&rwlock), 0);
+}
+
+/**
+ * @brief Test that the writer inherits the priority of a waiting thread
+ */
+ZTEST(rwlock_api, test_priority_inheritance)
+{
+	int prio = k_thread_priority_get(k_current_get());
+
+	zassert_equal(k_rwlock_write_lock(&rwlock, K_NO_WAIT), 0);
+
+	start_writer(writer_entry, WAIT_FOREVER);
+	zassert_equal(k_thread_priority_get(k_current_get()), PRIO_HELPER,
+		      "writer priority not boosted");
+
+	zassert_equal(k_rwlock_write_unlock(&rwlock), 0);
+	zassert_equal(k_thread_priority_get(k_current_get()), prio,
+		      "writer priority not restored");
+
+	k_thread_join(&writer_thread, K_FOREVER);
+	zassert_equal(writer_ret, 0, "writer not handed the lock");
+}
+
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+/**
+ * @brief Test reader-writer lock statistics
+ */
+ZTEST(rwlock_api, test_obj_core_stats)
+{
+	struct k_rwlock_stats stats;
+
+	zassert_equal(k_obj_core_stats_reset(K_OBJ_CORE(&rwlock)), 0);
+
+	zassert_equal(k_rwlock_read_lock(&rwlock, K_NO_WAIT), 0);
+	start_writer(writer_entry, WAIT_FOREVER);
+	zassert_equal(k_rwlock_read_unlock(&rwlock), 0);
+	k_thread_join(&writer_thread, K_FOREVER);
+
+	zassert_equal(k_obj_core_stats_raw(K_OBJ_CORE(&rwlock), &stats, sizeof(stats)), 0);
+	zassert_equal(stats.write_locks, 1);
+	zassert_equal(stats.write_waits, 1);
+	zassert_equal(stats.read_waits, 0);
+}
+#endif /* CONFIG_OBJ_CORE_STATS_RWLOCK */
+
+ZTEST_SUITE(rwlock_api, NULL, NULL, NULL, NULL, NULL);
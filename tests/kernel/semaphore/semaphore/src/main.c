@@ -881,6 +881,51 @@ ZTEST(semaphore, test_sem_multiple_threads_wait)
 	}
 }
 
+/**
+ * @brief Test giving several units to multiple waiting threads at once
+ * @ingroup kernel_semaphore_tests
+ * @see k_sem_give_n()
+ */
+ZTEST(semaphore, test_sem_give_n_multiple_threads_wait)
+{
+	k_sem_reset(&simple_sem);
+	k_sem_reset(&multiple_thread_sem);
+
+	for (int i = 0; i < TOTAL_THREADS_WAITING; i++) {
+		k_thread_create(&multiple_tid[i],
+				multiple_stack[i], STACK_SIZE,
+				sem_multiple_threads_wait_helper,
+				NULL, NULL, NULL,
+				K_PRIO_PREEMPT(1),
+				K_USER | K_INHERIT_PERMS, K_NO_WAIT);
+	}
+
+	/* giving time for the other threads to execute  */
+	k_sleep(K_MSEC(500));
+
+	/* wake all the waiters, and leave two units in the semaphore */
+	k_sem_give_n(&multiple_thread_sem, TOTAL_THREADS_WAITING + 2);
+
+	/* giving time for the other threads to execute  */
+	k_sleep(K_MSEC(500));
+
+	for (int i = 0; i < TOTAL_THREADS_WAITING; i++) {
+		expect_k_sem_take(&simple_sem, K_FOREVER, 0,
+			"Some of the threads did not get multiple_thread_sem: %d != %d");
+	}
+
+	expect_k_sem_count_get_nomsg(&multiple_thread_sem, 2U);
+
+	for (int i = 0; i < TOTAL_THREADS_WAITING; i++) {
+		k_thread_join(&multiple_tid[i], K_FOREVER);
+	}
+
+	/* units beyond the limit are dropped */
+	k_sem_give_n(&multiple_thread_sem, SEM_MAX_VAL);
+	expect_k_sem_count_get_nomsg(&multiple_thread_sem, SEM_MAX_VAL);
+	k_sem_reset(&multiple_thread_sem);
+}
+
 /**
  * @brief Test semaphore timeout period
  * @ingroup kernel_semaphore_tests
@@ -82,6 +82,11 @@ ZTEST(dynamic_thread_stack, test_dynamic_thread_stack_pool)
 		ztest_test_skip();
 	}
 
+	/* kernel stacks are mapped rather than taken from the pool */
+	if (IS_ENABLED(CONFIG_DYNAMIC_THREAD_STACK_MAPPED) && !IS_ENABLED(CONFIG_USERSPACE)) {
+		ztest_test_skip();
+	}
+
 	/* allocate all thread stacks from the pool */
 	for (size_t i = 0; i < CONFIG_DYNAMIC_THREAD_POOL_SIZE; ++i) {
 		stack[i] = k_thread_stack_alloc(CONFIG_DYNAMIC_THREAD_STACK_SIZE,
@@ -168,6 +173,41 @@ ZTEST(dynamic_thread_stack, test_dynamic_thread_stack_alloc)
 	}
 }
 
+/** @brief Check that freed mapped stacks are recycled */
+ZTEST(dynamic_thread_stack, test_dynamic_thread_stack_mapped)
+{
+#ifdef CONFIG_DYNAMIC_THREAD_STACK_MAPPED
+	static struct k_thread th;
+	k_thread_stack_t *stack, *again;
+	k_tid_t tid;
+
+	stack = k_thread_stack_alloc(CONFIG_DYNAMIC_THREAD_STACK_SIZE, 0);
+	zassert_not_null(stack);
+	zassert_equal(POINTER_TO_UINT(stack) % CONFIG_MMU_PAGE_SIZE, 0,
+		      "stack %p is not page aligned", stack);
+
+	tflag[0] = false;
+	tid = k_thread_create(&th, stack, CONFIG_DYNAMIC_THREAD_STACK_SIZE, func,
+			      &tflag[0], NULL, NULL, 0, 0, K_NO_WAIT);
+	zassert_ok(k_thread_join(tid, K_MSEC(TIMEOUT_MS)));
+	zassert_true(tflag[0]);
+	zassert_ok(k_thread_stack_free(stack));
+
+	/* the stack is still mapped and handed out again */
+	again = k_thread_stack_alloc(CONFIG_DYNAMIC_THREAD_STACK_SIZE, 0);
+	zassert_equal_ptr(again, stack, "freed stack %p not recycled", stack);
+
+	tflag[0] = false;
+	tid = k_thread_create(&th, again, CONFIG_DYNAMIC_THREAD_STACK_SIZE, func,
+			      &tflag[0], NULL, NULL, 0, 0, K_NO_WAIT);
+	zassert_ok(k_thread_join(tid, K_MSEC(TIMEOUT_MS)));
+	zassert_true(tflag[0]);
+	zassert_ok(k_thread_stack_free(again));
+#else
+	ztest_test_skip();
+#endif /* CONFIG_DYNAMIC_THREAD_STACK_MAPPED */
+}
+
 K_SEM_DEFINE(perm_sem, 0, 1);
 ZTEST_BMEM static volatile bool expect_fault;
 ZTEST_BMEM static volatile unsigned int expected_reason;
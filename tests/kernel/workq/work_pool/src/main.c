@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+/* Queue threads preempt the test thread as soon as they are ready */
+#define QUEUE_PRIORITY (CONFIG_ZTEST_THREAD_PRIORITY - 3)
+
+#define NUM_WORKERS 2
+
+static struct k_work_q work_q;
+static K_THREAD_STACK_DEFINE(work_q_stack, STACK_SIZE);
+static K_THREAD_STACK_ARRAY_DEFINE(worker_stacks, NUM_WORKERS, STACK_SIZE);
+static struct k_work_q_worker workers[NUM_WORKERS];
+
+static const struct k_work_queue_config work_q_cfg = {
+	.name = "work_pool",
+	.workers = workers,
+	.num_workers = NUM_WORKERS,
+};
+
+static struct k_work blocking_work;
+static struct k_work releasing_work;
+static struct k_work_sync work_sync;
+
+/* Given by handlers once started and done */
+static K_SEM_DEFINE(started_sem, 0, 10);
+static K_SEM_DEFINE(done_sem, 0, 10);
+
+/* Given by the test to let blocking handlers return */
+static K_SEM_DEFINE(rel_sem, 0, 10);
+
+static atomic_t active;
+static atomic_t runs;
+static bool overlap;
+
+static void blocking_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	if (atomic_inc(&active) != 0) {
+		overlap = true;
+	}
+	k_sem_give(&started_sem);
+
+	(void)k_sem_take(&rel_sem, K_MSEC(1000));
+
+	(void)atomic_inc(&runs);
+	(void)atomic_dec(&active);
+	k_sem_give(&done_sem);
+}
+
+static void releasing_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_sem_give(&rel_sem);
+}
+
+static void release_cb(struct k_timer *timer)
+{
+	ARG_UNUSED(timer);
+
+	k_sem_give(&rel_sem);
+}
+
+static K_TIMER_DEFINE(release_timer, release_cb, NULL);
+
+static int worker_cpu(int i)
+{
+#ifdef CONFIG_SCHED_CPU_MASK
+	return i % arch_num_cpus();
+#else
+	ARG_UNUSED(i);
+
+	return -1;
+#endif /* CONFIG_SCHED_CPU_MASK */
+}
+
+static void work_pool_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	k_work_init(&blocking_work, blocking_handler);
+	k_work_init(&releasing_work, releasing_handler);
+	k_sem_reset(&started_sem);
+	k_sem_reset(&done_sem);
+	k_sem_reset(&rel_sem);
+	atomic_clear(&active);
+	atomic_clear(&runs);
+	overlap = false;
+
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		workers[i].stack = worker_stacks[i];
+		workers[i].stack_size = K_THREAD_STACK_SIZEOF(worker_stacks[i]);
+		workers[i].cpu = worker_cpu(i);
+	}
+
+	k_work_queue_init(&work_q);
+	k_work_queue_start(&work_q, work_q_stack, K_THREAD_STACK_SIZEOF(work_q_stack),
+			   QUEUE_PRIORITY, &work_q_cfg);
+}
+
+static void work_pool_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	k_timer_stop(&release_timer);
+
+	zassert_equal(k_work_queue_drain(&work_q, true), 1);
+	zassert_equal(k_work_queue_stop(&work_q, K_MSEC(1000)), 0,
+		      "queue threads did not exit");
+}
+
+/**
+ * @brief Test that a blocked work item does not hold up the queue
+ */
+ZTEST(work_pool, test_concurrent_items)
+{
+	zassert_equal(k_work_submit_to_queue(&work_q, &blocking_work), 1);
+	zassert_equal(k_sem_take(&started_sem, K_MSEC(100)), 0, "item not started");
+
+	zassert_equal(k_work_submit_to_queue(&work_q, &releasing_work), 1);
+
+	zassert_equal(k_sem_take(&done_sem, K_MSEC(500)), 0, "item not done");
+	zassert_equal(k_sem_take(&rel_sem, K_NO_WAIT), -EBUSY,
+		      "blocked item not released by another thread");
+}
+
+/**
+ * @brief Test that a work item submitted while running is not re-entered
+ */
+ZTEST(work_pool, test_no_reentrancy)
+{
+	zassert_equal(k_work_submit_to_queue(&work_q, &blocking_work), 1);
+	zassert_equal(k_sem_take(&started_sem, K_MSEC(100)), 0, "item not started");
+
+	zassert_equal(k_work_submit_to_queue(&work_q, &blocking_work), 2,
+		      "item not queued to its running queue");
+	zassert_equal(k_sem_take(&started_sem, K_MSEC(50)), -EAGAIN,
+		      "item re-entered by another thread");
+
+	k_sem_give(&rel_sem);
+	zassert_equal(k_sem_take(&started_sem, K_MSEC(100)), 0, "item not run again");
+	k_sem_give(&rel_sem);
+
+	zassert_equal(k_sem_take(&done_sem, K_MSEC(100)), 0);
+	zassert_equal(k_sem_take(&done_sem, K_MSEC(100)), 0);
+	zassert_false(overlap, "handler ran twice at the same time");
+}
+
+/**
+ * @brief Test that a flush waits for the running and the queued instance
+ */
+ZTEST(work_pool, test_flush)
+{
+	zassert_equal(k_work_submit_to_queue(&work_q, &blocking_work), 1);
+	zassert_equal(k_work_submit_to_queue(&work_q, &blocking_work), 2);
+
+	k_timer_start(&release_timer, K_MSEC(20), K_MSEC(20));
+
+	zassert_true(k_work_flush(&blocking_work, &work_sync));
+	zassert_equal(atomic_get(&runs), 2, "flush did not wait for both instances");
+	zassert_false(overlap, "handler ran twice at the same time");
+}
+
+/**
+ * @brief Test that cancelling a running item waits for its handler
+ */
+ZTEST(work_pool, test_cancel_sync)
+{
+	zassert_equal(k_work_submit_to_queue(&work_q, &blocking_work), 1);
+	zassert_equal(k_work_submit_to_queue(&work_q, &blocking_work), 2);
+
+	k_timer_start(&release_timer, K_MSEC(20), K_NO_WAIT);
+
+	zassert_true(k_work_cancel_sync(&blocking_work, &work_sync));
+	zassert_equal(atomic_get(&runs), 1, "cancel did not wait for the handler");
+	zassert_equal(k_work_busy_get(&blocking_work), 0);
+}
+
+ZTEST_SUITE(work_pool, NULL, NULL, work_pool_before, work_pool_after, NULL);
@@ -9,6 +9,8 @@
 #include <zephyr/sys/heap_listener.h>
 #include <inttypes.h>
 
+#include "../../../../lib/heap/heap.h"
+
 /* Guess at a value for heap size based on available memory on the
  * platform, with workarounds.
  */
@@ -41,15 +43,6 @@
 #define BIG_HEAP_SZ MIN(256 * 1024, MEMSZ / 3)
 #define SMALL_HEAP_SZ MIN(BIG_HEAP_SZ, 2048)
 
-/* With enabling SYS_HEAP_RUNTIME_STATS, the size of struct z_heap
- * will increase 16 bytes on 64 bit CPU.
- */
-#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
-#define SOLO_FREE_HEADER_HEAP_SZ (80)
-#else
-#define SOLO_FREE_HEADER_HEAP_SZ (64)
-#endif
-
 #define SCRATCH_SZ (sizeof(heapmem) / 2)
 
 /* The test memory.  Make them pointer arrays for robust alignment
@@ -238,9 +231,29 @@ ZTEST(lib_heap, test_big_heap)
 	log_result(BIG_HEAP_SZ, &result);
 }
 
+/* The chunk0 of a heap, holding its buckets, grows with the heap, and
+ * with struct z_heap when SYS_HEAP_RUNTIME_STATS is enabled. Look for the
+ * size leaving a single chunk unit after chunk0 and the allocation,
+ * chunk0 growing by one unit at most per unit of heap.
+ */
+static size_t solo_free_header_heap_sz(void)
+{
+	for (chunksz_t heap_sz = chunksz(sizeof(struct z_heap)) + 1;
+	     heap_sz < sizeof(heapmem) / CHUNK_UNIT; heap_sz++) {
+		struct z_heap h = { .end_chunk = heap_sz };
+
+		if (heap_sz == chunksz(heap_meta_bytes(&h)) + min_chunk_size(&h) + 1) {
+			return heap_sz * CHUNK_UNIT + heap_footer_bytes(heap_sz * CHUNK_UNIT);
+		}
+	}
+
+	return 0;
+}
+
 /* Test a heap with a solo free header.  A solo free header can exist
  * only on a heap with 64 bit CPU (or chunk_header_bytes() == 8).
- * With 64 bytes heap and 1 byte allocation on a big heap, we get:
+ * With 64 bytes heap, power-of-two buckets and 1 byte allocation on a big
+ * heap, we get:
  *
  *   0   1   2   3   4   5   6   7
  * | h | h | b | b | c | 1 | s | f |
@@ -256,16 +269,22 @@ ZTEST(lib_heap, test_big_heap)
 ZTEST(lib_heap, test_solo_free_header)
 {
 	struct sys_heap heap;
+	size_t heap_sz;
 
 	TC_PRINT("Testing solo free header in a heap\n");
 
-	sys_heap_init(&heap, heapmem, SOLO_FREE_HEADER_HEAP_SZ);
-	if (sizeof(void *) > 4U) {
-		sys_heap_alloc(&heap, 1);
-		zassert_true(sys_heap_validate(&heap), "");
-	} else {
+	if (sizeof(void *) <= 4U) {
 		ztest_test_skip();
 	}
+
+	heap_sz = solo_free_header_heap_sz();
+	zassert_not_equal(heap_sz, 0, "no heap size with a solo free header");
+
+	sys_heap_init(&heap, heapmem, heap_sz);
+	zassert_not_null(sys_heap_alloc(&heap, 1), "allocation failed");
+	zassert_true(solo_free_header(heap.heap, heap.heap->end_chunk - 1),
+		     "no solo free header");
+	zassert_true(sys_heap_validate(&heap), "");
 }
 
 /* Simple clobber detection */
@@ -485,4 +504,82 @@ ZTEST(lib_heap, test_heap_listeners)
 #endif /* CONFIG_SYS_HEAP_LISTENER */
 }
 
+#ifdef CONFIG_SYS_HEAP_ANALYSIS
+static uint32_t histogram_sum(const uint32_t *hist, size_t count)
+{
+	uint32_t sum = 0;
+
+	for (size_t i = 0; i < count; i++) {
+		sum += hist[i];
+	}
+
+	return sum;
+}
+#endif /* CONFIG_SYS_HEAP_ANALYSIS */
+
+ZTEST(lib_heap, test_heap_analysis)
+{
+#ifdef CONFIG_SYS_HEAP_ANALYSIS
+	static uint8_t dump[SYS_HEAP_ANALYSIS_DUMP_SIZE(SMALL_HEAP_SZ)];
+	static struct sys_heap_bucket_info buckets[SYS_HEAP_ANALYSIS_BUCKETS(SMALL_HEAP_SZ)];
+	struct sys_heap_analysis_dump_hdr hdr;
+	struct sys_heap_analysis analysis;
+	struct sys_heap heap;
+	void *blocks[8];
+	size_t free_bytes = 0, largest = 0;
+	int nb_buckets, len;
+
+	sys_heap_init(&heap, heapmem, SMALL_HEAP_SZ);
+
+	/* Fill the heap with blocks, then free every other one */
+	for (int i = 0; i < ARRAY_SIZE(blocks); i++) {
+		blocks[i] = sys_heap_alloc(&heap, SMALL_HEAP_SZ / ARRAY_SIZE(blocks) - 32);
+		zassert_not_null(blocks[i], "allocation %d failed", i);
+	}
+	for (int i = 0; i < ARRAY_SIZE(blocks); i += 2) {
+		sys_heap_free(&heap, blocks[i]);
+	}
+
+	/* More is free than requested, but not in a single block */
+	zassert_is_null(sys_heap_alloc(&heap, SMALL_HEAP_SZ / 2), "allocation succeeded");
+
+	zassert_ok(sys_heap_analysis_get(&heap, &analysis));
+	zassert_equal(histogram_sum(&analysis.alloc_latency[0][0],
+				    sizeof(analysis.alloc_latency) / sizeof(uint32_t)),
+		      ARRAY_SIZE(blocks) + 1, "wrong allocation count");
+	zassert_equal(histogram_sum(&analysis.free_latency[0][0],
+				    sizeof(analysis.free_latency) / sizeof(uint32_t)),
+		      ARRAY_SIZE(blocks) / 2, "wrong free count");
+	zassert_equal(histogram_sum(analysis.alloc_walk, ARRAY_SIZE(analysis.alloc_walk)),
+		      ARRAY_SIZE(blocks) + 1, "wrong walk count");
+	zassert_equal(analysis.alloc_failures, 1, "wrong failure count");
+	zassert_equal(analysis.last_failure_bytes, SMALL_HEAP_SZ / 2, "wrong failure size");
+
+	nb_buckets = sys_heap_fragmentation_get(&heap, buckets, ARRAY_SIZE(buckets));
+	zassert_true(nb_buckets > 0 && nb_buckets <= ARRAY_SIZE(buckets),
+		     "bad bucket count %d", nb_buckets);
+	for (int i = 0; i < nb_buckets; i++) {
+		free_bytes += buckets[i].free_bytes;
+		largest = MAX(largest, buckets[i].largest_free_bytes);
+	}
+	zassert_equal(largest, analysis.last_failure_largest_free, "wrong largest free block");
+	zassert_true(largest < SMALL_HEAP_SZ / 2, "heap not fragmented");
+	zassert_true(free_bytes >= SMALL_HEAP_SZ / 2, "heap too full");
+
+	len = sys_heap_analysis_dump(&heap, dump, sizeof(dump));
+	zassert_true(len > (int)sizeof(hdr), "dump failed (%d)", len);
+	memcpy(&hdr, dump, sizeof(hdr));
+	zassert_equal(hdr.magic, SYS_HEAP_ANALYSIS_DUMP_MAGIC, "bad magic");
+	zassert_equal(hdr.buckets, nb_buckets, "bad bucket count in dump");
+	zassert_equal(sys_heap_analysis_dump(&heap, dump, len - 1), -ENOSPC,
+		      "short buffer accepted");
+
+	zassert_ok(sys_heap_analysis_reset(&heap));
+	zassert_ok(sys_heap_analysis_get(&heap, &analysis));
+	zassert_equal(analysis.alloc_failures, 0, "statistics not reset");
+#else /* CONFIG_SYS_HEAP_ANALYSIS */
+	ztest_test_skip();
+#endif /* CONFIG_SYS_HEAP_ANALYSIS */
+}
+
 ZTEST_SUITE(lib_heap, NULL, NULL, NULL, NULL, NULL);
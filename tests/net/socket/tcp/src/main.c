@@ -12,6 +12,7 @@ LOG_MODULE_REGISTER(net_test, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <zephyr/net/net_context.h>
 #include <zephyr/net/socket.h>
 #include <zephyr/net/loopback.h>
+#include <zephyr/net_buf.h>
 
 #include "../../socket_helpers.h"
 
@@ -1422,6 +1423,86 @@ ZTEST(net_socket_tcp, test_so_rcvbuf_win_size)
 	test_context_cleanup();
 }
 
+ZTEST(net_socket_tcp, test_recvbuf_win_size)
+{
+	int rv;
+	int c_sock;
+	int s_sock;
+	int new_sock;
+	struct sockaddr_in c_saddr;
+	struct sockaddr_in s_saddr;
+	struct sockaddr addr;
+	socklen_t addrlen = sizeof(addr);
+	char tx_buf[] = TEST_STR_SMALL;
+	char rx_buf[sizeof(TEST_STR_SMALL)];
+	int buf_optval = sizeof(TEST_STR_SMALL);
+	size_t part = 2;
+	struct net_buf *buf;
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &c_sock, &c_saddr);
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, SERVER_PORT, &s_sock, &s_saddr);
+
+	test_bind(s_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_listen(s_sock);
+
+	test_connect(c_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+
+	test_accept(s_sock, &new_sock, &addr, &addrlen);
+	zassert_equal(addrlen, sizeof(struct sockaddr_in), "wrong addrlen");
+
+	/* Fill the server-side RX window */
+	rv = zsock_setsockopt(new_sock, SOL_SOCKET, SO_RCVBUF, &buf_optval,
+			      sizeof(buf_optval));
+	zassert_equal(rv, 0, "setsockopt failed (%d)", errno);
+
+	rv = zsock_send(c_sock, tx_buf, sizeof(tx_buf), ZSOCK_MSG_DONTWAIT);
+	zassert_equal(rv, sizeof(tx_buf), "Unexpected return code %d", rv);
+
+	k_msleep(150);
+
+	rv = zsock_send(c_sock, tx_buf, 1, ZSOCK_MSG_DONTWAIT);
+	zassert_equal(rv, -1, "Unexpected return code %d", rv);
+	zassert_equal(errno, EAGAIN, "Unexpected errno value: %d", errno);
+
+	/* Consume the start of the segment, then take the rest in place */
+	rv = zsock_recv(new_sock, rx_buf, part, ZSOCK_MSG_DONTWAIT);
+	zassert_equal(rv, part, "Unexpected return code %d", rv);
+	zassert_mem_equal(rx_buf, tx_buf, part, "Invalid data received");
+
+	rv = zsock_recvbuf(new_sock, &buf, ZSOCK_MSG_DONTWAIT, NULL, NULL);
+	zassert_equal(rv, sizeof(tx_buf) - part, "recvbuf failed (%d)", -errno);
+	zassert_not_null(buf, "no buffer received");
+	zassert_equal(net_buf_frags_len(buf), sizeof(tx_buf) - part,
+		      "invalid buffer length");
+	zassert_equal(net_buf_linearize(rx_buf, sizeof(rx_buf), buf, 0,
+					sizeof(rx_buf)),
+		      sizeof(tx_buf) - part, "invalid buffer length");
+	zassert_mem_equal(rx_buf, &tx_buf[part], sizeof(tx_buf) - part,
+			  "Invalid data received");
+
+	zsock_recvbuf_release(buf);
+
+	/* Wait for the window update, the client can send a full window again */
+	k_msleep(150);
+
+	rv = zsock_send(c_sock, tx_buf, sizeof(tx_buf), ZSOCK_MSG_DONTWAIT);
+	zassert_equal(rv, sizeof(tx_buf), "Unexpected return code %d", rv);
+
+	rv = zsock_recvbuf(new_sock, &buf, 0, NULL, NULL);
+	zassert_equal(rv, sizeof(tx_buf), "recvbuf failed (%d)", -errno);
+	zassert_equal(net_buf_linearize(rx_buf, sizeof(rx_buf), buf, 0,
+					sizeof(rx_buf)),
+		      sizeof(tx_buf), "invalid buffer length");
+	zassert_mem_equal(rx_buf, tx_buf, sizeof(tx_buf), "Invalid data received");
+	zsock_recvbuf_release(buf);
+
+	test_close(c_sock);
+	test_close(new_sock);
+	test_close(s_sock);
+
+	test_context_cleanup();
+}
+
 ZTEST(net_socket_tcp, test_so_sndbuf)
 {
 	struct sockaddr_in bind_addr4;
@@ -2502,6 +2583,105 @@ ZTEST(net_socket_tcp, test_keepalive_timeout)
 	test_context_cleanup();
 }
 
+#define ZEROCOPY_SEND_LEN 1500
+#define ZEROCOPY_SENDS 2
+
+ZTEST(net_socket_tcp, test_v4_msg_zerocopy)
+{
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+	/* Larger than a segment, so that each send is split */
+	static uint8_t tx_buf[ZEROCOPY_SENDS][ZEROCOPY_SEND_LEN];
+	static uint8_t rx_buf[ZEROCOPY_SEND_LEN];
+	struct sockaddr_in c_saddr, s_saddr;
+	int c_sock, s_sock, new_sock;
+	struct sock_extended_err *serr;
+	struct cmsghdr *cmsg;
+	struct zsock_pollfd pfd;
+	struct msghdr msg;
+	char cmsgbuf[CMSG_SPACE(sizeof(struct sock_extended_err))];
+	int optval = 1;
+	size_t received;
+	int ret;
+
+	for (int i = 0; i < ZEROCOPY_SENDS; i++) {
+		for (int j = 0; j < ZEROCOPY_SEND_LEN; j++) {
+			tx_buf[i][j] = (uint8_t)((i * TEST_PRIME) + j);
+		}
+	}
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &c_sock, &c_saddr);
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, SERVER_PORT, &s_sock, &s_saddr);
+
+	ret = zsock_setsockopt(c_sock, SOL_SOCKET, SO_ZEROCOPY, &optval,
+			       sizeof(optval));
+	zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+
+	test_bind(s_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_listen(s_sock);
+	test_connect(c_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_accept(s_sock, &new_sock, NULL, NULL);
+
+	for (int i = 0; i < ZEROCOPY_SENDS; i++) {
+		test_send(c_sock, tx_buf[i], ZEROCOPY_SEND_LEN, ZSOCK_MSG_ZEROCOPY);
+	}
+
+	for (int i = 0; i < ZEROCOPY_SENDS; i++) {
+		received = 0;
+		while (received < ZEROCOPY_SEND_LEN) {
+			ret = zsock_recv(new_sock, rx_buf + received,
+					 ZEROCOPY_SEND_LEN - received, 0);
+			zassert_true(ret > 0, "recv failed (%d)", errno);
+			received += ret;
+		}
+
+		zassert_mem_equal(rx_buf, tx_buf[i], ZEROCOPY_SEND_LEN,
+				  "invalid data received");
+	}
+
+	/* Both sends complete once the peer acknowledged all the data */
+	pfd.fd = c_sock;
+	pfd.events = 0;
+	ret = zsock_poll(&pfd, 1, 1000);
+	zassert_equal(ret, 1, "poll failed (%d)", errno);
+	zassert_true(pfd.revents & ZSOCK_POLLERR, "no POLLERR (0x%x)", pfd.revents);
+
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_control = cmsgbuf;
+	msg.msg_controllen = sizeof(cmsgbuf);
+
+	ret = zsock_recvmsg(c_sock, &msg, ZSOCK_MSG_ERRQUEUE);
+	zassert_equal(ret, 0, "recvmsg failed (%d)", errno);
+	zassert_true(msg.msg_flags & ZSOCK_MSG_ERRQUEUE, "no MSG_ERRQUEUE");
+
+	cmsg = CMSG_FIRSTHDR(&msg);
+	zassert_not_null(cmsg, "no control message");
+	zassert_equal(cmsg->cmsg_level, IPPROTO_IP, "invalid level");
+	zassert_equal(cmsg->cmsg_type, IP_RECVERR, "invalid type");
+
+	serr = (struct sock_extended_err *)CMSG_DATA(cmsg);
+	zassert_equal(serr->ee_origin, SO_EE_ORIGIN_ZEROCOPY, "invalid origin");
+	zassert_equal(serr->ee_info, 0, "invalid first id %u", serr->ee_info);
+	zassert_equal(serr->ee_data, ZEROCOPY_SENDS - 1, "invalid last id %u",
+		      serr->ee_data);
+
+	/* The stack never writes to the data lent to it */
+	for (int i = 0; i < ZEROCOPY_SENDS; i++) {
+		for (int j = 0; j < ZEROCOPY_SEND_LEN; j++) {
+			zassert_equal(tx_buf[i][j], (uint8_t)((i * TEST_PRIME) + j),
+				      "sent data modified at %d:%d", i, j);
+		}
+	}
+
+	test_close(c_sock);
+	test_close(new_sock);
+	test_close(s_sock);
+
+	test_context_cleanup();
+#else
+	ztest_test_skip();
+#endif
+}
+
 static void after(void *arg)
 {
 	ARG_UNUSED(arg);
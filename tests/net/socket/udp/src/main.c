@@ -16,6 +16,7 @@ LOG_MODULE_REGISTER(net_test, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <zephyr/net/ethernet.h>
 #include <zephyr/net/net_mgmt.h>
 #include <zephyr/net/net_event.h>
+#include <zephyr/net_buf.h>
 
 #include "ipv6.h"
 #include "net_private.h"
@@ -3106,6 +3107,214 @@ ZTEST(net_socket_udp, test_40_clamp_udp_tcp_port_range)
 #endif
 }
 
+ZTEST_USER(net_socket_udp, test_41_v4_sendmmsg_recvmmsg)
+{
+	static const char * const strs[] = { "first", "second", "third" };
+	int rv;
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	struct sockaddr_in addr[ARRAY_SIZE(strs) + 1];
+	struct iovec io_vector[ARRAY_SIZE(strs) + 1];
+	struct mmsghdr msgs[ARRAY_SIZE(strs) + 1];
+	char buf[ARRAY_SIZE(strs) + 1][16];
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, ANY_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(server_sock,
+			(struct sockaddr *)&server_addr,
+			sizeof(server_addr));
+	zassert_equal(rv, 0, "server bind failed");
+
+	memset(msgs, 0, sizeof(msgs));
+	for (int i = 0; i < ARRAY_SIZE(strs); i++) {
+		io_vector[i].iov_base = (void *)strs[i];
+		io_vector[i].iov_len = strlen(strs[i]);
+		msgs[i].msg_hdr.msg_iov = &io_vector[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+		msgs[i].msg_hdr.msg_name = &server_addr;
+		msgs[i].msg_hdr.msg_namelen = sizeof(server_addr);
+	}
+
+	rv = zsock_sendmmsg(client_sock, msgs, ARRAY_SIZE(strs), 0);
+	zassert_equal(rv, ARRAY_SIZE(strs), "sendmmsg failed (%d)", -errno);
+	for (int i = 0; i < ARRAY_SIZE(strs); i++) {
+		zassert_equal(msgs[i].msg_len, strlen(strs[i]), "invalid length sent");
+	}
+
+	/* Let all the datagrams be queued */
+	k_msleep(100);
+
+	memset(msgs, 0, sizeof(msgs));
+	for (int i = 0; i < ARRAY_SIZE(msgs); i++) {
+		io_vector[i].iov_base = buf[i];
+		io_vector[i].iov_len = sizeof(buf[i]);
+		msgs[i].msg_hdr.msg_iov = &io_vector[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+		msgs[i].msg_hdr.msg_name = &addr[i];
+		msgs[i].msg_hdr.msg_namelen = sizeof(addr[i]);
+	}
+
+	/* Only the queued datagrams are returned */
+	rv = zsock_recvmmsg(server_sock, msgs, ARRAY_SIZE(msgs), ZSOCK_MSG_WAITFORONE,
+			    NULL);
+	zassert_equal(rv, ARRAY_SIZE(strs), "recvmmsg failed (%d)", -errno);
+	for (int i = 0; i < ARRAY_SIZE(strs); i++) {
+		zassert_equal(msgs[i].msg_len, strlen(strs[i]), "invalid length received");
+		zassert_mem_equal(buf[i], strs[i], strlen(strs[i]), "invalid data received");
+		zassert_equal(addr[i].sin_family, AF_INET, "invalid address family");
+	}
+
+	rv = zsock_recvmmsg(server_sock, msgs, ARRAY_SIZE(msgs), ZSOCK_MSG_DONTWAIT,
+			    NULL);
+	zassert_equal(rv, -1, "recvmmsg should fail");
+	zassert_equal(errno, EAGAIN, "invalid errno (%d)", errno);
+
+	rv = zsock_close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
+ZTEST(net_socket_udp, test_42_v4_msg_zerocopy)
+{
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+	static const char * const strs[] = { "first", "second", "third" };
+	int rv;
+	int optval = 1;
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	struct sock_extended_err *serr;
+	struct cmsghdr *cmsg;
+	struct zsock_pollfd pfd;
+	struct msghdr msg;
+	char cmsgbuf[CMSG_SPACE(sizeof(struct sock_extended_err))];
+	char buf[16];
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, ANY_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(server_sock,
+			(struct sockaddr *)&server_addr,
+			sizeof(server_addr));
+	zassert_equal(rv, 0, "server bind failed");
+
+	/* The flag is ignored until the option is set */
+	rv = zsock_sendto(client_sock, strs[0], strlen(strs[0]), ZSOCK_MSG_ZEROCOPY,
+			  (struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(rv, strlen(strs[0]), "sendto failed (%d)", -errno);
+	rv = zsock_recv(server_sock, buf, sizeof(buf), 0);
+	zassert_equal(rv, strlen(strs[0]), "recv failed (%d)", -errno);
+
+	memset(&msg, 0, sizeof(msg));
+	rv = zsock_recvmsg(client_sock, &msg, ZSOCK_MSG_ERRQUEUE);
+	zassert_equal(rv, -1, "recvmsg should fail");
+	zassert_equal(errno, EAGAIN, "invalid errno (%d)", errno);
+
+	rv = zsock_setsockopt(client_sock, SOL_SOCKET, SO_ZEROCOPY, &optval,
+			      sizeof(optval));
+	zassert_equal(rv, 0, "setsockopt failed (%d)", -errno);
+
+	for (int i = 0; i < ARRAY_SIZE(strs); i++) {
+		rv = zsock_sendto(client_sock, strs[i], strlen(strs[i]),
+				  ZSOCK_MSG_ZEROCOPY,
+				  (struct sockaddr *)&server_addr, sizeof(server_addr));
+		zassert_equal(rv, strlen(strs[i]), "sendto failed (%d)", -errno);
+
+		rv = zsock_recv(server_sock, buf, sizeof(buf), 0);
+		zassert_equal(rv, strlen(strs[i]), "recv failed (%d)", -errno);
+		zassert_mem_equal(buf, strs[i], strlen(strs[i]), "invalid data received");
+	}
+
+	/* The received packets have been freed, so all the sends are complete */
+	pfd.fd = client_sock;
+	pfd.events = 0;
+	rv = zsock_poll(&pfd, 1, 100);
+	zassert_equal(rv, 1, "poll failed (%d)", -errno);
+	zassert_true(pfd.revents & ZSOCK_POLLERR, "no POLLERR (0x%x)", pfd.revents);
+
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_control = cmsgbuf;
+	msg.msg_controllen = sizeof(cmsgbuf);
+
+	rv = zsock_recvmsg(client_sock, &msg, ZSOCK_MSG_ERRQUEUE);
+	zassert_equal(rv, 0, "recvmsg failed (%d)", -errno);
+	zassert_true(msg.msg_flags & ZSOCK_MSG_ERRQUEUE, "no MSG_ERRQUEUE");
+
+	cmsg = CMSG_FIRSTHDR(&msg);
+	zassert_not_null(cmsg, "no control message");
+	zassert_equal(cmsg->cmsg_level, IPPROTO_IP, "invalid level");
+	zassert_equal(cmsg->cmsg_type, IP_RECVERR, "invalid type");
+
+	serr = (struct sock_extended_err *)CMSG_DATA(cmsg);
+	zassert_equal(serr->ee_origin, SO_EE_ORIGIN_ZEROCOPY, "invalid origin");
+	zassert_equal(serr->ee_info, 0, "invalid first id %u", serr->ee_info);
+	zassert_equal(serr->ee_data, ARRAY_SIZE(strs) - 1, "invalid last id %u",
+		      serr->ee_data);
+
+	/* Completions are reported only once */
+	memset(&msg, 0, sizeof(msg));
+	rv = zsock_recvmsg(client_sock, &msg, ZSOCK_MSG_ERRQUEUE);
+	zassert_equal(rv, -1, "recvmsg should fail");
+	zassert_equal(errno, EAGAIN, "invalid errno (%d)", errno);
+
+	rv = zsock_close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+#else
+	ztest_test_skip();
+#endif
+}
+
+ZTEST(net_socket_udp, test_43_v4_recvbuf)
+{
+	int rv;
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	struct sockaddr_in addr;
+	socklen_t addrlen = sizeof(addr);
+	struct net_buf *buf;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, ANY_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(server_sock,
+			(struct sockaddr *)&server_addr,
+			sizeof(server_addr));
+	zassert_equal(rv, 0, "server bind failed");
+
+	rv = zsock_recvbuf(server_sock, &buf, ZSOCK_MSG_DONTWAIT, NULL, NULL);
+	zassert_equal(rv, -1, "recvbuf should fail");
+	zassert_equal(errno, EAGAIN, "invalid errno (%d)", errno);
+
+	rv = zsock_sendto(client_sock, TEST_STR_SMALL, strlen(TEST_STR_SMALL), 0,
+			  (struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(rv, strlen(TEST_STR_SMALL), "sendto failed (%d)", -errno);
+
+	rv = zsock_recvbuf(server_sock, &buf, 0, (struct sockaddr *)&addr, &addrlen);
+	zassert_equal(rv, strlen(TEST_STR_SMALL), "recvbuf failed (%d)", -errno);
+	zassert_not_null(buf, "no buffer received");
+	zassert_equal(net_buf_frags_len(buf), strlen(TEST_STR_SMALL),
+		      "invalid buffer length");
+	zassert_mem_equal(buf->data, TEST_STR_SMALL, buf->len, "invalid data received");
+	zassert_equal(addrlen, sizeof(struct sockaddr_in), "invalid address length");
+	zassert_equal(addr.sin_family, AF_INET, "invalid address family");
+
+	zsock_recvbuf_release(buf);
+
+	rv = zsock_close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
 static void after(void *arg)
 {
 	ARG_UNUSED(arg);
@@ -30,6 +30,7 @@ LOG_MODULE_REGISTER(net_test, CONFIG_NET_TCP_LOG_LEVEL);
 
 #include "ipv4.h"
 #include "ipv6.h"
+#include "net_private.h"
 #include "tcp.h"
 #include "tcp_private.h"
 #include "net_stats.h"
@@ -115,6 +116,8 @@ static enum test_case_no {
 	TEST_CLIENT_FIN_WAIT_2_IPV4_FAILURE = 17,
 	TEST_CLIENT_FIN_ACK_WITH_DATA = 18,
 	TEST_CLIENT_SEQ_VALIDATION = 19,
+	TEST_CLIENT_GSO = 20,
+	TEST_SERVER_GRO = 21,
 } test_case_no;
 
 static enum test_state t_state;
@@ -140,6 +143,8 @@ static void handle_server_rst_on_listening_port(sa_family_t af, struct tcphdr *t
 static void handle_syn_invalid_ack(sa_family_t af, struct tcphdr *th);
 static void handle_client_fin_ack_with_data_test(sa_family_t af, struct tcphdr *th);
 static void handle_client_seq_validation_test(sa_family_t af, struct tcphdr *th);
+static void handle_client_gso_test(struct net_pkt *pkt, struct tcphdr *th);
+static void handle_server_gro_test(struct tcphdr *th);
 
 static void verify_flags(struct tcphdr *th, uint8_t flags,
 			 const char *fun, int line)
@@ -489,6 +494,12 @@ static int tester_send(const struct device *dev, struct net_pkt *pkt)
 	case TEST_CLIENT_SEQ_VALIDATION:
 		handle_client_seq_validation_test(net_pkt_family(pkt), &th);
 		break;
+	case TEST_CLIENT_GSO:
+		handle_client_gso_test(pkt, &th);
+		break;
+	case TEST_SERVER_GRO:
+		handle_server_gro_test(&th);
+		break;
 	default:
 		zassert_true(false, "Undefined test case");
 	}
@@ -2856,4 +2867,246 @@ ZTEST(net_tcp, test_client_seq_validation)
 	k_sleep(K_MSEC(CONFIG_NET_TCP_TIME_WAIT_DELAY));
 }
 
+#define GSO_DATA_LEN 1280
+static uint16_t gso_mss;
+static size_t gso_received;
+static uint8_t gso_payload[NET_TCP_DEFAULT_MSS];
+
+static void handle_client_gso_test(struct net_pkt *pkt, struct tcphdr *th)
+{
+	struct net_pkt *reply;
+	size_t len;
+	int ret;
+
+	if (t_state != T_DATA) {
+		handle_client_test(net_pkt_family(pkt), th);
+		return;
+	}
+
+	len = net_pkt_get_len(pkt) - net_pkt_ip_hdr_len(pkt) - th->th_off * 4U;
+
+	/* Each segment is sent on its own, right after the previous one */
+	zassert_true(len > 0 && len <= gso_mss, "Invalid segment length %zu", len);
+	zassert_equal(ntohl(th->th_seq), ack, "Invalid segment seq %u (expected %u)",
+		      ntohl(th->th_seq), ack);
+	zassert_equal(net_calc_chksum_tcp(pkt), 0U, "Invalid TCP checksum");
+	zassert_equal(net_calc_chksum_ipv4(pkt), 0U, "Invalid IPv4 checksum");
+
+	gso_received += len;
+
+	/* Only the last segment pushes the data */
+	if (gso_received < GSO_DATA_LEN) {
+		test_verify_flags(th, ACK);
+	} else {
+		test_verify_flags(th, PSH | ACK);
+	}
+
+	net_pkt_cursor_init(pkt);
+	ret = net_pkt_skip(pkt, net_pkt_ip_hdr_len(pkt) + th->th_off * 4U);
+	zassert_ok(ret, "Cannot skip the headers");
+	ret = net_pkt_read(pkt, gso_payload, len);
+	zassert_ok(ret, "Cannot read the payload");
+	zassert_mem_equal(gso_payload, lorem_ipsum + gso_received - len, len,
+			  "Invalid segment payload");
+
+	ack += len;
+
+	if (gso_received < GSO_DATA_LEN) {
+		return;
+	}
+
+	seq++;
+	reply = prepare_ack_packet(AF_INET, htons(MY_PORT), th->th_sport);
+	t_state = T_FIN;
+	test_sem_give();
+
+	ret = net_recv_data(net_iface, reply);
+	zassert_ok(ret, "recv data failed (%d)", ret);
+}
+
+/* Test case scenario IPv4
+ *   send SYN,
+ *   expect SYN ACK,
+ *   send ACK,
+ *   send Data of several segments,
+ *   expect ACK,
+ *   send FIN,
+ *   expect FIN ACK,
+ *   send ACK.
+ *   The segments of the data must be MSS sized, contiguous, each one with
+ *   valid checksums, PSH being set on the last one only.
+ */
+ZTEST(net_tcp, test_client_gso)
+{
+	struct net_context *ctx;
+	int ret;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_TCP_GSO);
+	/* The initial congestion window would only allow one segment */
+	Z_TEST_SKIP_IFDEF(CONFIG_NET_TCP_CONGESTION_AVOIDANCE);
+
+	t_state = T_SYN;
+	test_case_no = TEST_CLIENT_GSO;
+	seq = ack = 0;
+	gso_received = 0;
+
+	zassert_ok(net_context_get(AF_INET, SOCK_STREAM, IPPROTO_TCP, &ctx),
+		   "Failed to get net_context");
+
+	net_context_ref(ctx);
+
+	zassert_ok(net_context_connect(ctx, (struct sockaddr *)&peer_addr_s,
+				       sizeof(struct sockaddr_in), NULL,
+				       K_MSEC(100), NULL),
+		   "Failed to connect to peer");
+
+	/* Peer will release the semaphore after it receives
+	 * proper ACK to SYN | ACK
+	 */
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	gso_mss = conn_mss((struct tcp *)ctx->tcp);
+	zassert_true(GSO_DATA_LEN > gso_mss, "Data fits in one segment");
+
+	ret = net_context_send(ctx, lorem_ipsum, GSO_DATA_LEN, NULL, K_NO_WAIT, NULL);
+	zassert_equal(ret, GSO_DATA_LEN, "Failed to send data to peer (%d)", ret);
+
+	/* Peer will release the semaphore after it sends ACK for data */
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	zassert_equal(gso_received, GSO_DATA_LEN, "Invalid data length %zu", gso_received);
+
+	net_context_put(ctx);
+
+	/* Peer will release the semaphore after it receives
+	 * proper ACK to FIN | ACK
+	 */
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	/* Connection is in TIME_WAIT state, context will be released
+	 * after K_MSEC(CONFIG_NET_TCP_TIME_WAIT_DELAY), so wait for it.
+	 */
+	k_sleep(K_MSEC(CONFIG_NET_TCP_TIME_WAIT_DELAY));
+}
+
+#define GRO_SEG_LEN 256
+#define GRO_SEGS 4
+static bool gro_acked;
+static size_t gro_received;
+static uint8_t gro_data[GRO_SEG_LEN * GRO_SEGS];
+
+static void handle_server_gro_test(struct tcphdr *th)
+{
+	/* Later ACKs are window updates */
+	if (gro_acked) {
+		return;
+	}
+
+	/* The coalesced segments are acknowledged at once */
+	test_verify_flags(th, ACK);
+	zassert_equal(ntohl(th->th_ack), expected_ack, "Expected ACK %u but got %u",
+		      expected_ack, ntohl(th->th_ack));
+
+	gro_acked = true;
+	test_sem_give();
+}
+
+static void test_gro_recv_cb(struct net_context *context,
+			     struct net_pkt *pkt,
+			     union net_ip_header *ip_hdr,
+			     union net_proto_header *proto_hdr,
+			     int status,
+			     void *user_data)
+{
+	if (status && status != -ECONNRESET) {
+		zassert_true(false, "failed to recv the data");
+	}
+
+	if (pkt) {
+		size_t len = net_pkt_remaining_data(pkt);
+
+		zassert_true(gro_received + len <= sizeof(gro_data),
+			     "Too much data received");
+		zassert_ok(net_pkt_read(pkt, gro_data + gro_received, len));
+		gro_received += len;
+
+		net_pkt_unref(pkt);
+	}
+}
+
+/* Test case scenario IPv6
+ *   expect SYN,
+ *   send SYN ACK,
+ *   expect ACK,
+ *   send Data of several segments queued together,
+ *   expect one ACK for all of them,
+ *   send RST.
+ */
+ZTEST(net_tcp, test_server_gro)
+{
+	struct net_pkt *pkts[GRO_SEGS];
+	struct net_context *ctx;
+	struct net_pkt *rst;
+	int ret[GRO_SEGS];
+	int i;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_TCP_GRO);
+
+	k_sem_reset(&test_sem);
+
+	ctx = create_server_socket(0, 0);
+
+	test_case_no = TEST_SERVER_GRO;
+	gro_acked = false;
+	gro_received = 0;
+
+	zassert_ok(net_context_recv(accepted_ctx, test_gro_recv_cb, K_NO_WAIT, NULL),
+		   "Failed to recv data from peer");
+
+	for (i = 0; i < GRO_SEGS; i++) {
+		pkts[i] = tester_prepare_tcp_pkt(AF_INET6, htons(MY_PORT), htons(PEER_PORT),
+						 i == GRO_SEGS - 1 ? PSH | ACK : ACK,
+						 lorem_ipsum + i * GRO_SEG_LEN, GRO_SEG_LEN);
+		zassert_not_null(pkts[i], "Cannot create pkt");
+		seq += GRO_SEG_LEN;
+	}
+
+	expected_ack = seq;
+
+	/* Queue all the segments before the RX thread gets to them */
+	k_sched_lock();
+
+	for (i = 0; i < GRO_SEGS; i++) {
+		ret[i] = net_recv_data(net_iface, pkts[i]);
+	}
+
+	k_sched_unlock();
+
+	for (i = 0; i < GRO_SEGS; i++) {
+		zassert_ok(ret[i], "recv data failed (%d)", ret[i]);
+	}
+
+	/* Peer will release the semaphore after it receives the ACK */
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	/* Let the data be passed to the application */
+	k_msleep(10);
+
+	zassert_equal(gro_received, sizeof(gro_data), "Invalid data length %zu",
+		      gro_received);
+	zassert_mem_equal(gro_data, lorem_ipsum, sizeof(gro_data), "Invalid data");
+
+	/* Just send a RST packet to abort the underlying connection, so that
+	 * the testcase does not need to implement full TCP closing handshake.
+	 */
+	rst = prepare_rst_packet(AF_INET6, htons(MY_PORT), htons(PEER_PORT));
+	zassert_ok(net_recv_data(net_iface, rst), "recv data failed");
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	net_context_put(ctx);
+	net_context_put(accepted_ctx);
+}
+
 ZTEST_SUITE(net_tcp, NULL, presetup, NULL, NULL, NULL);
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+
+#include <zephyr/posix/sys/epoll.h>
+#include <zephyr/posix/sys/eventfd.h>
+#include <zephyr/posix/unistd.h>
+#include <zephyr/ztest.h>
+
+#define NUM_EFDS 3
+
+static int epfd;
+static int efds[NUM_EFDS];
+
+static void add_efd(int i, uint32_t events)
+{
+	struct epoll_event ev = {
+		.events = events,
+		.data.u32 = i,
+	};
+
+	zassert_ok(epoll_ctl(epfd, EPOLL_CTL_ADD, efds[i], &ev), "epoll_ctl failed: %d", errno);
+}
+
+static void before(void *arg)
+{
+	ARG_UNUSED(arg);
+
+	epfd = epoll_create1(0);
+	zassert_true(epfd >= 0, "epoll_create1 failed: %d", errno);
+
+	for (int i = 0; i < NUM_EFDS; i++) {
+		efds[i] = eventfd(0, EFD_NONBLOCK);
+		zassert_true(efds[i] >= 0, "eventfd failed: %d", errno);
+	}
+}
+
+static void after(void *arg)
+{
+	ARG_UNUSED(arg);
+
+	for (int i = 0; i < NUM_EFDS; i++) {
+		zassert_ok(close(efds[i]));
+	}
+
+	zassert_ok(close(epfd));
+}
+
+ZTEST(epoll, test_epoll_ctl)
+{
+	struct epoll_event ev = {.events = EPOLLIN};
+
+	add_efd(0, EPOLLIN);
+
+	zassert_equal(epoll_ctl(epfd, EPOLL_CTL_ADD, efds[0], &ev), -1);
+	zassert_equal(errno, EEXIST);
+
+	zassert_equal(epoll_ctl(epfd, EPOLL_CTL_MOD, efds[1], &ev), -1);
+	zassert_equal(errno, ENOENT);
+
+	zassert_equal(epoll_ctl(epfd, EPOLL_CTL_ADD, epfd, &ev), -1);
+	zassert_equal(errno, EINVAL);
+
+	ev.events = EPOLLIN | EPOLLET;
+	zassert_equal(epoll_ctl(epfd, EPOLL_CTL_ADD, efds[1], &ev), -1);
+	zassert_equal(errno, EINVAL);
+
+	zassert_ok(epoll_ctl(epfd, EPOLL_CTL_DEL, efds[0], NULL));
+	zassert_equal(epoll_ctl(epfd, EPOLL_CTL_DEL, efds[0], NULL), -1);
+	zassert_equal(errno, ENOENT);
+}
+
+ZTEST(epoll, test_epoll_level_triggered)
+{
+	struct epoll_event ev[NUM_EFDS];
+	eventfd_t val;
+
+	for (int i = 0; i < NUM_EFDS; i++) {
+		add_efd(i, EPOLLIN);
+	}
+
+	zassert_equal(epoll_wait(epfd, ev, NUM_EFDS, 0), 0);
+
+	zassert_ok(eventfd_write(efds[1], 1));
+	zassert_equal(epoll_wait(epfd, ev, NUM_EFDS, 0), 1);
+	zassert_equal(ev[0].data.u32, 1);
+	zassert_equal(ev[0].events, EPOLLIN);
+
+	/* Reported until read */
+	zassert_equal(epoll_wait(epfd, ev, NUM_EFDS, 0), 1);
+	zassert_equal(ev[0].data.u32, 1);
+
+	zassert_ok(eventfd_read(efds[1], &val));
+	zassert_equal(epoll_wait(epfd, ev, NUM_EFDS, 0), 0);
+
+	/* Each ready descriptor is reported once per wait */
+	zassert_ok(eventfd_write(efds[0], 1));
+	zassert_ok(eventfd_write(efds[2], 1));
+	zassert_equal(epoll_wait(epfd, ev, NUM_EFDS, 0), 2);
+	zassert_equal(epoll_wait(epfd, ev, 1, 0), 1);
+	zassert_equal(epoll_wait(epfd, ev, NUM_EFDS, 0), 2);
+
+	zassert_ok(eventfd_read(efds[0], &val));
+	zassert_ok(eventfd_read(efds[2], &val));
+}
+
+ZTEST(epoll, test_epoll_oneshot)
+{
+	struct epoll_event ev = {.events = EPOLLIN | EPOLLONESHOT, .data.u32 = 0};
+	eventfd_t val;
+
+	add_efd(0, EPOLLIN | EPOLLONESHOT);
+
+	zassert_ok(eventfd_write(efds[0], 1));
+	zassert_equal(epoll_wait(epfd, &ev, 1, 0), 1);
+	zassert_equal(epoll_wait(epfd, &ev, 1, 0), 0);
+
+	ev.events = EPOLLIN | EPOLLONESHOT;
+	zassert_ok(epoll_ctl(epfd, EPOLL_CTL_MOD, efds[0], &ev));
+	zassert_equal(epoll_wait(epfd, &ev, 1, 0), 1);
+
+	zassert_ok(eventfd_read(efds[0], &val));
+}
+
+ZTEST(epoll, test_epoll_output)
+{
+	struct epoll_event ev;
+
+	add_efd(0, EPOLLIN | EPOLLOUT);
+
+	zassert_equal(epoll_wait(epfd, &ev, 1, 0), 1);
+	zassert_equal(ev.events, EPOLLOUT);
+}
+
+static void writer(struct k_timer *timer)
+{
+	ARG_UNUSED(timer);
+
+	(void)eventfd_write(efds[2], 1);
+}
+
+ZTEST(epoll, test_epoll_wait_timeout)
+{
+	struct epoll_event ev;
+	struct k_timer timer;
+	eventfd_t val;
+
+	add_efd(2, EPOLLIN);
+
+	zassert_equal(epoll_wait(epfd, &ev, 1, 20), 0);
+
+	k_timer_init(&timer, writer, NULL);
+	k_timer_start(&timer, K_MSEC(20), K_NO_WAIT);
+
+	zassert_equal(epoll_wait(epfd, &ev, 1, 1000), 1);
+	zassert_equal(ev.data.u32, 2);
+
+	zassert_ok(eventfd_read(efds[2], &val));
+}
+
+ZTEST(epoll, test_epoll_close_removes)
+{
+	struct epoll_event ev;
+
+	add_efd(0, EPOLLIN);
+
+	zassert_ok(eventfd_write(efds[0], 1));
+	zassert_ok(close(efds[0]));
+
+	zassert_equal(epoll_wait(epfd, &ev, 1, 0), 0);
+
+	efds[0] = eventfd(0, EFD_NONBLOCK);
+	zassert_true(efds[0] >= 0, "eventfd failed: %d", errno);
+	add_efd(0, EPOLLIN);
+}
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static K_THREAD_STACK_DEFINE(waiter_stack, STACK_SIZE);
+static struct k_thread waiter_thread;
+static int waiter_ret;
+static int waiter_errno;
+
+static void waiter(void *p1, void *p2, void *p3)
+{
+	struct epoll_event ev;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	waiter_ret = epoll_wait(epfd, &ev, 1, -1);
+	waiter_errno = errno;
+}
+
+ZTEST(epoll, test_epoll_close_wakes_waiter)
+{
+	add_efd(0, EPOLLIN);
+
+	k_thread_create(&waiter_thread, waiter_stack, STACK_SIZE, waiter, NULL, NULL, NULL,
+			k_thread_priority_get(k_current_get()), 0, K_NO_WAIT);
+
+	/* Let the waiter block in epoll_wait() */
+	k_sleep(K_MSEC(10));
+
+	zassert_ok(close(epfd));
+	zassert_ok(k_thread_join(&waiter_thread, K_SECONDS(1)));
+	zassert_equal(waiter_ret, -1);
+	zassert_equal(waiter_errno, EBADF);
+
+	/* The instance was released, after() closes a new one */
+	epfd = epoll_create1(0);
+	zassert_true(epfd >= 0, "epoll_create1 failed: %d", errno);
+}
+
+ZTEST_SUITE(epoll, NULL, NULL, before, after, NULL);